@@ -0,0 +1,87 @@
+// Compare the client CPU time per poll cycle of services::read and PreparedRead for a cyclic poll
+// of 5000 variables. Only the CPU time of the client thread is measured, the server runs in another
+// thread. Both variants move the values out of the response, so the difference is the per-cycle
+// construction of the request.
+
+#include <algorithm>  // move
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <ctime>  // clock_gettime
+#endif
+
+#include <open62541pp/client.hpp>
+#include <open62541pp/node.hpp>
+#include <open62541pp/preparedread.hpp>
+#include <open62541pp/server.hpp>
+#include <open62541pp/services/attribute.hpp>
+
+/// CPU time of the calling thread in seconds.
+static double threadCpuTime() {
+#ifdef _WIN32
+    FILETIME creation{};
+    FILETIME exit{};
+    FILETIME kernel{};
+    FILETIME user{};
+    GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user);
+    auto toSeconds = [](const FILETIME& time) {
+        const auto ticks = (static_cast<uint64_t>(time.dwHighDateTime) << 32U) | time.dwLowDateTime;
+        return static_cast<double>(ticks) * 1e-7;  // 100 ns ticks
+    };
+    return toSeconds(kernel) + toSeconds(user);
+#else
+    timespec time{};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+    return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) * 1e-9;
+#endif
+}
+
+int main() {
+    constexpr size_t nodeCount = 5000;
+    constexpr size_t cycles = 200;
+
+    opcua::Server server;
+    server.config().setLogger([](auto&&...) {});
+    std::vector<opcua::ReadValueId> nodesToRead;
+    opcua::Node objects(server, opcua::ObjectId::ObjectsFolder);
+    for (size_t i = 0; i < nodeCount; ++i) {
+        const opcua::NodeId id(1, "Variable." + std::to_string(i));
+        objects.addVariable(
+            id, "Variable." + std::to_string(i), opcua::VariableAttributes{}.setValueScalar(1.0)
+        );
+        nodesToRead.emplace_back(id, opcua::AttributeId::Value);
+    }
+    auto serverThread = std::thread([&] { server.run(); });
+
+    opcua::Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    auto measure = [&](const char* name, auto&& poll) {
+        const double start = threadCpuTime();
+        for (size_t i = 0; i < cycles; ++i) {
+            poll();
+        }
+        const double seconds = threadCpuTime() - start;
+        std::cout << name << ": " << seconds / cycles * 1e3 << " ms client CPU per poll cycle\n";
+    };
+
+    std::vector<opcua::DataValue> values(nodeCount);
+    measure("services::read", [&] {
+        auto response = opcua::services::read(client, nodesToRead, opcua::TimestampsToReturn::Both);
+        auto results = response.results();
+        std::move(results.begin(), results.end(), values.begin());
+    });
+
+    opcua::PreparedRead prepared(client, nodesToRead);
+    measure("PreparedRead  ", [&] { prepared.readInto(values); });
+
+    client.disconnect();
+    server.stop();
+    serverThread.join();
+}
@@ -0,0 +1,59 @@
+// Measure the FileType transfer throughput over a local loopback connection with different
+// numbers of pipelined Read/Write method calls.
+
+#include <chrono>
+#include <cstdio>  // remove
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <open62541pp/client.hpp>
+#include <open62541pp/filetype.hpp>
+#include <open62541pp/server.hpp>
+#include <open62541pp/ua/nodeids.hpp>
+
+int main() {
+    constexpr size_t fileSize = 32 * 1024 * 1024;
+    const char* path = "filetype_loopback.bin";
+
+    opcua::Server server;
+    server.config().setLogger([](auto&&...) {});
+    const opcua::NodeId fileId(1, "File");
+    opcua::addFileObject(server, opcua::ObjectId::ObjectsFolder, fileId, "File", path);
+    auto serverThread = std::thread([&] { server.run(); });
+
+    opcua::Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    const std::vector<uint8_t> data(fileSize, 0xAB);
+    auto measure = [&](const char* operation, size_t maxPendingRequests, auto&& transfer) {
+        opcua::FileTypeClientOptions options;
+        options.maxPendingRequests = maxPendingRequests;
+        opcua::FileTypeClient file(client, fileId, options);
+        const auto start = std::chrono::steady_clock::now();
+        const uint64_t bytes = transfer(file);
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+        std::cout << operation << " with " << maxPendingRequests << " pending requests: "
+                  << static_cast<double>(bytes) / (1024 * 1024) / duration.count() << " MB/s\n";
+    };
+
+    for (const size_t maxPendingRequests : {1, 2, 4, 8, 16}) {
+        measure("Write", maxPendingRequests, [&](opcua::FileTypeClient& file) {
+            file.open(opcua::OpenFileMode::Write | opcua::OpenFileMode::EraseExisting);
+            const auto bytes = file.write(opcua::Span<const uint8_t>(data));
+            file.close();
+            return bytes;
+        });
+        measure("Read ", maxPendingRequests, [&](opcua::FileTypeClient& file) {
+            file.open(opcua::OpenFileMode::Read);
+            const auto bytes = file.read([](opcua::Span<const uint8_t>) {});
+            file.close();
+            return bytes;
+        });
+    }
+
+    client.disconnect();
+    server.stop();
+    serverThread.join();
+    std::remove(path);
+}
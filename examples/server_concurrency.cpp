@@ -0,0 +1,68 @@
+// Measure the throughput of concurrent service calls on a server with 1 to 16 threads while the
+// server main loop is running. Requires open62541 built with UA_MULTITHREADING >= 100.
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <open62541pp/config.hpp>
+#include <open62541pp/node.hpp>
+#include <open62541pp/server.hpp>
+#include <open62541pp/services/attribute_highlevel.hpp>
+
+int main() {
+#if UAPP_HAS_CONCURRENT_SERVER
+    constexpr size_t maxThreads = 16;
+    constexpr auto duration = std::chrono::seconds(1);
+
+    opcua::Server server;
+    server.config().setLogger([](auto&&...) {});
+    opcua::Node objects(server, opcua::ObjectId::ObjectsFolder);
+    std::vector<opcua::NodeId> ids;
+    for (size_t i = 0; i < maxThreads; ++i) {
+        const opcua::NodeId id(1, "Variable." + std::to_string(i));
+        objects.addVariable(
+            id,
+            "Variable." + std::to_string(i),
+            opcua::VariableAttributes{}
+                .setAccessLevel(opcua::AccessLevel::CurrentRead | opcua::AccessLevel::CurrentWrite)
+                .setValueScalar(0)
+        );
+        ids.push_back(id);
+    }
+    auto serverThread = std::thread([&] { server.run(); });
+
+    for (size_t threadCount = 1; threadCount <= maxThreads; threadCount *= 2) {
+        std::atomic<bool> stop{false};
+        std::atomic<size_t> operations{0};
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < threadCount; ++i) {
+            threads.emplace_back([&, id = ids[i]] {
+                size_t count = 0;
+                for (int value = 0; !stop; ++value) {
+                    opcua::services::writeValue(server, id, opcua::Variant(value));
+                    opcua::services::readValue(server, id);
+                    count += 2;
+                }
+                operations += count;
+            });
+        }
+        std::this_thread::sleep_for(duration);
+        stop = true;
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const double seconds = std::chrono::duration<double>(duration).count();
+        std::cout << threadCount << " threads: " << static_cast<double>(operations) / seconds
+                  << " operations/s\n";
+    }
+
+    server.stop();
+    serverThread.join();
+#else
+    std::cout << "open62541 is not built with UA_MULTITHREADING >= 100\n";
+#endif
+}
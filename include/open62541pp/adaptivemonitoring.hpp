@@ -0,0 +1,172 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/common.hpp"  // AttributeId, MonitoringMode
+#include "open62541pp/config.hpp"
+#include "open62541pp/monitoreditem.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/subscription.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/types.hpp"  // IntegerId
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+class Client;
+
+/**
+ * Options of the AdaptiveMonitoringController.
+ */
+struct AdaptiveMonitoringOptions {
+    /// Interval in milliseconds to evaluate the overflows and notification rates.
+    double evaluationInterval = 5000.0;
+    /// Upper bound of the queue size.
+    uint32_t maxQueueSize = 1000;
+    /// Upper bound of the sampling interval in milliseconds.
+    double maxSamplingInterval = 10000.0;
+    /// Growth factor of the queue size per evaluation.
+    double queueGrowthFactor = 2.0;
+    /// Growth factor of the sampling interval per evaluation (if the queue size is at its bound).
+    double samplingRelaxFactor = 2.0;
+    /// Queue size headroom relative to the notifications per publishing interval.
+    double headroom = 1.5;
+    /// Maximum number of monitored items per ModifyMonitoredItems request.
+    /// `0` to read the operation limit `MaxMonitoredItemsPerCall` of the server.
+    uint32_t maxItemsPerCall = 0;
+};
+
+/**
+ * Adaptive queue size and sampling interval tuning of client monitored items.
+ *
+ * Data change notifications with the Overflow info bit indicate that the queue of a monitored item
+ * is too small and samples are lost. The controller tracks the overflows and notification rates
+ * per item. On each evaluation, the queues of overflowing items are grown to fit the notifications
+ * of a publishing interval (at least by AdaptiveMonitoringOptions::queueGrowthFactor). If the
+ * queue size reached its bound, the sampling interval is relaxed instead. The changes are sent
+ * with batched ModifyMonitoredItems requests, chunked by the operation limits of the server.
+ *
+ * Each decision is logged (info level) and returned by @ref update. The cumulative metrics are
+ * available via @ref metrics.
+ *
+ * @code
+ * opcua::AdaptiveMonitoringController controller(sub, 1000.0);
+ * controller.subscribeDataChange(id, opcua::AttributeId::Value, parameters, onDataChange);
+ * while (true) {
+ *     client.runIterate();
+ *     controller.update();
+ * }
+ * @endcode
+ *
+ * @note The class is not thread-safe. Call @ref update from the thread running the client event
+ *       loop, but not within callbacks (the ModifyMonitoredItems requests are synchronous).
+ */
+class AdaptiveMonitoringController {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Adjustment of a monitored item.
+    struct Decision {
+        IntegerId monitoredItemId;
+        uint32_t overflows;  ///< Overflows within the evaluation interval
+        double notificationRate;  ///< Notifications per second within the evaluation interval
+        uint32_t queueSize;  ///< Previous queue size
+        uint32_t revisedQueueSize;  ///< Queue size revised by the server
+        double samplingInterval;  ///< Previous sampling interval
+        double revisedSamplingInterval;  ///< Sampling interval revised by the server
+        StatusCode statusCode;  ///< Result of the modification
+    };
+
+    /// Cumulative metrics.
+    struct Metrics {
+        uint64_t notifications;
+        uint64_t overflows;
+        uint64_t evaluations;
+        uint64_t requests;  ///< ModifyMonitoredItems requests
+        uint64_t modifiedItems;  ///< Successfully modified monitored items
+        uint64_t failedItems;  ///< Failed modifications
+        uint64_t saturatedItems;  ///< Overflowing items with queue size and sampling at the bounds
+    };
+
+    /**
+     * @param subscription Subscription of the monitored items
+     * @param publishingInterval Publishing interval of the subscription in milliseconds
+     * @param options Bounds and tuning options
+     */
+    AdaptiveMonitoringController(
+        Subscription<Client> subscription,
+        double publishingInterval,
+        AdaptiveMonitoringOptions options = {}
+    );
+
+    AdaptiveMonitoringController(const AdaptiveMonitoringController&) = delete;
+    AdaptiveMonitoringController(AdaptiveMonitoringController&&) noexcept = delete;
+    AdaptiveMonitoringController& operator=(const AdaptiveMonitoringController&) = delete;
+    AdaptiveMonitoringController& operator=(AdaptiveMonitoringController&&) noexcept = delete;
+
+    /// Create a tracked monitored item for data change notifications.
+    /// @see Subscription::subscribeDataChange
+    MonitoredItem<Client> subscribeDataChange(
+        const NodeId& id,
+        AttributeId attribute,
+        const MonitoringParametersEx& parameters,
+        DataChangeNotificationCallback onDataChange
+    );
+
+    /// Track an existing monitored item.
+    /// The parameters are required to preserve the filter and discard policy on modifications.
+    void addItem(IntegerId monitoredItemId, const MonitoringParametersEx& parameters);
+
+    /// Stop tracking a monitored item.
+    void removeItem(IntegerId monitoredItemId);
+
+    /// Record a data change notification of a tracked monitored item.
+    void notify(IntegerId monitoredItemId, const DataValue& value);
+
+    /// Create a notification callback, which records the notifications and forwards them.
+    /// The controller must outlive the monitored items using the callback.
+    DataChangeNotificationCallback callback(DataChangeNotificationCallback onDataChange = {});
+
+    /**
+     * Evaluate the tracked items if the evaluation interval elapsed and modify overflowing items.
+     * @return Decisions of this evaluation (empty if the interval did not elapse yet)
+     */
+    std::vector<Decision> update(Clock::time_point now = Clock::now());
+
+    /// Get the current monitoring parameters of a tracked item.
+    const MonitoringParametersEx* parameters(IntegerId monitoredItemId) const noexcept;
+
+    /// Get the cumulative metrics.
+    const Metrics& metrics() const noexcept {
+        return metrics_;
+    }
+
+private:
+    struct Item {
+        MonitoringParametersEx parameters;
+        uint32_t notifications{0};
+        uint32_t overflows{0};
+    };
+
+    bool adjust(MonitoringParametersEx& parameters, double notificationRate) const;
+    void modify(Span<Decision> decisions, Span<const MonitoringParametersEx> parameters);
+    size_t maxItemsPerCall();
+
+    Subscription<Client> subscription_;
+    double publishingInterval_;
+    AdaptiveMonitoringOptions options_;
+    std::optional<size_t> maxItemsPerCall_;
+    std::unordered_map<IntegerId, Item> items_;
+    Clock::time_point lastEvaluation_;
+    Metrics metrics_{};
+};
+
+}  // namespace opcua
+
+#endif
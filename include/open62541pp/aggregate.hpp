@@ -0,0 +1,301 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/types.hpp"  // IntegerId
+
+namespace opcua {
+
+/**
+ * Incremental calculator for standard aggregates over a processing interval.
+ *
+ * Samples are processed in O(1) time and constant memory, no sample history is kept.
+ * The following aggregate functions (`ObjectId::AggregateFunction_*`) are supported:
+ * - `Average`, `Minimum`, `Maximum`, `Count`
+ * - `TimeAverage` (stepped, the last value of the previous interval is used as initial bound)
+ * - `StandardDeviationSample`, `StandardDeviationPopulation`
+ * - `VarianceSample`, `VariancePopulation`
+ *
+ * Values with a bad status code and non-numeric values are ignored.
+ *
+ * The calculator evaluates AggregateFilters of local (server-side) monitored items. Monitored items
+ * of remote clients with an AggregateFilter are not supported: open62541 rejects them and the
+ * wrapper has no hook into their creation.
+ *
+ * @code
+ * opcua::AggregateCalculator calc(opcua::DateTime::now());
+ * calc.add(dv1);
+ * calc.add(dv2);
+ * auto result = calc.result(opcua::ObjectId::AggregateFunction_Average, opcua::DateTime::now());
+ * calc.reset(opcua::DateTime::now());  // start next interval
+ * @endcode
+ *
+ * @see https://reference.opcfoundation.org/Core/Part13/v105/docs/5.4
+ */
+class AggregateCalculator {
+public:
+    AggregateCalculator() noexcept = default;
+
+    explicit AggregateCalculator(DateTime startTime) noexcept
+        : startTime_(startTime.get()) {}
+
+    /// Check if the aggregate function is supported.
+    static bool isSupported(const NodeId& aggregateType) noexcept;
+
+    /// Start a new processing interval.
+    /// The last value is kept as initial bound for the time-weighted average.
+    void reset(DateTime startTime) noexcept;
+
+    /// Add a numeric sample.
+    void add(double value, DateTime timestamp) noexcept;
+
+    /// Add a sample from a DataValue.
+    /// The source timestamp is used if available, then the server timestamp, then the current time.
+    /// @return `false` if the value was ignored (bad status or not a numeric scalar)
+    bool add(const DataValue& value) noexcept;
+
+    /// Start time of the current processing interval.
+    DateTime startTime() const noexcept {
+        return DateTime(startTime_);
+    }
+
+    /// Number of samples in the current processing interval.
+    uint32_t count() const noexcept {
+        return count_;
+    }
+
+    double sum() const noexcept {
+        return sum_;
+    }
+
+    double minimum() const noexcept {
+        return min_;
+    }
+
+    double maximum() const noexcept {
+        return max_;
+    }
+
+    double average() const noexcept {
+        return mean_;
+    }
+
+    double variancePopulation() const noexcept;
+    double varianceSample() const noexcept;
+    double standardDeviationPopulation() const noexcept;
+    double standardDeviationSample() const noexcept;
+
+    /// Stepped time-weighted average from the start of the interval until `endTime`.
+    /// Returns `std::nullopt` if no value is known in the interval.
+    std::optional<double> timeAverage(DateTime endTime) const noexcept;
+
+    /// Compute the result of the given aggregate function for the current processing interval.
+    /// The source timestamp of the result is the start time of the interval. The status code is
+    /// `BadNoData` if not enough samples are available and `BadAggregateNotSupported` if the
+    /// aggregate function is not supported.
+    DataValue result(const NodeId& aggregateType, DateTime endTime) const;
+
+private:
+    int64_t startTime_{0};
+    uint32_t count_{0};
+    double sum_{0.0};
+    double min_{0.0};
+    double max_{0.0};
+    double mean_{0.0};  // Welford's online algorithm
+    double m2_{0.0};
+    bool hasLast_{false};
+    double lastValue_{0.0};
+    int64_t lastTime_{0};
+    double weightedSum_{0.0};
+    int64_t weightedDuration_{0};
+};
+
+/**
+ * Client-side aggregation stage for data change notifications of many monitored items.
+ *
+ * Raw notifications are reduced to per-item statistics (count, minimum, maximum, mean, last value)
+ * over fixed intervals. Additionally, one representative point per item and interval is selected
+ * with the Largest-Triangle-Three-Buckets (LTTB) algorithm for downsampled plotting. The candidates
+ * of LTTB are limited to the first, minimum, maximum and last sample of each interval (MinMaxLTTB),
+ * so no samples are buffered.
+ *
+ * The statistics are stored in a flat structure-of-arrays table with one row per monitored item,
+ * identified by the pair of subscription id and monitored item id.
+ * Memory is only allocated when a new monitored item is added, not per sample.
+ * Whenever an interval elapsed, the batch callback is invoked. The column accessors (e.g.
+ * @ref monitoredItemIds, @ref means) can be used within the callback to read the batch.
+ * Intervals are skipped without a batch if the whole table is idle, i.e. neither the interval nor
+ * its predecessor contain samples.
+ *
+ * @code
+ * opcua::DataChangeAggregator aggregator(1000.0, [](const opcua::DataChangeAggregator& batch) {
+ *     for (size_t i = 0; i < batch.size(); ++i) {
+ *         std::cout << batch.subscriptionIds()[i] << "/" << batch.monitoredItemIds()[i] << ": "
+ *                   << batch.means()[i] << "\n";
+ *     }
+ * });
+ * sub.subscribeDataChange(id, opcua::AttributeId::Value, aggregator.callback());
+ * @endcode
+ *
+ * @note The class is not thread-safe. Notifications and @ref advance should be called from the
+ *       thread running the client event loop.
+ */
+class DataChangeAggregator {
+public:
+    using BatchCallback = std::function<void(const DataChangeAggregator& batch)>;
+
+    /**
+     * @param interval Length of the aggregation intervals in milliseconds
+     * @param onBatch Callback invoked with the results of each elapsed interval
+     * @param startTime Start of the first interval
+     */
+    DataChangeAggregator(
+        double interval, BatchCallback onBatch, DateTime startTime = DateTime::now()
+    );
+
+    /// Reserve table memory for the given number of monitored items.
+    void reserve(size_t size);
+
+    /// Add a monitored item to the table (optional, items are added with their first sample).
+    void addItem(IntegerId subscriptionId, IntegerId monitoredItemId);
+
+    /// Remove a monitored item from the table.
+    void removeItem(IntegerId subscriptionId, IntegerId monitoredItemId);
+
+    /// Add a numeric sample of a monitored item.
+    /// The sample is assigned to the current interval, call @ref advance before to close elapsed
+    /// intervals.
+    void add(IntegerId subscriptionId, IntegerId monitoredItemId, double value, DateTime timestamp);
+
+    /// Add a data change notification of a monitored item.
+    /// Elapsed intervals are closed first (based on the current time).
+    /// @return `false` if the value was ignored (bad status or not a numeric scalar)
+    bool add(IntegerId subscriptionId, IntegerId monitoredItemId, const DataValue& value);
+
+    /// Close all intervals that elapsed until `now` and invoke the batch callback for each.
+    /// Should be called periodically (e.g. after `Client::runIterate`) if notifications are rare.
+    void advance(DateTime now = DateTime::now());
+
+    /// Create a data change notification callback, e.g. for `Subscription::subscribeDataChange`.
+    /// The aggregator must outlive the monitored items using the callback.
+    std::function<void(IntegerId subId, IntegerId monId, const DataValue& value)> callback();
+
+    /// Start time of the current interval (or of the batch within the batch callback).
+    DateTime startTime() const noexcept {
+        return DateTime(startTime_);
+    }
+
+    /// End time of the current interval (or of the batch within the batch callback).
+    DateTime endTime() const noexcept {
+        return DateTime(startTime_ + interval_);
+    }
+
+    /// Number of monitored items (rows) in the table.
+    size_t size() const noexcept {
+        return ids_.size();
+    }
+
+    Span<const IntegerId> subscriptionIds() const noexcept {
+        return subscriptionIds_;
+    }
+
+    Span<const IntegerId> monitoredItemIds() const noexcept {
+        return ids_;
+    }
+
+    /// Number of samples in the interval.
+    Span<const uint32_t> counts() const noexcept {
+        return counts_;
+    }
+
+    /// Minimum of the interval, `NaN` if the interval has no samples.
+    Span<const double> minimums() const noexcept {
+        return minimums_;
+    }
+
+    /// Maximum of the interval, `NaN` if the interval has no samples.
+    Span<const double> maximums() const noexcept {
+        return maximums_;
+    }
+
+    /// Mean of the interval, `NaN` if the interval has no samples.
+    Span<const double> means() const noexcept {
+        return means_;
+    }
+
+    /// Last known value (might be from a previous interval), `NaN` if no sample was received yet.
+    Span<const double> lastValues() const noexcept {
+        return lastValues_;
+    }
+
+    /// Timestamp of the last known value.
+    Span<const DateTime> lastTimestamps() const noexcept {
+        return lastTimestamps_;
+    }
+
+    /// Value of the LTTB point selected for the preceding interval.
+    /// The selection requires the following interval, so the points lag behind by one interval.
+    /// `NaN` if the preceding interval has no samples.
+    Span<const double> downsampledValues() const noexcept {
+        return downsampledValues_;
+    }
+
+    /// Timestamp of the LTTB point selected for the preceding interval.
+    Span<const DateTime> downsampledTimestamps() const noexcept {
+        return downsampledTimestamps_;
+    }
+
+private:
+    struct Point {
+        int64_t time{0};
+        double value{0.0};
+    };
+
+    static uint64_t rowKey(IntegerId subscriptionId, IntegerId monitoredItemId) noexcept {
+        return (uint64_t{subscriptionId} << 32U) | monitoredItemId;
+    }
+
+    size_t findOrAddItem(IntegerId subscriptionId, IntegerId monitoredItemId);
+    void closeInterval();
+
+    int64_t interval_;
+    int64_t startTime_;
+    BatchCallback onBatch_;
+    std::unordered_map<uint64_t, size_t> rows_;  // rowKey -> row
+    size_t sampleCount_{0};  // samples of the current interval
+    size_t pendingCount_{0};  // rows with LTTB candidates
+
+    // results
+    std::vector<IntegerId> subscriptionIds_;
+    std::vector<IntegerId> ids_;
+    std::vector<uint32_t> counts_;
+    std::vector<double> minimums_;
+    std::vector<double> maximums_;
+    std::vector<double> means_;
+    std::vector<double> lastValues_;
+    std::vector<DateTime> lastTimestamps_;
+    std::vector<double> downsampledValues_;
+    std::vector<DateTime> downsampledTimestamps_;
+
+    // state of the current interval
+    std::vector<double> sums_;
+    std::vector<double> sumTimes_;  // relative to the interval start
+    std::vector<Point> firsts_;
+    std::vector<int64_t> minimumTimes_;
+    std::vector<int64_t> maximumTimes_;
+
+    // state of the preceding interval for LTTB
+    std::vector<std::array<Point, 4>> candidates_;
+    std::vector<uint32_t> candidateCounts_;
+    std::vector<Point> selected_;
+    std::vector<uint8_t> hasSelected_;
+};
+
+}  // namespace opcua
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>  // remove_const_t
+
+#include "open62541pp/span.hpp"
+#include "open62541pp/typeregistry.hpp"  // getDataType
+#include "open62541pp/types.hpp"
+
+namespace opcua {
+
+class Client;
+
+/**
+ * Options of the ArrayStream.
+ */
+struct ArrayStreamOptions {
+    /// Maximum encoded size of a slice in bytes.
+    /// If `0`, the slices are sized to the receive (read) or send (write) buffer size of the
+    /// client connection, i.e. a single message chunk per slice.
+    size_t maxSliceBytes = 0;
+    /// Number of pipelined requests.
+    size_t maxPendingRequests = 4;
+    /// Timeout of a single client iteration while waiting for responses (in ms).
+    uint16_t iterateTimeout = 100;
+    /// Progress callback with the number of transferred elements (in sequence, including the
+    /// resumption offset) and the total number of elements (`0` if unknown).
+    std::function<void(size_t transferred, size_t total)> onProgress;
+};
+
+/**
+ * Result of an ArrayStream transfer.
+ */
+struct ArrayStreamResult {
+    /// Status code of the transfer, the first bad status code of a slice.
+    StatusCode status;
+    /// Index after the last element transferred in sequence.
+    /// A failed transfer can be resumed from this index.
+    size_t end;
+};
+
+/// Chunk callback of ArrayStream::read with the array index of the first element of the chunk.
+using ArrayChunkCallback = std::function<void(size_t offset, Variant& chunk)>;
+
+/**
+ * Streaming reads and writes of large one-dimensional array variables.
+ *
+ * Reading or writing a large array in a single request exceeds the message size limits of the
+ * connection and blocks the channel for the whole transfer. The array stream splits the transfer
+ * into slices with a NumericRange (index range) sized to the buffer size of the connection. The
+ * slices are pipelined with asynchronous Read/Write requests.
+ *
+ * Read slices are either delivered as a stream of chunks in sequence or assembled directly into a
+ * caller-provided contiguous buffer. Write slices reference the caller-provided buffer without
+ * copying. The size of read slices is estimated from the encoded size of the first element;
+ * slices rejected as too large are split and the slice size is reduced for subsequent requests.
+ *
+ * Transfers return the index after the last element transferred in sequence. If a transfer
+ * fails, e.g. due to a connection loss, it can be resumed from this index.
+ *
+ * @code
+ * opcua::ArrayStream stream(client, id);
+ * std::vector<double> buffer(stream.size());
+ * auto result = stream.readInto(opcua::Span(buffer));
+ * while (result.status.isBad()) {
+ *     // reconnect...
+ *     result = stream.readInto(opcua::Span(buffer), result.end);
+ * }
+ * @endcode
+ *
+ * @note The transfers run the client's main loop until all slices are completed.
+ *       The class is not thread-safe. The client must outlive the array stream.
+ */
+class ArrayStream {
+public:
+    ArrayStream(Client& client, NodeId id, ArrayStreamOptions options = {});
+
+    /// Get the number of elements from the ArrayDimensions attribute, `0` if unknown.
+    /// @exception BadStatus If the ArrayDimensions attribute can't be read
+    size_t size();
+
+    /**
+     * Read the array as a stream of chunks in sequence.
+     * The end of the array is detected by the ArrayDimensions attribute or the first slice with
+     * fewer elements than requested.
+     * @param onChunk Callback for each chunk, the chunk can be moved
+     * @param offset Index of the first element to read
+     */
+    ArrayStreamResult read(const ArrayChunkCallback& onChunk, size_t offset = 0);
+
+    /**
+     * Read the array into a contiguous buffer.
+     * The buffer represents the elements with index `0` to `buffer.size() - 1`, the elements
+     * `offset` to `buffer.size() - 1` are read. Elements beyond the buffer size are not read.
+     * @param buffer Buffer with native elements of the array's data type, e.g. `double`
+     * @param offset Index of the first element to read
+     */
+    template <typename T>
+    ArrayStreamResult readInto(Span<T> buffer, size_t offset = 0) {
+        return readInto(buffer.data(), buffer.size(), opcua::getDataType<T>(), offset);
+    }
+
+    /**
+     * Write a contiguous buffer to the array.
+     * The buffer represents the elements with index `0` to `data.size() - 1`, the elements
+     * `offset` to `data.size() - 1` are written. The array must have at least the size of the
+     * buffer.
+     * @param data Buffer with native elements of the array's data type, e.g. `double`
+     * @param offset Index of the first element to write
+     */
+    template <typename T>
+    ArrayStreamResult write(Span<T> data, size_t offset = 0) {
+        return write(
+            data.data(), data.size(), opcua::getDataType<std::remove_const_t<T>>(), offset
+        );
+    }
+
+private:
+    struct Operation;
+
+    ArrayStreamResult readInto(void* buffer, size_t size, const UA_DataType& type, size_t offset);
+    ArrayStreamResult readSlices(
+        const std::shared_ptr<Operation>& operation,
+        const UA_DataType* type,
+        size_t size,
+        size_t offset
+    );
+    ArrayStreamResult write(const void* data, size_t size, const UA_DataType& type, size_t offset);
+    ArrayStreamResult run(Operation& operation);
+    size_t sliceBudget(size_t bufferSize) const noexcept;
+
+    Client& client_;
+    NodeId id_;
+    ArrayStreamOptions options_;
+};
+
+}  // namespace opcua
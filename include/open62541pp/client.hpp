@@ -1,11 +1,12 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <string_view>
-#include <utility>  // move
+#include <utility>  // forward, move
 #include <vector>
 
 #include "open62541pp/config.hpp"
@@ -14,6 +15,7 @@
 #include "open62541pp/detail/open62541/client.h"
 #include "open62541pp/span.hpp"
 #include "open62541pp/subscription.hpp"
+#include "open62541pp/timer.hpp"
 #include "open62541pp/types.hpp"
 #include "open62541pp/ua/types.hpp"
 #include "open62541pp/wrapper.hpp"
@@ -265,6 +267,47 @@ public:
     }
 #endif
 
+    /**
+     * Schedule a repeated callback in the main loop of the client.
+     * Timers with equal intervals are coalesced and executed in the same wakeup of the main loop.
+     * Execution statistics including overruns (invocations taking longer than the interval) are
+     * available with Client::timerStatistics.
+     * @param interval Interval of the callback
+     * @param callback Callable with signature `void()`, move-only callables are allowed
+     * @return Timer identifier to cancel the timer
+     * @exception BadStatus If the timer can't be added to the main loop
+     * @note Timers are executed within the thread of the main loop. If open62541 is built with
+     *       `UA_MULTITHREADING >= 100` (`UAPP_HAS_CONCURRENT_SERVER`), timers may be
+     *       scheduled/cancelled from any thread, otherwise only within the thread of the main loop.
+     */
+    template <typename Callback>
+    TimerId schedule(std::chrono::milliseconds interval, Callback&& callback) {
+        return addTimer(
+            interval, false, detail::makeTimerCallback(std::forward<Callback>(callback))
+        );
+    }
+
+    /**
+     * Schedule a one-shot callback in the main loop of the client.
+     * The timer is removed after its execution.
+     * @param delay Delay until the execution of the callback
+     * @param callback Callable with signature `void()`, move-only callables are allowed
+     * @return Timer identifier to cancel the timer
+     * @exception BadStatus If the timer can't be added to the main loop
+     */
+    template <typename Callback>
+    TimerId scheduleOnce(std::chrono::milliseconds delay, Callback&& callback) {
+        return addTimer(delay, true, detail::makeTimerCallback(std::forward<Callback>(callback)));
+    }
+
+    /// Cancel a timer.
+    /// @return `false` if the timer doesn't exist (anymore)
+    bool cancelTimer(TimerId id);
+
+    /// Get the execution statistics of a timer.
+    /// @exception BadStatus (BadNotFound) If the timer doesn't exist (anymore)
+    TimerStatistics timerStatistics(TimerId id) const;
+
     /**
      * Run a single iteration of the client's main loop.
      * Listen on the network and process arriving asynchronous responses in the background.
@@ -294,6 +337,8 @@ private:
 
     friend detail::ClientContext& detail::getContext(Client& client) noexcept;
 
+    TimerId addTimer(std::chrono::milliseconds interval, bool once, TimerCallback&& callback);
+
     struct Deleter {
         void operator()(UA_Client* client) noexcept;
     };
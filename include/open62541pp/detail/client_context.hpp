@@ -13,6 +13,7 @@
 #include "open62541pp/detail/contextmap.hpp"
 #include "open62541pp/detail/exceptioncatcher.hpp"
 #include "open62541pp/detail/open62541/client.h"  // UA_SessionState, UA_SecureChannelState
+#include "open62541pp/detail/timer_registry.hpp"
 #include "open62541pp/services/detail/monitoreditem_context.hpp"
 #include "open62541pp/services/detail/subscription_context.hpp"
 #include "open62541pp/ua/types.hpp"  // IntegerId
@@ -45,6 +46,7 @@ struct ClientContext {
 #endif
     std::array<std::function<void()>, clientStateCount> stateCallbacks;
     std::function<void()> inactivityCallback;
+    TimerRegistry timers;
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
     using SubId = IntegerId;
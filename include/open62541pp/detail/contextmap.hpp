@@ -5,6 +5,7 @@
 #include <memory>
 #include <mutex>
 #include <type_traits>
+#include <utility>  // as_const
 
 namespace opcua::detail {
 
@@ -58,18 +59,19 @@ public:
     }
 
     size_t eraseStale() {
-        const size_t count = map_.size();
+        size_t count = 0;
         if constexpr (IsStaleable<Item>::value) {
             auto lock = acquireLock();
             for (auto it = map_.begin(); it != map_.end();) {
                 if (it->second->stale) {
                     it = map_.erase(it);
+                    ++count;
                 } else {
                     ++it;
                 }
             }
         }
-        return count - map_.size();
+        return count;
     }
 
     bool contains(Key key) const {
@@ -86,6 +88,10 @@ public:
         return nullptr;
     }
 
+    Item* find(Key key) {
+        return const_cast<Item*>(std::as_const(*this).find(key));  // NOLINT(*-const-cast)
+    }
+
     template <typename F>
     void iterate(F&& func) const {  // NOLINT(cppcoreguidelines-missing-std-forward)
         auto lock = acquireLock();
@@ -1,7 +1,9 @@
 #pragma once
 
+#include <atomic>
 #include <exception>
 #include <functional>
+#include <mutex>
 #include <utility>  // exchange, move
 
 namespace opcua::detail {
@@ -9,20 +11,35 @@ namespace opcua::detail {
 /**
  * Catch & store exceptions from user-defined callbacks in an exception-unaware context (open62541).
  * The stored exception can be rethrown in a different context.
+ *
+ * Callbacks might be invoked by multiple threads concurrently, e.g. by the server main loop and by
+ * service calls of other threads. The exception is stored in a single, synchronized slot and
+ * rethrown by the main loop, regardless of the thread that invoked the callback.
  */
 class ExceptionCatcher {
 public:
     void setException(std::exception_ptr exception) noexcept {
+        const std::lock_guard lock(mutex_);
+        hasException_ = exception != nullptr;
         exception_ = std::move(exception);
     }
 
     bool hasException() const noexcept {
-        return exception_ != nullptr;
+        return hasException_;
     }
 
     void rethrow() {
-        if (hasException()) {
-            std::rethrow_exception(std::exchange(exception_, nullptr));
+        if (!hasException_) {
+            return;  // fast path without locking
+        }
+        std::exception_ptr exception;
+        {
+            const std::lock_guard lock(mutex_);
+            exception = std::exchange(exception_, nullptr);
+            hasException_ = false;
+        }
+        if (exception != nullptr) {
+            std::rethrow_exception(exception);
         }
     }
 
@@ -58,6 +75,8 @@ public:
 
 private:
     std::exception_ptr exception_;
+    std::atomic<bool> hasException_{false};
+    std::mutex mutex_;
 };
 
 }  // namespace opcua::detail
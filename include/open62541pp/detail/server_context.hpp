@@ -1,10 +1,12 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
-#include <set>
-#include <utility>  // pair
+#include <utility>  // move, pair
 #include <vector>
 
 #include "open62541pp/config.hpp"
@@ -12,26 +14,74 @@
 #include "open62541pp/detail/contextmap.hpp"
 #include "open62541pp/detail/exceptioncatcher.hpp"
 #include "open62541pp/detail/open62541/common.h"  // UA_AccessControl
+#include "open62541pp/detail/session_context.hpp"
+#include "open62541pp/detail/timer_registry.hpp"
 #include "open62541pp/plugin/nodestore.hpp"
 #include "open62541pp/services/detail/monitoreditem_context.hpp"
+#include "open62541pp/session.hpp"  // SessionStatistics
 #include "open62541pp/types.hpp"  // NodeId, Variant
-#include "open62541pp/ua/types.hpp"  // IntegerId
+#include "open62541pp/ua/types.hpp"  // IntegerId, CallMethodRequest
 
 namespace opcua::detail {
 
+/**
+ * Callback that can be replaced while it is invoked by other threads.
+ * Invocations hold a reference to the loaded callback, a replaced callback stays valid until all
+ * running invocations returned.
+ */
+template <typename T>
+class SharedCallback {
+public:
+    void store(T callback) {
+        std::atomic_store(&callback_, std::make_shared<const T>(std::move(callback)));
+    }
+
+    std::shared_ptr<const T> load() const noexcept {
+        return std::atomic_load(&callback_);
+    }
+
+private:
+    std::shared_ptr<const T> callback_;
+};
+
 struct NodeContext {
-    ValueCallback valueCallback;
-    ValueBackendDataSource dataSource;
+    SharedCallback<ValueCallback> valueCallback;
+    SharedCallback<ValueBackendDataSource> dataSource;
 #ifdef UA_ENABLE_METHODCALLS
-    std::function<void(Span<const Variant> input, Span<Variant> output)> methodCallback;
+    SharedCallback<std::function<void(Span<const Variant> input, Span<Variant> output)>>
+        methodCallback;
+    // preferred over methodCallback, for components tracking the calling sessions
+    SharedCallback<std::function<
+        void(const NodeId& sessionId, Span<const Variant> input, Span<Variant> output)>>
+        sessionMethodCallback;
+#endif
+#if UAPP_HAS_ASYNC_METHODS
+    // calls of async method nodes from client sessions, returns false if the call is not taken
+    // over, otherwise the operation must be answered with UA_Server_setAsyncOperationResult
+    SharedCallback<std::function<bool(const CallMethodRequest& request, void* operation)>>
+        asyncMethodCallback;
 #endif
+    // native value callbacks (valueCallbackOnRead/valueCallbackOnWrite) set by the wrapper
+    std::atomic<bool> valueCallbackInstalled{false};
+    // hash of the value and status written by services::writeDataValueIfChanged, replaced by the
+    // onWrite value callback on every write of the value (0 if the current value is unknown)
+    std::atomic<size_t> writtenValueHash{0};
 };
 
+/// Hash of the value written by services::writeDataValueIfChanged in the calling thread, taken by
+/// the onWrite value callback of the written node.
+inline thread_local size_t pendingWrittenValueHash = 0;
+
 struct SessionRegistry {
-    decltype(UA_AccessControl::activateSession) activateSessionUser{nullptr};
-    decltype(UA_AccessControl::closeSession) closeSessionUser{nullptr};
-    std::set<NodeId> sessionIds;
+    UA_AccessControl accessControlUser{};  // user-defined callbacks wrapped by the server
+    std::map<NodeId, SessionContext> sessions;  // active sessions and their context slots
+    std::atomic<bool> userSessionContext{false};  // session context used by access control plugin
     std::mutex mutex;
+
+    // server diagnostics of the sessions, refreshed by the server loop if enabled
+    std::map<NodeId, SessionStatistics> diagnostics;
+    std::atomic<bool> diagnosticsEnabled{false};
+    int64_t diagnosticsRefreshTime{0};  // monotonic, only accessed by the server loop
 };
 
 /**
@@ -54,6 +104,7 @@ struct ServerContext {
 #endif
 
     ContextMap<NodeId, NodeContext> nodeContexts;
+    TimerRegistry timers;
 };
 
 }  // namespace opcua::detail
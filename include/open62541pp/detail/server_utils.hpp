@@ -3,10 +3,12 @@
 #include "open62541pp/detail/open62541/server.h"
 
 namespace opcua {
+class NodeId;
 class Server;
 
 namespace detail {
 class ExceptionCatcher;
+struct NodeContext;
 struct ServerContext;
 }  // namespace detail
 }  // namespace opcua
@@ -21,4 +23,8 @@ ExceptionCatcher* getExceptionCatcher(UA_Server* server) noexcept;
 ExceptionCatcher& getExceptionCatcher(Server& server) noexcept;
 UA_Server* getHandle(Server& server) noexcept;
 
+/// Set the node context and the native value callbacks of a variable node (once).
+/// @exception BadStatus If the node doesn't exist or isn't a variable node
+NodeContext& installValueCallback(Server& server, const NodeId& id);
+
 }  // namespace opcua::detail
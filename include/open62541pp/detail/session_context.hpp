@@ -0,0 +1,116 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>  // exchange, forward, move
+#include <vector>
+
+namespace opcua::detail {
+
+/// Access control checks counted in the session statistics.
+enum class SessionAccessCheck : uint8_t {
+    Attribute,
+    Method,
+    Browse,
+    NodeManagement,
+};
+
+/// Lock-free session counters, updated in the access control callbacks.
+struct SessionCounters {
+    std::array<std::atomic<uint64_t>, 4> accessChecks{};
+    std::atomic<int64_t> lastAccessCheck{0};  // UA_DateTime
+
+    void add(SessionAccessCheck check, int64_t time) noexcept {
+        auto& counter = accessChecks[static_cast<size_t>(check)];  // NOLINT
+        counter.fetch_add(1, std::memory_order_relaxed);
+        lastAccessCheck.store(time, std::memory_order_relaxed);
+    }
+
+    uint64_t get(SessionAccessCheck check) const noexcept {
+        const auto& counter = accessChecks[static_cast<size_t>(check)];  // NOLINT
+        return counter.load(std::memory_order_relaxed);
+    }
+};
+
+inline std::atomic<size_t> sessionContextSlotCount{0};
+
+/// Get the unique slot index of a context type.
+template <typename T>
+size_t getSessionContextSlot() noexcept {
+    static const size_t index = sessionContextSlotCount++;
+    return index;
+}
+
+/**
+ * Typed context slots and statistics of a session.
+ * Each type is assigned to a unique slot index, so lookups are a single vector access (guarded by
+ * the mutex of the session).
+ * The context objects are shared, they are destroyed with the session unless still referenced.
+ */
+class SessionContext {
+public:
+    SessionCounters& counters() noexcept {
+        return counters_;
+    }
+
+    const SessionCounters& counters() const noexcept {
+        return counters_;
+    }
+
+    template <typename T>
+    std::shared_ptr<T> find() const {
+        const size_t index = getSessionContextSlot<T>();
+        const std::lock_guard lock(mutex_);
+        return index < slots_.size() ? std::static_pointer_cast<T>(slots_[index]) : nullptr;
+    }
+
+    template <typename T, typename... Args>
+    std::shared_ptr<T> emplace(Args&&... args) {
+        auto value = std::make_shared<T>(std::forward<Args>(args)...);
+        std::shared_ptr<void> previous;  // destroy outside of the lock
+        const std::lock_guard lock(mutex_);
+        previous = std::exchange(slot<T>(), value);
+        return value;
+    }
+
+    /// Get the context object or emplace a default-constructed one.
+    template <typename T>
+    std::shared_ptr<T> findOrEmplace() {
+        const std::lock_guard lock(mutex_);
+        auto& value = slot<T>();
+        if (value == nullptr) {
+            value = std::make_shared<T>();
+        }
+        return std::static_pointer_cast<T>(value);
+    }
+
+    template <typename T>
+    void erase() {
+        const size_t index = getSessionContextSlot<T>();
+        std::shared_ptr<void> value;  // destroy outside of the lock
+        const std::lock_guard lock(mutex_);
+        if (index < slots_.size()) {
+            value = std::move(slots_[index]);
+        }
+    }
+
+private:
+    template <typename T>
+    std::shared_ptr<void>& slot() {
+        const size_t index = getSessionContextSlot<T>();
+        if (index >= slots_.size()) {
+            slots_.resize(index + 1);
+        }
+        return slots_[index];
+    }
+
+    mutable std::mutex mutex_;
+    std::vector<std::shared_ptr<void>> slots_;
+    SessionCounters counters_;
+};
+
+}  // namespace opcua::detail
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/detail/exceptioncatcher.hpp"
+#include "open62541pp/timer.hpp"
+
+namespace opcua::detail {
+
+/**
+ * Registry of timers executed by the event loop of a server or client.
+ *
+ * Repeated timers with equal intervals are coalesced into a single native repeated callback, so the
+ * event loop wakes up only once per period for all of them. One-shot timers use a dedicated native
+ * callback each. The native callbacks are added and removed by the caller-provided functions, the
+ * native callbacks have to forward to TimerRegistry::process with the data pointer.
+ *
+ * The registry is thread-safe. The data pointer of a native callback identifies its slot and is
+ * resolved under the lock, so a native callback that fires concurrently to the removal of its slot
+ * is a no-op. Native callbacks are added/removed and timer callbacks are executed without holding
+ * the lock.
+ */
+class TimerRegistry {
+public:
+    using NativeId = uint64_t;
+
+    /// Add a native callback with the data pointer.
+    /// @exception BadStatus If the native callback can't be added
+    using AddNative = std::function<NativeId(void* data, double interval, bool once)>;
+    /// Remove a native callback.
+    using RemoveNative = std::function<void(NativeId nativeId)>;
+
+    /// Add a timer, the interval of repeated timers must be positive.
+    /// @exception BadStatus If the interval is invalid or the native callback can't be added
+    TimerId add(
+        double interval,
+        bool once,
+        TimerCallback&& callback,
+        const AddNative& addNative,
+        const RemoveNative& removeNative
+    );
+    /// Remove a timer, the native callback is removed with the last timer of the slot.
+    bool remove(TimerId id, const RemoveNative& removeNative);
+    std::optional<TimerStatistics> statistics(TimerId id) const;
+
+    /// Number of native callbacks.
+    size_t slotCount() const {
+        const std::lock_guard lock(mutex_);
+        return slots_.size();
+    }
+
+    /// Execute all timers of a slot, called by the native callback with its data pointer.
+    /// One-shot timers are removed afterwards with @p removeNative.
+    void process(void* data, ExceptionCatcher& catcher, const RemoveNative& removeNative);
+
+private:
+    using SlotId = uint64_t;
+
+    struct Slot {
+        double interval;  // ms
+        bool once;
+        std::optional<NativeId> nativeId;  // empty until the native callback is added
+        std::vector<TimerId> timers;
+    };
+
+    struct Timer {
+        std::shared_ptr<TimerCallback> callback;
+        SlotId slot;
+        TimerStatistics statistics{};
+    };
+
+    void eraseSlot(SlotId slotId);
+
+    std::unordered_map<TimerId, Timer> timers_;
+    std::unordered_map<SlotId, Slot> slots_;
+    std::map<double, SlotId> groups_;  // slots of repeated timers by interval
+    TimerId nextTimerId_{1};
+    SlotId nextSlotId_{1};
+    mutable std::mutex mutex_;
+};
+
+}  // namespace opcua::detail
@@ -5,6 +5,7 @@
 #include <cstring>  // memcpy, memset
 #include <memory>
 #include <new>  // bad_alloc
+#include <optional>
 
 #include "open62541pp/detail/open62541/common.h"
 #include "open62541pp/detail/traits.hpp"  // IsOneOf
@@ -199,4 +200,60 @@ void resizeArray(T*& array, size_t& size, size_t newSize, const UA_DataType& typ
     size = newSize;
 }
 
+/* --------------------------------------- Deep comparison -------------------------------------- */
+
+/**
+ * Deep comparison of two values of the given data type.
+ * Pointer-free values without padding bytes are compared with `memcmp` (also arrays of them),
+ * strings, variants and structures are compared member-wise using the member descriptions of the
+ * data type. Floating point values are compared bitwise.
+ */
+bool isEqual(const void* lhs, const void* rhs, const UA_DataType& type) noexcept;
+
+/// Deep comparison of two arrays of the given data type.
+bool isEqualArray(const void* lhs, const void* rhs, size_t size, const UA_DataType& type) noexcept;
+
+/// Hash of a value of the given data type, consistent with isEqual.
+size_t hash(const void* data, const UA_DataType& type) noexcept;
+
+/// Hash of an array of the given data type, consistent with isEqualArray.
+size_t hashArray(const void* data, size_t size, const UA_DataType& type) noexcept;
+
+/* --------------------------------------- Numeric scalars -------------------------------------- */
+
+/// Get the value of a numeric scalar variant (Boolean, integer or floating point types) as double.
+/// Returns `std::nullopt` if the variant is not a numeric scalar.
+inline std::optional<double> toDouble(const UA_Variant& var) noexcept {
+    if (var.type == nullptr || var.arrayLength != 0 ||
+        var.data <= UA_EMPTY_ARRAY_SENTINEL) {  // NOLINT
+        return std::nullopt;
+    }
+    switch (var.type->typeKind) {
+    case UA_DATATYPEKIND_BOOLEAN:
+        return *static_cast<const UA_Boolean*>(var.data) ? 1.0 : 0.0;
+    case UA_DATATYPEKIND_SBYTE:
+        return static_cast<double>(*static_cast<const UA_SByte*>(var.data));
+    case UA_DATATYPEKIND_BYTE:
+        return static_cast<double>(*static_cast<const UA_Byte*>(var.data));
+    case UA_DATATYPEKIND_INT16:
+        return static_cast<double>(*static_cast<const UA_Int16*>(var.data));
+    case UA_DATATYPEKIND_UINT16:
+        return static_cast<double>(*static_cast<const UA_UInt16*>(var.data));
+    case UA_DATATYPEKIND_INT32:
+        return static_cast<double>(*static_cast<const UA_Int32*>(var.data));
+    case UA_DATATYPEKIND_UINT32:
+        return static_cast<double>(*static_cast<const UA_UInt32*>(var.data));
+    case UA_DATATYPEKIND_INT64:
+        return static_cast<double>(*static_cast<const UA_Int64*>(var.data));
+    case UA_DATATYPEKIND_UINT64:
+        return static_cast<double>(*static_cast<const UA_UInt64*>(var.data));
+    case UA_DATATYPEKIND_FLOAT:
+        return static_cast<double>(*static_cast<const UA_Float*>(var.data));
+    case UA_DATATYPEKIND_DOUBLE:
+        return *static_cast<const UA_Double*>(var.data);
+    default:
+        return std::nullopt;
+    }
+}
+
 }  // namespace opcua::detail
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/types.hpp"
+
+namespace opcua {
+
+class Client;
+
+/* ------------------------------------------ Discovery ----------------------------------------- */
+
+/// Options for the concurrent discovery of many servers.
+struct DiscoveryOptions {
+    /// Maximum number of targets queried at the same time.
+    size_t maxConcurrency = 16;
+    /// Deadline per target in milliseconds (for all requests of the target).
+    uint32_t timeout = 5000;
+    /// Request the registered servers with the `FindServers` service.
+    bool findServers = true;
+    /// Request the endpoints with the `GetEndpoints` service.
+    bool getEndpoints = true;
+};
+
+/// Discovery result of a single target.
+struct DiscoveryResult {
+    std::string serverUrl;
+    /// Status of the first failed request (e.g. `BadTimeout`) or `Good`.
+    StatusCode status;
+    std::vector<ApplicationDescription> servers;
+    std::vector<EndpointDescription> endpoints;
+};
+
+/**
+ * Query `FindServers` and `GetEndpoints` of many servers concurrently.
+ *
+ * The targets are processed by a bounded pool of worker threads. Each worker uses its own
+ * short-lived Client per target, the clients don't share any state. Errors of single targets don't
+ * abort the discovery but are reported with DiscoveryResult::status.
+ *
+ * @param serverUrls Server URLs (for example `opc.tcp://localhost:4840`)
+ * @param options Discovery options
+ * @return Results in the order of `serverUrls`
+ */
+std::vector<DiscoveryResult> discover(
+    Span<const std::string> serverUrls, const DiscoveryOptions& options = {}
+);
+
+/**
+ * Asynchronously query `FindServers` and `GetEndpoints` of many servers concurrently.
+ * The discovery is run in a background thread owned by the returned future, the destructor of the
+ * future waits for the discovery to finish.
+ * @copydetails discover
+ */
+std::future<std::vector<DiscoveryResult>> discoverAsync(
+    std::vector<std::string> serverUrls, const DiscoveryOptions& options = {}
+);
+
+/* --------------------------------------- Connection storm ------------------------------------- */
+
+/// Options to connect many clients.
+struct ConnectOptions {
+    /// Maximum number of connection attempts in progress at the same time.
+    size_t maxConcurrency = 32;
+    /// Maximum number of connection attempts per client.
+    size_t maxAttempts = 5;
+    /// Timeout of a single connection attempt.
+    std::chrono::milliseconds timeout{5000};
+    /// Backoff before the second attempt, doubled with each further attempt.
+    std::chrono::milliseconds initialBackoff{100};
+    /// Upper bound of the backoff.
+    std::chrono::milliseconds maxBackoff{10000};
+    /// Random fraction of the backoff (0 to 1) to spread the retries of many clients.
+    double jitter = 0.5;
+};
+
+/**
+ * Connect many clients (e.g. to a fleet of devices) and activate their sessions.
+ *
+ * All connections are established asynchronously and driven by the calling thread, so the clients
+ * must not be used by other threads in the meantime. Failed attempts are retried with an
+ * exponential backoff with random jitter to avoid reconnection storms after outages.
+ *
+ * @param clients Clients to connect
+ * @param endpointUrls Endpoint URL per client or a single endpoint URL for all clients
+ * @param options Connection options
+ * @return Final status per client, `Good` if the session was activated
+ * @exception std::invalid_argument If the number of endpoint URLs is neither 1 nor the number of
+ *            clients
+ */
+std::vector<StatusCode> connectClients(
+    Span<Client* const> clients,
+    Span<const std::string> endpointUrls,
+    const ConnectOptions& options = {}
+);
+
+}  // namespace opcua
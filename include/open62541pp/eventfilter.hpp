@@ -0,0 +1,266 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/detail/traits.hpp"  // IsOptional
+#include "open62541pp/exception.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/typeregistry.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+#include "open62541pp/ua/types.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+/**
+ * Compiled EventFilter for client-side evaluation of the where clause.
+ *
+ * Some servers ignore the where clause of event filters. The where clause can then be evaluated
+ * with the received event fields instead. The ContentFilter is compiled once, the operands are
+ * resolved to indices of the event fields (select clauses) or literals. SimpleAttributeOperands of
+ * the where clause, that are not part of the select clauses, are appended to the select clauses.
+ *
+ * Supported filter operators: `Equals`, `IsNull`, `GreaterThan`, `LessThan`,
+ * `GreaterThanOrEqual`, `LessThanOrEqual`, `Like`, `Not`, `Between`, `InList`, `And`, `Or`,
+ * `OfType`. Numeric values are compared by value, independent of the numeric data type.
+ * The type hierarchy is unknown client-side, so `OfType` only matches the exact `EventType` (or
+ * any event for `BaseEventType`).
+ *
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/7.7
+ */
+class EventFilterEvaluator {
+public:
+    /// Create an evaluator with an empty where clause (all events pass).
+    EventFilterEvaluator() = default;
+
+    /// Compile the event filter.
+    /// @exception BadStatus (`BadFilterOperatorUnsupported`, `BadFilterOperandInvalid`,
+    ///            `BadFilterOperandCountMismatch`) if the where clause can not be evaluated
+    explicit EventFilterEvaluator(const EventFilter& filter);
+
+    /// Event filter with all required select clauses.
+    const EventFilter& filter() const noexcept {
+        return filter_;
+    }
+
+    /// Evaluate the where clause with the received event fields.
+    /// Missing event fields evaluate to null.
+    bool evaluate(Span<const Variant> eventFields) const noexcept;
+
+private:
+    enum class OperandKind : uint8_t { Element, Literal, Field };
+
+    struct Operand {
+        OperandKind kind;
+        size_t index;
+    };
+
+    struct Element {
+        FilterOperator filterOperator;
+        std::vector<Operand> operands;
+    };
+
+    class OperandValue;
+
+    bool evaluateElement(size_t index, Span<const Variant> eventFields) const noexcept;
+    void resolve(
+        const Operand& operand, Span<const Variant> eventFields, OperandValue& value
+    ) const noexcept;
+
+    EventFilter filter_;
+    std::vector<Element> elements_;
+    std::vector<Variant> literals_;
+};
+
+namespace detail {
+
+/// Decode an event field into a member of the user-defined event struct.
+/// `std::string_view` members reference the String or LocalizedText text of the event field
+/// without copy.
+template <typename T>
+bool decodeEventField(const Variant& field, T& dst) {
+    if constexpr (std::is_same_v<T, const Variant*>) {
+        dst = &field;
+        return true;
+    } else if constexpr (std::is_same_v<T, Variant>) {
+        dst = field;
+        return true;
+    } else if constexpr (IsOptional<T>::value) {
+        if (field.empty()) {
+            dst.reset();
+            return true;
+        }
+        return decodeEventField(field, dst.emplace());
+    } else if constexpr (std::is_same_v<T, std::string_view>) {
+        if (field.isScalar() && field.isType<String>()) {
+            dst = static_cast<const String*>(field.data())->get();
+            return true;
+        }
+        if (field.isScalar() && field.isType<LocalizedText>()) {
+            dst = static_cast<const LocalizedText*>(field.data())->text();
+            return true;
+        }
+        dst = {};
+        return field.empty();
+    } else if constexpr (isRegisteredType<T>) {
+        if (field.isScalar() && field.isType<T>()) {
+            dst = *static_cast<const T*>(field.data());
+            return true;
+        }
+        return field.empty();
+    } else {
+        if (field.empty()) {
+            return true;
+        }
+        try {
+            dst = field.to<T>();
+            return true;
+        } catch (const BadVariantAccess&) {
+            return false;
+        }
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Typed decoder for event notifications.
+ * Created by EventFilterBuilder::build.
+ * @tparam T User-defined event struct
+ */
+template <typename T>
+class EventDecoder {
+public:
+    using FieldDecoder = std::function<bool(const Variant& field, T& event)>;
+
+    EventDecoder(EventFilterEvaluator evaluator, std::vector<FieldDecoder> fields)
+        : evaluator_(std::move(evaluator)),
+          fields_(std::move(fields)) {}
+
+    /// Event filter to create the monitored item, e.g. with `Subscription::subscribeEvent`.
+    const EventFilter& filter() const noexcept {
+        return evaluator_.filter();
+    }
+
+    /// Evaluate the where clause client-side.
+    bool matches(Span<const Variant> eventFields) const noexcept {
+        return evaluator_.evaluate(eventFields);
+    }
+
+    /// Decode event fields into the event struct.
+    /// String views of the event struct are only valid as long as the event fields.
+    /// @return `false` if any event field is missing or has a mismatching type
+    bool decode(Span<const Variant> eventFields, T& event) const {
+        if (eventFields.size() < fields_.size()) {
+            return false;
+        }
+        bool ok = true;
+        for (size_t i = 0; i < fields_.size(); ++i) {
+            ok &= fields_[i](eventFields[i], event);
+        }
+        return ok;
+    }
+
+    /**
+     * Create an event notification callback that decodes the event fields.
+     * Events with mismatching event fields are dropped.
+     * @param onEvent Callback invoked with the decoded event
+     * @param evaluateWhereClause Drop events that don't match the where clause (client-side)
+     */
+    template <typename F>
+    auto callback(F onEvent, bool evaluateWhereClause = false) const {
+        return [decoder = *this, onEvent = std::move(onEvent), evaluateWhereClause](
+                   IntegerId subId, IntegerId monId, Span<const Variant> eventFields
+               ) {
+            if (evaluateWhereClause && !decoder.matches(eventFields)) {
+                return;
+            }
+            T event{};
+            if (decoder.decode(eventFields, event)) {
+                std::invoke(onEvent, subId, monId, event);
+            }
+        };
+    }
+
+private:
+    EventFilterEvaluator evaluator_;
+    std::vector<FieldDecoder> fields_;
+};
+
+/**
+ * Builder for event filters with typed decoding of the event fields into a user-defined struct.
+ *
+ * @code
+ * struct MyEvent {
+ *     opcua::DateTime time;
+ *     uint16_t severity{};
+ *     std::string_view message;  // zero-copy
+ * };
+ *
+ * const auto decoder = opcua::EventFilterBuilder<MyEvent>()
+ *     .select({0, "Time"}, &MyEvent::time)
+ *     .select({0, "Severity"}, &MyEvent::severity)
+ *     .select({0, "Message"}, &MyEvent::message)
+ *     .where(opcua::ContentFilter{...})
+ *     .build();
+ *
+ * sub.subscribeEvent(opcua::ObjectId::Server, decoder.filter(), decoder.callback(
+ *     [](opcua::IntegerId subId, opcua::IntegerId monId, const MyEvent& event) { ... }
+ * ));
+ * @endcode
+ *
+ * @tparam T User-defined event struct (default-constructible)
+ */
+template <typename T>
+class EventFilterBuilder {
+public:
+    explicit EventFilterBuilder(NodeId eventType = ObjectTypeId::BaseEventType)
+        : eventType_(std::move(eventType)) {}
+
+    /// Select an event field of the event type and map it to a member of the event struct.
+    template <typename M>
+    EventFilterBuilder& select(const QualifiedName& fieldName, M T::*member) {
+        return select(Span<const QualifiedName>{&fieldName, 1}, member);
+    }
+
+    /// Select an event field by browse path and map it to a member of the event struct.
+    template <typename M>
+    EventFilterBuilder& select(Span<const QualifiedName> browsePath, M T::*member) {
+        selectClauses_.emplace_back(eventType_, browsePath, AttributeId::Value);
+        fields_.emplace_back([member](const Variant& field, T& event) {
+            return detail::decodeEventField(field, event.*member);
+        });
+        return *this;
+    }
+
+    /// Set the where clause.
+    EventFilterBuilder& where(ContentFilter whereClause) {
+        whereClause_ = std::move(whereClause);
+        return *this;
+    }
+
+    /// Compile the event filter and decoder.
+    /// @exception BadStatus If the where clause can not be compiled (see EventFilterEvaluator)
+    EventDecoder<T> build() const {
+        return {EventFilterEvaluator(EventFilter(selectClauses_, whereClause_)), fields_};
+    }
+
+private:
+    NodeId eventType_;
+    std::vector<SimpleAttributeOperand> selectClauses_;
+    std::vector<typename EventDecoder<T>::FieldDecoder> fields_;
+    ContentFilter whereClause_;
+};
+
+}  // namespace opcua
+
+#endif
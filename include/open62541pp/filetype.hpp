@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>  // true_type
+
+#include "open62541pp/bitmask.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"
+
+#ifdef UA_ENABLE_METHODCALLS
+
+namespace opcua {
+
+class Client;
+class Server;
+
+/**
+ * File open mode of the FileType Open method.
+ * @see https://reference.opcfoundation.org/Core/Part20/v105/docs/4.2.2
+ */
+enum class OpenFileMode : uint8_t {
+    // clang-format off
+    Read          = 1U << 0U,
+    Write         = 1U << 1U,
+    EraseExisting = 1U << 2U,
+    Append        = 1U << 3U,
+    // clang-format on
+};
+
+template <>
+struct IsBitmaskEnum<OpenFileMode> : std::true_type {};
+
+/**
+ * Options of the FileTypeClient.
+ */
+struct FileTypeClientOptions {
+    /// Number of bytes per Read/Write method call.
+    size_t chunkSize = 65536;
+    /// Number of pipelined Read/Write method calls.
+    size_t maxPendingRequests = 4;
+    /// Timeout of a single client iteration while waiting for responses (in ms).
+    uint16_t iterateTimeout = 100;
+};
+
+/// Sink of FileTypeClient::read for the received data.
+using FileSink = std::function<void(Span<const uint8_t> data)>;
+/// Source of FileTypeClient::write, fills the buffer and returns the number of bytes (0 at EOF).
+using FileSource = std::function<size_t(Span<uint8_t> buffer)>;
+
+/**
+ * Client of FileType objects.
+ *
+ * The file is transferred in chunks with the Read and Write methods of the FileType object.
+ * Instead of one chunk per round trip, multiple Read/Write method calls are pipelined. The
+ * methods operate on the file position of the handle, so the calls are sent in sequence and
+ * rely on the in-order processing of requests within a session.
+ *
+ * Files are streamed to/from `std::ostream`/`std::istream` or any sink/source, e.g. a file
+ * descriptor:
+ * @code
+ * opcua::FileTypeClient file(client, fileId);
+ * file.open(opcua::OpenFileMode::Read);
+ * file.read([&](opcua::Span<const uint8_t> data) { ::write(fd, data.data(), data.size()); });
+ * file.close();
+ * @endcode
+ *
+ * @note The class is not thread-safe. The client must outlive the FileType client.
+ * @see https://reference.opcfoundation.org/Core/Part20/v105/docs/4.2
+ */
+class FileTypeClient {
+public:
+    /// Resolve the methods of the FileType object.
+    /// @exception BadStatus If the object has no FileType methods
+    FileTypeClient(Client& client, NodeId fileId, FileTypeClientOptions options = {});
+
+    /// Close the file if open, errors are ignored.
+    ~FileTypeClient();
+
+    FileTypeClient(const FileTypeClient&) = delete;
+    FileTypeClient(FileTypeClient&&) noexcept = delete;
+    FileTypeClient& operator=(const FileTypeClient&) = delete;
+    FileTypeClient& operator=(FileTypeClient&&) noexcept = delete;
+
+    /// Open the file.
+    /// @exception BadStatus If the file can't be opened or is already open by this client
+    void open(Bitmask<OpenFileMode> mode);
+
+    /// Close the file.
+    /// @exception BadStatus If the file can't be closed
+    void close();
+
+    /// Check if the file is opened by this client.
+    bool isOpen() const noexcept {
+        return handle_.has_value();
+    }
+
+    /// Get the size of the file in bytes (Size property).
+    uint64_t size();
+
+    /// Get the current position of the file handle.
+    uint64_t position();
+
+    /// Set the position of the file handle.
+    void setPosition(uint64_t position);
+
+    /// Read from the current position until the end of the file.
+    /// @return Number of bytes read
+    /// @exception BadStatus If a Read method call fails
+    uint64_t read(const FileSink& sink);
+
+    /// @overload
+    uint64_t read(std::ostream& stream);
+
+    /// Write all data of the source at the current position.
+    /// @return Number of bytes written
+    /// @exception BadStatus If a Write method call fails
+    uint64_t write(const FileSource& source);
+
+    /// @overload
+    uint64_t write(std::istream& stream);
+
+    /// @overload
+    uint64_t write(Span<const uint8_t> data);
+
+private:
+    struct Transfer;
+
+    uint32_t checkedHandle() const;
+    Variant call(const NodeId& methodId, Span<const Variant> input);
+    void run(Transfer& transfer);
+
+    Client& client_;
+    NodeId fileId_;
+    FileTypeClientOptions options_;
+    NodeId openId_;
+    NodeId closeId_;
+    NodeId readId_;
+    NodeId writeId_;
+    NodeId getPositionId_;
+    NodeId setPositionId_;
+    NodeId sizeId_;
+    std::optional<uint32_t> handle_;
+};
+
+/**
+ * Add a FileType object backed by a file to the server.
+ *
+ * The object implements the FileType methods Open, Close, Read, Write, GetPosition and
+ * SetPosition and the properties Size, Writable, UserWritable and OpenCount. Multiple handles can
+ * read the file at the same time, the reads are served from a read-only memory mapping of the
+ * file. A handle with write access requires exclusive access to the file, written data is buffered
+ * and flushed on Close. The properties Size and OpenCount are computed on read.
+ *
+ * File handles are bound to the session that opened them, calls with handles of other sessions
+ * fail with `BadInvalidArgument`. The handles of a session are released when the session is
+ * closed.
+ *
+ * @param server Server
+ * @param parentId Parent node
+ * @param id Requested NodeId of the FileType object
+ * @param browseName Browse name
+ * @param path Path of the backing file, created by an Open call with write access if not existing
+ * @param writable Allow Open calls with write access
+ * @return NodeId of the FileType object
+ * @exception BadStatus If the object can't be added
+ */
+NodeId addFileObject(
+    Server& server,
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    std::string path,
+    bool writable = true
+);
+
+}  // namespace opcua
+
+#endif
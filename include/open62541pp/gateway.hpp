@@ -0,0 +1,168 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/services/subscription.hpp"  // SubscriptionParameters
+#include "open62541pp/types.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+class Client;
+class Server;
+
+namespace detail {
+struct GatewayState;
+}  // namespace detail
+
+/**
+ * Options of the GatewayMount.
+ */
+struct GatewayOptions {
+    /// Namespace of the mounted nodes on the gateway server.
+    std::string namespaceUri = "urn:open62541pp:gateway";
+    /// Number of levels of the downstream subtree browsed on mount.
+    /// Deeper levels are browsed on demand with GatewayMount::expand.
+    size_t maxDepth = 1;
+    /// Sampling interval in milliseconds of the monitored items feeding the value caches.
+    double samplingInterval = 250.0;
+    /// Parameters of the downstream subscription.
+    SubscriptionParameters subscriptionParameters{};
+    /// Timeout of forwarded method calls waiting in the method callback for the result.
+    std::chrono::milliseconds callTimeout{5000};
+    /// Timeout of forwarded writes waiting in the data source for the result.
+    std::chrono::milliseconds writeTimeout{5000};
+    /// Make the mounted methods async method nodes if open62541 supports them
+    /// (`UAPP_HAS_ASYNC_METHODS`), so calls of client sessions don't block the server loop.
+    /// The mounts then take all pending async operations of the gateway server on dispatch and call
+    /// async method nodes of other origin synchronously. Only enable it if the gateway server has
+    /// no other async method nodes.
+    bool asyncMethods = false;
+};
+
+/**
+ * Statistics of the GatewayMount.
+ */
+struct GatewayStatistics {
+    size_t mountedNodes;  ///< Mounted objects, variables and methods
+    uint64_t notifications;  ///< Data change notifications from the downstream server
+    uint64_t reads;  ///< Reads served from the value caches
+    uint64_t cacheMisses;  ///< Reads without cached values
+    uint64_t forwardedWrites;  ///< Writes forwarded to the downstream server
+    uint64_t failedWrites;  ///< Writes rejected by the downstream server, failed or timed out
+    uint64_t forwardedCalls;  ///< Method calls forwarded to the downstream server
+    uint64_t failedCalls;  ///< Method calls failed or timed out
+};
+
+/**
+ * Mount of a downstream server subtree on a gateway server.
+ *
+ * The objects, variables and methods of the downstream subtree below `remoteRoot` are mirrored
+ * below a local folder of the gateway server. The subtree is browsed level by level, up to
+ * GatewayOptions::maxDepth levels on mount and further levels on demand with @ref expand. The
+ * browse results are cached as mounted nodes.
+ *
+ * - Reads of mounted variables are served from value caches, fed by a single subscription on the
+ *   downstream server. The notification values are copied once into the caches, each read copies
+ *   the cached value once into the read response.
+ * - The mounted variables mirror the DataType (if defined in namespace zero), ValueRank and the
+ *   current read/write access of the downstream variables, limited to the user access of the
+ *   downstream session.
+ * - Writes of mounted variables are queued and forwarded in batched Write requests. The data
+ *   source waits for the result of the downstream server up to GatewayOptions::writeTimeout, so
+ *   the writing session gets the actual result.
+ * - Method calls are queued and forwarded asynchronously. The method callback waits for the result
+ *   up to GatewayOptions::callTimeout. With GatewayOptions::asyncMethods, calls of client sessions
+ *   are answered once the forwarded result arrives, without blocking the server loop.
+ *
+ * The queued writes and method calls are sent by @ref dispatch (or @ref runIterate) in the thread
+ * running the downstream client. The gateway server and the downstream client must run in
+ * different threads, otherwise waiting writes and method calls fail with `BadTimeout`. While they
+ * wait, writes and method calls of client sessions block the gateway server loop (except method
+ * calls with GatewayOptions::asyncMethods).
+ *
+ * @code
+ * opcua::GatewayMount plc1(gateway, client1, "PLC1", opcua::ObjectId::ObjectsFolder,
+ *                          opcua::ObjectId::ObjectsFolder);
+ * while (true) {
+ *     plc1.runIterate(100);  // server runs in another thread
+ * }
+ * @endcode
+ *
+ * @note Mount and @ref expand modify the address space of the gateway server and send synchronous
+ *       requests to the downstream server. Don't run the gateway server or the downstream client
+ *       concurrently in other threads meanwhile.
+ */
+class GatewayMount {
+public:
+    /**
+     * Mount a downstream subtree.
+     * @param server Gateway server
+     * @param downstream Client connected to the downstream server
+     * @param name Name of the mount, used as browse name of the mount folder and NodeId prefix
+     * @param remoteRoot Root node of the downstream subtree
+     * @param localFolder Local parent node of the mount folder
+     * @param options Gateway options
+     */
+    GatewayMount(
+        Server& server,
+        Client& downstream,
+        std::string_view name,
+        const NodeId& remoteRoot,
+        const NodeId& localFolder,
+        GatewayOptions options = {}
+    );
+
+    /// Delete the mounted nodes and the downstream subscription.
+    ~GatewayMount();
+
+    GatewayMount(const GatewayMount&) = delete;
+    GatewayMount(GatewayMount&&) noexcept = delete;
+    GatewayMount& operator=(const GatewayMount&) = delete;
+    GatewayMount& operator=(GatewayMount&&) noexcept = delete;
+
+    /// Get the local node of the mount folder.
+    const NodeId& mountId() const noexcept;
+
+    /// Get the local node of a downstream node (mounted or not).
+    NodeId localId(const NodeId& remoteId) const;
+
+    /// Get the downstream node of a mounted node.
+    std::optional<NodeId> remoteId(const NodeId& localId) const;
+
+    /**
+     * Browse the children of a mounted node (if not browsed yet) and mount them.
+     * @return Number of mounted nodes
+     * @exception BadStatus (BadNodeIdUnknown) If the node is not mounted
+     */
+    size_t expand(const NodeId& localId);
+
+    /**
+     * Send the queued writes and method calls to the downstream server.
+     * With GatewayOptions::asyncMethods, the pending calls of all async method nodes of the
+     * gateway server are taken first and handed over to their mounts. Calls of async method nodes
+     * of other origin are invoked synchronously by this function.
+     */
+    void dispatch();
+
+    /// Dispatch the queued requests and run a single iteration of the downstream client.
+    void runIterate(uint16_t timeoutMilliseconds = 1000);
+
+    /// Get the gateway statistics.
+    GatewayStatistics statistics() const;
+
+private:
+    std::shared_ptr<detail::GatewayState> state_;
+};
+
+}  // namespace opcua
+
+#endif
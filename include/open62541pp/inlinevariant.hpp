@@ -0,0 +1,187 @@
+#pragma once
+
+#include <cstddef>  // byte, max_align_t
+#include <cstring>  // memcpy
+#include <type_traits>
+#include <utility>  // exchange
+
+#include "open62541pp/detail/open62541/common.h"
+#include "open62541pp/exception.hpp"
+#include "open62541pp/typeregistry.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/wrapper.hpp"  // asWrapper
+
+namespace opcua {
+
+/**
+ * Variant with inline storage for small pointer-free scalars.
+ *
+ * A Variant always stores its value on the heap, because it must keep the exact memory layout of
+ * UA_Variant (wrappers are pointer-interconvertible and arrays of Variants are passed to
+ * open62541). InlineVariant extends the native variant with a small buffer. Pointer-free scalars
+ * (e.g. `int32_t`, `double`, `DateTime`, `Guid`) up to @ref capacity bytes are stored within the
+ * buffer, the native variant references the buffer with `UA_VARIANT_DATA_NODELETE`. Other values
+ * are stored on the heap like in a Variant.
+ *
+ * This saves an allocation per value, e.g. in `std::vector<InlineVariant>` workloads. The value
+ * can be passed to functions expecting a Variant or UA_Variant via @ref variant. The referenced
+ * storage is only valid as long as the InlineVariant is alive and not moved, so don't move the
+ * value out of the Variant reference (use @ref toVariant for an owning copy).
+ */
+class InlineVariant {
+public:
+    /// Maximum size of scalars stored inline.
+    static constexpr size_t capacity = 16;
+
+    InlineVariant() noexcept = default;
+
+    /// Create from a scalar/array (copy).
+    template <
+        typename T,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, InlineVariant>>>
+    explicit InlineVariant(const T& value) {
+        assign(value);
+    }
+
+    InlineVariant(const InlineVariant& other) {
+        assign(other.variant());
+    }
+
+    InlineVariant(InlineVariant&& other) noexcept {
+        moveFrom(other);
+    }
+
+    InlineVariant& operator=(const InlineVariant& other) {
+        if (this != &other) {
+            assign(other.variant());
+        }
+        return *this;
+    }
+
+    InlineVariant& operator=(InlineVariant&& other) noexcept {
+        if (this != &other) {
+            clear();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    ~InlineVariant() {
+        clear();
+    }
+
+    /// Assign a Variant (copy).
+    /// Pointer-free scalars up to @ref capacity bytes are stored inline.
+    void assign(const Variant& value) {
+        if (fitsInline(value.type()) && value.isScalar()) {
+            setInline(value.data(), *value.type());
+            return;
+        }
+        Variant copy(value);
+        clear();
+        native_ = std::exchange(asNative(copy), UA_Variant{});
+    }
+
+    /// Assign a scalar/array (copy and convert if required).
+    /// @see Variant::assign(const T&)
+    template <typename T>
+    void assign(const T& value) {
+        if constexpr (std::is_same_v<T, Variant>) {
+            assign(static_cast<const Variant&>(value));
+        } else if constexpr (detail::isRegisteredType<T> && sizeof(T) <= capacity) {
+            const auto& type = opcua::getDataType<T>();
+            if (fitsInline(&type)) {
+                setInline(&value, type);
+                return;
+            }
+            assign(Variant(value));
+        } else {
+            assign(Variant(value));
+        }
+    }
+
+    template <
+        typename T,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<T>, InlineVariant>>>
+    InlineVariant& operator=(const T& value) {
+        assign(value);
+        return *this;
+    }
+
+    /// Clear the value.
+    void clear() noexcept {
+        if (!isInline()) {
+            UA_Variant_clear(&native_);
+        }
+        native_ = {};
+    }
+
+    /// Check if the variant is empty.
+    bool empty() const noexcept {
+        return native_.type == nullptr;
+    }
+
+    /// Check if the value is stored inline.
+    bool isInline() const noexcept {
+        return native_.data == static_cast<const void*>(buffer_);
+    }
+
+    /// Get a reference to the value as Variant.
+    /// @warning Don't move the value out of the Variant, the inline storage would dangle.
+    Variant& variant() noexcept {
+        return asWrapper<Variant>(native_);
+    }
+
+    /// @copydoc variant
+    const Variant& variant() const noexcept {
+        return asWrapper<Variant>(native_);
+    }
+
+    operator const Variant&() const noexcept {  // NOLINT(hicpp-explicit-conversions)
+        return variant();
+    }
+
+    /// Create an owning copy of the value.
+    Variant toVariant() const {
+        return Variant(variant());
+    }
+
+    /// Convert the value to the specified type.
+    /// @see Variant::to
+    template <typename T>
+    [[nodiscard]] T to() const {
+        return variant().to<T>();
+    }
+
+private:
+    static bool fitsInline(const UA_DataType* type) noexcept {
+        return type != nullptr && type->pointerFree && type->memSize <= capacity;
+    }
+
+    void setInline(const void* data, const UA_DataType& type) noexcept {
+        if (data == buffer_) {
+            return;  // self-assignment
+        }
+        clear();
+        std::memcpy(buffer_, data, type.memSize);
+        native_.type = &type;
+        native_.storageType = UA_VARIANT_DATA_NODELETE;
+        native_.data = buffer_;
+    }
+
+    void moveFrom(InlineVariant& other) noexcept {
+        if (other.isInline()) {
+            std::memcpy(buffer_, other.buffer_, capacity);
+            native_ = other.native_;
+            native_.data = buffer_;
+        } else {
+            native_ = other.native_;
+        }
+        other.native_ = {};
+    }
+
+    UA_Variant native_{};
+    alignas(std::max_align_t) std::byte buffer_[capacity]{};  // NOLINT(*-avoid-c-arrays)
+};
+
+}  // namespace opcua
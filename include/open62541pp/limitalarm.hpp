@@ -0,0 +1,175 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/event.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+namespace opcua {
+
+class Server;
+
+/**
+ * State of an exclusive limit alarm.
+ * The states are ordered by the value range, the sign denotes the direction of the limit violation.
+ * @see https://reference.opcfoundation.org/Core/Part9/v105/docs/5.8.12
+ */
+enum class LimitState : int8_t {
+    // clang-format off
+    LowLow   = -2,
+    Low      = -1,
+    Normal   = 0,
+    High     = 1,
+    HighHigh = 2,
+    // clang-format on
+};
+
+/// Get the name of the limit state, e.g. `"HighHigh"`.
+std::string_view getLimitStateName(LimitState state) noexcept;
+
+/**
+ * Limits of an exclusive limit alarm.
+ * Unused limits can be left at their default value (infinity).
+ * The deadband is applied when returning to a less severe state (hysteresis): a limit is only
+ * left if the value crosses the limit by more than the deadband.
+ */
+struct LimitAlarmLimits {
+    double highHigh = std::numeric_limits<double>::infinity();
+    double high = std::numeric_limits<double>::infinity();
+    double low = -std::numeric_limits<double>::infinity();
+    double lowLow = -std::numeric_limits<double>::infinity();
+    double deadband = 0.0;
+};
+
+/**
+ * Evaluation engine for many exclusive limit alarms (HiHi/Hi/Lo/LoLo).
+ *
+ * The limits, deadbands and states of all alarms are stored in a structure-of-arrays table. Batches
+ * of updated values are evaluated with a branch-free loop over the table columns, that can be
+ * vectorized by the compiler. Events are only emitted on state transitions: The event properties
+ * `SourceNode`, `SourceName`, `Time`, `Severity` and `Message` are written to a single event
+ * instance, that is reused for all transitions, and triggered on the origin node.
+ *
+ * @code
+ * opcua::LimitAlarmEngine engine(server);
+ * const size_t alarm = engine.add({1, 1000}, "Temperature", {100.0, 80.0, 10.0, 0.0, 2.0});
+ * engine.update(alarm, 85.0);  // emits event "Temperature: High"
+ * @endcode
+ *
+ * Limit alarms are modeled as plain events of the given event type, no condition instances (with
+ * acknowledgement and confirmation state machines) are created in the address space.
+ *
+ * @note The class is not thread-safe.
+ */
+class LimitAlarmEngine {
+public:
+    /// Callback invoked on state transitions (before the event is triggered).
+    using TransitionCallback =
+        std::function<void(size_t alarm, LimitState from, LimitState to, double value)>;
+
+    /**
+     * @param connection Server instance
+     * @param originId Origin node of the emitted events (requires `EventNotifier` attribute)
+     * @param eventType Type of the emitted events
+     */
+    explicit LimitAlarmEngine(
+        Server& connection,
+        NodeId originId = ObjectId::Server,
+        const NodeId& eventType = ObjectTypeId::BaseEventType
+    );
+
+    /// Reserve table memory for the given number of alarms.
+    void reserve(size_t size);
+
+    /**
+     * Add a limit alarm.
+     * @param sourceNode Node that is monitored by the alarm (e.g. the variable node)
+     * @param sourceName Name of the source used in the event `SourceName` and `Message`
+     * @param limits Alarm limits
+     * @return Index of the alarm within the table
+     */
+    size_t add(
+        const NodeId& sourceNode, std::string_view sourceName, const LimitAlarmLimits& limits
+    );
+
+    /// Change the limits of an alarm. The state is evaluated again with the next update.
+    /// @exception std::out_of_range If the alarm index is out of range
+    void setLimits(size_t alarm, const LimitAlarmLimits& limits);
+
+    /// Set the event severity of a state (default: 900 for HighHigh/LowLow, 500 for High/Low and
+    /// 100 for the return to Normal).
+    void setSeverity(LimitState state, uint16_t severity) noexcept;
+
+    /// Set the callback invoked on state transitions.
+    void setTransitionCallback(TransitionCallback callback) {
+        onTransition_ = std::move(callback);
+    }
+
+    /// Number of alarms.
+    size_t size() const noexcept {
+        return sourceNodes_.size();
+    }
+
+    /// Current state of an alarm.
+    LimitState state(size_t alarm) const noexcept {
+        return static_cast<LimitState>(states_[alarm]);
+    }
+
+    /// Evaluate a single updated value.
+    /// `NaN` values are ignored and keep the current state.
+    /// @exception BadStatus If the event can not be triggered
+    void update(size_t alarm, double value, DateTime time = DateTime::now());
+
+    /// Evaluate a batch of updated values of the given alarms.
+    /// Each alarm should be part of the batch only once.
+    /// @exception BadStatus If an event can not be triggered
+    /// @exception std::invalid_argument If the sizes of `alarms` and `values` differ
+    /// @exception std::out_of_range If an alarm index is out of range
+    void update(
+        Span<const size_t> alarms, Span<const double> values, DateTime time = DateTime::now()
+    );
+
+    /// Evaluate updated values of all alarms, `values[i]` is the value of alarm `i`.
+    /// @exception BadStatus If an event can not be triggered
+    /// @exception std::invalid_argument If the size of `values` differs from the number of alarms
+    void updateAll(Span<const double> values, DateTime time = DateTime::now());
+
+private:
+    void emitTransition(size_t alarm, LimitState from, double value, DateTime time);
+
+    NodeId originId_;
+    Event event_;
+    TransitionCallback onTransition_;
+    std::array<uint16_t, 5> severities_{900, 500, 100, 500, 900};
+
+    // table columns
+    std::vector<NodeId> sourceNodes_;
+    std::vector<std::string> sourceNames_;
+    std::vector<double> highHighs_;
+    std::vector<double> highs_;
+    std::vector<double> lows_;
+    std::vector<double> lowLows_;
+    std::vector<double> deadbands_;
+    std::vector<int8_t> states_;
+
+    // scratch buffers for batch evaluation
+    std::array<std::vector<double>, 5> gathered_;  // limits and deadbands of the batch
+    std::vector<int8_t> gatheredStates_;
+    std::vector<int8_t> newStates_;
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+#include "open62541pp/common.hpp"  // MonitoringMode
+#include "open62541pp/config.hpp"
+#include "open62541pp/monitoreditem.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/subscription.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/types.hpp"  // IntegerId, MonitoredItemModifyResult
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+class Client;
+
+/**
+ * Group of client monitored items for bulk operations.
+ *
+ * MonitoredItem::setMonitoringMode and MonitoredItem::setMonitoringParameters send one request per
+ * item. The group operations send all items with as few requests as possible. The items are
+ * chunked by the operation limit `MaxMonitoredItemsPerCall` of the server and all chunks are sent
+ * at once (pipelined), so the whole group is processed within a single round trip.
+ *
+ * The results are returned in the order of @ref monitoredItemIds.
+ *
+ * @note The client event loop is run until all responses are received. Don't call the group
+ *       operations within callbacks or while the client event loop runs in another thread.
+ */
+class MonitoredItemGroup {
+public:
+    /**
+     * @param subscription Subscription of the monitored items
+     * @param monitoredItemIds Initial monitored items of the group
+     * @param maxItemsPerCall Maximum number of monitored items per request,
+     *        `0` to read the operation limit `MaxMonitoredItemsPerCall` of the server
+     */
+    explicit MonitoredItemGroup(
+        Subscription<Client> subscription,
+        Span<const IntegerId> monitoredItemIds = {},
+        size_t maxItemsPerCall = 0
+    );
+
+    /// Get the subscription of the monitored items.
+    Subscription<Client>& subscription() noexcept {
+        return subscription_;
+    }
+
+    /// Get the monitored item identifiers of the group.
+    Span<const IntegerId> monitoredItemIds() const noexcept {
+        return ids_;
+    }
+
+    /// Number of monitored items in the group.
+    size_t size() const noexcept {
+        return ids_.size();
+    }
+
+    /// Check if the group is empty.
+    bool empty() const noexcept {
+        return ids_.empty();
+    }
+
+    /// Add a monitored item to the group.
+    void add(IntegerId monitoredItemId);
+    /// Add a monitored item to the group.
+    void add(const MonitoredItem<Client>& monitoredItem);
+    /// Add monitored items to the group.
+    void add(Span<const IntegerId> monitoredItemIds);
+
+    /// Remove a monitored item from the group (without deleting it).
+    void remove(IntegerId monitoredItemId);
+
+    /// Set the monitoring mode of all monitored items.
+    /// @return Status code per monitored item
+    std::vector<StatusCode> setMonitoringMode(MonitoringMode monitoringMode);
+
+    /// Modify the monitoring parameters of all monitored items.
+    /// @return Modify result per monitored item
+    std::vector<MonitoredItemModifyResult> modify(const MonitoringParametersEx& parameters);
+
+    /// Delete all monitored items.
+    /// Deleted items are removed from the group.
+    /// @return Status code per monitored item
+    std::vector<StatusCode> deleteMonitoredItems();
+
+private:
+    size_t maxItemsPerCall();
+
+    Subscription<Client> subscription_;
+    std::vector<IntegerId> ids_;  // in insertion order for the requests
+    std::unordered_set<IntegerId> members_;  // membership checks in constant time
+    std::optional<size_t> maxItemsPerCall_;
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/common.hpp"  // AttributeId
+#include "open62541pp/config.hpp"
+#include "open62541pp/services/monitoreditem.hpp"  // MonitoringParametersEx
+#include "open62541pp/services/subscription.hpp"  // SubscriptionParameters
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/types.hpp"  // IntegerId
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+class Client;
+
+/**
+ * Reference-counted multiplexer of data change monitored items within a single subscription.
+ *
+ * Independent components of an application often monitor the same nodes. The multiplexer shares a
+ * single server-side monitored item between all local subscribers with identical requests, i.e.
+ * the same node, attribute and monitoring parameters (sampling interval, filter, queue size,
+ * discard policy and timestamps). The notifications are fanned out to the callbacks of all
+ * subscribers. The server-side monitored item is deleted when the last subscriber unsubscribes.
+ *
+ * Subscribers joining an existing monitored item receive the last notified value immediately,
+ * like the initial notification of a new monitored item.
+ *
+ * @code
+ * opcua::MonitoredItemMultiplexer mux(client);
+ * const auto a = mux.subscribeDataChange(id, opcua::AttributeId::Value, {}, onChangeA);
+ * const auto b = mux.subscribeDataChange(id, opcua::AttributeId::Value, {}, onChangeB);
+ * // single monitored item on the server
+ * @endcode
+ *
+ * @note The class is not thread-safe. The client must outlive the multiplexer.
+ */
+class MonitoredItemMultiplexer {
+public:
+    /// Create the shared subscription.
+    /// @exception BadStatus If the subscription can't be created
+    explicit MonitoredItemMultiplexer(
+        Client& client, const SubscriptionParameters& parameters = {}
+    );
+
+    /// Delete the shared subscription including all monitored items.
+    ~MonitoredItemMultiplexer();
+
+    MonitoredItemMultiplexer(const MonitoredItemMultiplexer&) = delete;
+    MonitoredItemMultiplexer(MonitoredItemMultiplexer&&) noexcept = delete;
+    MonitoredItemMultiplexer& operator=(const MonitoredItemMultiplexer&) = delete;
+    MonitoredItemMultiplexer& operator=(MonitoredItemMultiplexer&&) noexcept = delete;
+
+    /**
+     * Subscribe to data change notifications.
+     * A monitored item is only created if no identical monitored item exists yet.
+     * @param id Monitored node
+     * @param attribute Monitored attribute
+     * @param parameters Monitoring parameters
+     * @param onDataChange Data change notification callback of the subscriber
+     * @return Handle of the subscriber
+     * @exception BadStatus If the monitored item can't be created
+     */
+    IntegerId subscribeDataChange(
+        const NodeId& id,
+        AttributeId attribute,
+        const MonitoringParametersEx& parameters,
+        DataChangeNotificationCallback onDataChange
+    );
+
+    /**
+     * Unsubscribe a subscriber.
+     * The monitored item is deleted if it was the last subscriber.
+     * @exception BadStatus (BadMonitoredItemIdInvalid) If the handle is unknown
+     */
+    void unsubscribe(IntegerId handle);
+
+    /// Get the identifier of the shared subscription.
+    IntegerId subscriptionId() const noexcept {
+        return subscriptionId_;
+    }
+
+    /// Get the server-side monitored item identifier of a subscriber.
+    /// @exception BadStatus (BadMonitoredItemIdInvalid) If the handle is unknown
+    IntegerId monitoredItemId(IntegerId handle) const;
+
+    /// Get the number of subscribers sharing the monitored item of a subscriber.
+    /// @exception BadStatus (BadMonitoredItemIdInvalid) If the handle is unknown
+    size_t subscriberCount(IntegerId handle) const;
+
+    /// Number of subscribers.
+    size_t size() const noexcept {
+        return subscribers_.size();
+    }
+
+    /// Number of server-side monitored items.
+    size_t monitoredItemCount() const noexcept {
+        return items_.size();
+    }
+
+private:
+    struct Key {
+        NodeId id;
+        AttributeId attribute;
+        MonitoringParametersEx parameters;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const noexcept;
+    };
+
+    struct KeyEqual {
+        bool operator()(const Key& lhs, const Key& rhs) const noexcept;
+    };
+
+    using CallbackPtr = std::shared_ptr<const DataChangeNotificationCallback>;
+
+    struct Item {
+        Key key;
+        std::vector<IntegerId> subscribers;
+        std::optional<DataValue> lastValue;
+    };
+
+    struct Subscriber {
+        IntegerId monitoredItemId;
+        CallbackPtr callback;
+    };
+
+    void notify(IntegerId monitoredItemId, const DataValue& value);
+    const Subscriber& getSubscriber(IntegerId handle) const;
+
+    Client& client_;
+    IntegerId subscriptionId_{0};
+    std::unordered_map<Key, IntegerId, KeyHash, KeyEqual> index_;  // -> monitored item id
+    std::unordered_map<IntegerId, Item> items_;  // by monitored item id
+    std::unordered_map<IntegerId, Subscriber> subscribers_;  // by handle
+    IntegerId nextHandle_{1};
+};
+
+}  // namespace opcua
+
+#endif
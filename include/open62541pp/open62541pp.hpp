@@ -1,20 +1,37 @@
 #pragma once
 
+#include "open62541pp/adaptivemonitoring.hpp"
+#include "open62541pp/aggregate.hpp"
+#include "open62541pp/arraystream.hpp"
 #include "open62541pp/async.hpp"
 #include "open62541pp/bitmask.hpp"
 #include "open62541pp/client.hpp"
 #include "open62541pp/common.hpp"
 #include "open62541pp/config.hpp"
 #include "open62541pp/datatype.hpp"
+#include "open62541pp/discovery.hpp"
 #include "open62541pp/event.hpp"
+#include "open62541pp/eventfilter.hpp"
 #include "open62541pp/exception.hpp"
+#include "open62541pp/filetype.hpp"
+#include "open62541pp/gateway.hpp"
+#include "open62541pp/inlinevariant.hpp"
+#include "open62541pp/limitalarm.hpp"
 #include "open62541pp/monitoreditem.hpp"
+#include "open62541pp/monitoreditemgroup.hpp"
+#include "open62541pp/monitoreditemmultiplexer.hpp"
 #include "open62541pp/node.hpp"
+#include "open62541pp/preparedread.hpp"
+#include "open62541pp/redundantclient.hpp"
+#include "open62541pp/reliablesubscription.hpp"
+#include "open62541pp/replication.hpp"
 #include "open62541pp/result.hpp"
 #include "open62541pp/server.hpp"
 #include "open62541pp/session.hpp"
+#include "open62541pp/shardedsubscription.hpp"
 #include "open62541pp/span.hpp"
 #include "open62541pp/subscription.hpp"
+#include "open62541pp/timer.hpp"
 #include "open62541pp/typeconverter.hpp"
 #include "open62541pp/typeregistry.hpp"
 #include "open62541pp/typeregistry_generated.hpp"
@@ -24,6 +41,7 @@
 
 #include "open62541pp/plugin/accesscontrol.hpp"
 #include "open62541pp/plugin/accesscontrol_default.hpp"
+#include "open62541pp/plugin/certificateverification.hpp"
 #include "open62541pp/plugin/create_certificate.hpp"
 #include "open62541pp/plugin/log.hpp"
 #include "open62541pp/plugin/log_default.hpp"
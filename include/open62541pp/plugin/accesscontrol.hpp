@@ -44,6 +44,11 @@ public:
     /**
      * Authenticate a session.
      * The new session is rejected if a status code other than `UA_STATUSCODE_GOOD` is returned.
+     * The context slots of the session (Session::context) are available, e.g. to attach the roles
+     * of the authenticated user. They are removed again if a new session is rejected.
+     * @note open62541 processes ActivateSession synchronously in the server loop and can't defer
+     *       the response. Slow identity checks (e.g. remote identity providers) stall all other
+     *       sessions until they return.
      */
     virtual StatusCode activateSession(
         Session& session,
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/detail/open62541/server.h"  // UA_CertificateVerification, UA_CertificateGroup
+#include "open62541pp/plugin/pluginadapter.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"
+
+namespace opcua {
+
+/**
+ * Native certificate verification plugin.
+ * Open62541 v1.4 replaced UA_CertificateVerification with UA_CertificateGroup.
+ */
+#if UAPP_OPEN62541_VER_GE(1, 4)
+using NativeCertificateVerification = UA_CertificateGroup;
+#else
+using NativeCertificateVerification = UA_CertificateVerification;
+#endif
+
+/**
+ * Options of the CertificateVerificationCache.
+ */
+struct CertificateVerificationCacheOptions {
+    /// Time to live of cached verification results.
+    std::chrono::steady_clock::duration ttl = std::chrono::minutes(5);
+    /// Maximum number of cached verification results.
+    size_t maxEntries = 1024;
+    /// Allow concurrent calls of the decorated plugin (only if it is thread-safe).
+    /// Otherwise the calls are serialized.
+    bool concurrentVerification = false;
+};
+
+/**
+ * Certificate verification with a validation cache.
+ *
+ * The full certificate chain validation (signatures, revocation lists) is the most expensive part
+ * of opening secure channels. If many clients reconnect at once (e.g. after a network outage), the
+ * same certificates are validated again and again. The cache decorates an existing native
+ * verification plugin and stores the verification results keyed by the DER encoded certificate.
+ *
+ * The cached results expire after CertificateVerificationCacheOptions::ttl. Call @ref invalidate
+ * after the trust list or the revocation lists were updated. With open62541 >= v1.4, updates via
+ * the certificate group functions (e.g. `setTrustList`) invalidate the cache automatically.
+ *
+ * @see ServerConfig::enableCertificateVerificationCache
+ */
+class CertificateVerificationCache : public PluginAdapter<NativeCertificateVerification> {
+public:
+    /// Cache statistics.
+    struct Statistics {
+        uint64_t hits;
+        uint64_t misses;
+    };
+
+    /// Create the cache and take ownership of the decorated native plugin.
+    explicit CertificateVerificationCache(
+        NativeCertificateVerification&& plugin, CertificateVerificationCacheOptions options = {}
+    ) noexcept;
+
+    ~CertificateVerificationCache() override;
+
+    CertificateVerificationCache(const CertificateVerificationCache&) = delete;
+    CertificateVerificationCache(CertificateVerificationCache&&) noexcept = delete;
+    CertificateVerificationCache& operator=(const CertificateVerificationCache&) = delete;
+    CertificateVerificationCache& operator=(CertificateVerificationCache&&) noexcept = delete;
+
+    /// Verify the certificate, use the cached result if available.
+    StatusCode verifyCertificate(const ByteString& certificate);
+
+    /**
+     * Verify certificates in advance to fill the cache, e.g. with certificates of known clients.
+     * The asymmetric validation work is distributed to `workers` threads, it runs concurrently only
+     * with CertificateVerificationCacheOptions::concurrentVerification. This function blocks until
+     * all certificates are verified, use `std::async` to run it in the background.
+     */
+    void prevalidate(Span<const ByteString> certificates, size_t workers = 1);
+
+    /// Remove all cached results, e.g. after trust list or revocation list (CRL) updates.
+    void invalidate() noexcept;
+
+    /// Number of cached results.
+    size_t size() const noexcept;
+
+    /// Get the cache statistics.
+    Statistics statistics() const noexcept;
+
+    /// Get the decorated native plugin.
+    NativeCertificateVerification& plugin() noexcept {
+        return plugin_;
+    }
+
+    NativeCertificateVerification create(bool ownsAdapter) override;
+
+private:
+    struct Entry {
+        UA_StatusCode status;
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    void insert(std::string&& key, UA_StatusCode status);
+
+    NativeCertificateVerification plugin_;
+    CertificateVerificationCacheOptions options_;
+    std::unordered_map<std::string, Entry> entries_;
+    mutable std::mutex mutex_;
+    std::mutex pluginMutex_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+namespace detail {
+void clear(NativeCertificateVerification& plugin) noexcept;
+}  // namespace detail
+
+}  // namespace opcua
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>  // forward
+
+#include "open62541pp/services/attribute.hpp"
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/types.hpp"
+
+namespace opcua {
+
+class Client;
+
+/**
+ * Prepared Read request for cyclic polling of the same set of nodes.
+ *
+ * The native request, including all NodeIds, is built once and sent as is with every poll.
+ * The request header fields that change per request (request handle, timestamp and
+ * authentication token) are patched by open62541 when the request is sent; the request body is
+ * encoded straight from the prepared request without building, copying or freeing any request
+ * structures. The request is encoded when it is sent, so the same prepared request can be sent
+ * again while previous responses are pending.
+ *
+ * The results can be moved into preallocated storage that is reused across cycles. The values are
+ * moved out of the response without copying and the previous values are released with the
+ * response:
+ * @code
+ * opcua::PreparedRead poll(client, nodesToRead);
+ * std::vector<opcua::DataValue> values(poll.size());
+ * while (true) {
+ *     poll.readInto(values);  // or poll.readAsync(...) and PreparedRead::takeResults
+ *     // process values...
+ * }
+ * @endcode
+ *
+ * @note The class is not thread-safe. The client must outlive the prepared request.
+ */
+class PreparedRead {
+public:
+    PreparedRead(
+        Client& client,
+        Span<const ReadValueId> nodesToRead,
+        TimestampsToReturn timestamps = TimestampsToReturn::Both,
+        double maxAge = 0
+    );
+
+    /// Get the number of nodes to read.
+    size_t size() const noexcept {
+        return request_->nodesToReadSize;
+    }
+
+    /// Get the prepared request.
+    const ReadRequest& request() const noexcept {
+        return request_;
+    }
+
+    /// Send the prepared request.
+    ReadResponse read() noexcept {
+        return services::read(client_, request_);
+    }
+
+    /**
+     * Send the prepared request and move the results into preallocated storage.
+     * @param results Storage with size() elements
+     * @return Service result or status code of takeResults
+     */
+    StatusCode readInto(Span<DataValue> results) noexcept {
+        auto response = read();
+        return takeResults(response, results);
+    }
+
+    /**
+     * Send the prepared request asynchronously.
+     * @param token @completiontoken{void(ReadResponse&)}
+     * @return @asyncresult{ReadResponse}
+     */
+    template <typename CompletionToken>
+    auto readAsync(CompletionToken&& token) {
+        return services::readAsync(client_, request_, std::forward<CompletionToken>(token));
+    }
+
+    /**
+     * Move the results of a response into preallocated storage without copying.
+     * The previous values of the storage are moved into the response and released with it.
+     * @param response Read response of the prepared request
+     * @param results Storage with one element per result
+     * @return Service result of the response, `BadUnexpectedError` if the number of results
+     *         doesn't match the size of the storage
+     */
+    static StatusCode takeResults(ReadResponse& response, Span<DataValue> results) noexcept;
+
+private:
+    Client& client_;
+    ReadRequest request_;
+};
+
+}  // namespace opcua
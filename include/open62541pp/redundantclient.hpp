@@ -0,0 +1,188 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+
+#include "open62541pp/common.hpp"  // AttributeId, MonitoringMode
+#include "open62541pp/config.hpp"
+#include "open62541pp/services/monitoreditem.hpp"  // MonitoringParametersEx, callbacks
+#include "open62541pp/services/subscription.hpp"  // SubscriptionParameters
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/types.hpp"  // IntegerId
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+class Client;
+
+/**
+ * Options of the RedundantClient.
+ */
+struct RedundantClientOptions {
+    /// Monitoring mode of the mirrored monitored items on the standby server.
+    /// With MonitoringMode::Sampling, the standby server keeps sampling into the queues of the
+    /// monitored items. The queued samples are reported after the failover and close the gap.
+    MonitoringMode standbyMode = MonitoringMode::Sampling;
+    /// Parameters of the subscriptions on both servers.
+    SubscriptionParameters subscriptionParameters{};
+};
+
+/**
+ * Client of a non-transparent redundant server pair with hot-standby subscriptions.
+ *
+ * The redundant client keeps sessions to both servers of a redundant pair (see OPC UA Part 4,
+ * 6.6.2.4.5.3 "Hot"). Every monitored item is created on both servers: in reporting mode on the
+ * active server and in RedundantClientOptions::standbyMode on the standby server. Only the
+ * notifications of the active server are forwarded.
+ *
+ * A failure of the active server is detected by the inactivity callbacks of the client
+ * (Client::onInactive, Client::onSubscriptionInactive), by a closed connection or by an exception
+ * of the event loop. On failure, the mirrored items on the standby server are switched to
+ * reporting mode with a single SetMonitoringMode request. No sessions, subscriptions or monitored
+ * items have to be recreated.
+ *
+ * @code
+ * opcua::Client primary;
+ * opcua::Client backup;
+ * primary.connect("opc.tcp://primary:4840");
+ * backup.connect("opc.tcp://backup:4840");
+ * opcua::RedundantClient client(primary, backup);
+ * client.subscribeDataChange(id, opcua::AttributeId::Value, {}, onDataChange);
+ * while (true) {
+ *     client.runIterate(100);
+ * }
+ * @endcode
+ *
+ * @note The connectivity checks are configured with the client configs, e.g. the
+ *       `connectivityCheckInterval` and the keep-alive count of the subscriptions.
+ * @note The state callbacks Client::onDisconnected, Client::onInactive and
+ *       Client::onSubscriptionInactive of both clients are overwritten.
+ *       The class is not thread-safe. The clients must outlive the redundant client.
+ */
+class RedundantClient {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Failover callback.
+    /// @param active Index of the new active server (0: primary, 1: backup)
+    using FailoverCallback = std::function<void(size_t active)>;
+
+    /// Create a redundant client with connected clients of the primary and backup server.
+    RedundantClient(Client& primary, Client& backup, RedundantClientOptions options = {});
+
+    /// Delete the subscriptions on both servers.
+    ~RedundantClient();
+
+    RedundantClient(const RedundantClient&) = delete;
+    RedundantClient(RedundantClient&&) noexcept = delete;
+    RedundantClient& operator=(const RedundantClient&) = delete;
+    RedundantClient& operator=(RedundantClient&&) noexcept = delete;
+
+    /// Get the client of the active server.
+    Client& active() noexcept {
+        return *clients_[active_];
+    }
+
+    /// Get the client of the standby server.
+    Client& standby() noexcept {
+        return *clients_[1 - active_];
+    }
+
+    /// Get the index of the active server (0: primary, 1: backup).
+    size_t activeIndex() const noexcept {
+        return active_;
+    }
+
+    /// Check if the standby server holds mirrored monitored items.
+    bool isStandbyAvailable() const noexcept {
+        return subscriptionIds_[1 - active_].has_value();
+    }
+
+    /// Set a callback, that is called after a failover.
+    void onFailover(FailoverCallback callback);
+
+    /**
+     * Create a monitored item on the active and the standby server.
+     * @return Handle of the monitored item
+     * @exception BadStatus If the monitored item can't be created on both servers
+     */
+    IntegerId subscribeDataChange(
+        const NodeId& id,
+        AttributeId attribute,
+        const MonitoringParametersEx& parameters,
+        DataChangeNotificationCallback onDataChange
+    );
+
+    /// Delete a monitored item on both servers.
+    /// @exception BadStatus (BadMonitoredItemIdInvalid) If the handle is unknown
+    void unsubscribe(IntegerId handle);
+
+    /**
+     * Run a single iteration of the event loops of both clients.
+     * A pending failure of the active server triggers the failover.
+     * Only errors of the client iterations are treated as server failures. Exceptions thrown by
+     * the notification callbacks are rethrown and don't trigger a failover.
+     * @param timeoutMilliseconds Timeout in milliseconds of the active client's iteration
+     */
+    void runIterate(uint16_t timeoutMilliseconds = 1000);
+
+    /**
+     * Switch the mirrored monitored items on the standby server to reporting and make it active.
+     * The monitored items of the previously active server are switched to standby mode (if the
+     * server is still reachable), otherwise the standby is unavailable until @ref restoreStandby.
+     * @exception BadStatus If the standby server is unavailable or rejected the request
+     */
+    void failover();
+
+    /**
+     * Recreate the mirrored monitored items on the standby server, e.g. after the failed server
+     * was restarted and the standby client reconnected.
+     * @exception BadStatus If the subscription or monitored items can't be created
+     */
+    void restoreStandby();
+
+    /// Number of failovers.
+    size_t failoverCount() const noexcept {
+        return failoverCount_;
+    }
+
+    /// Duration from the failure detection to the reporting of the standby server of the last
+    /// failover.
+    Clock::duration lastFailoverDuration() const noexcept {
+        return lastFailoverDuration_;
+    }
+
+private:
+    struct Item {
+        NodeId id;
+        AttributeId attribute;
+        MonitoringParametersEx parameters;
+        DataChangeNotificationCallback callback;
+        std::array<std::optional<IntegerId>, 2> monitoredItemIds;
+    };
+
+    IntegerId createSubscription(size_t index);
+    IntegerId createMonitoredItem(size_t index, IntegerId handle, const Item& item);
+    void setFailed(size_t index) noexcept;
+
+    std::array<Client*, 2> clients_;
+    RedundantClientOptions options_;
+    FailoverCallback failoverCallback_;
+    std::array<std::optional<IntegerId>, 2> subscriptionIds_;
+    std::map<IntegerId, Item> items_;
+    IntegerId nextHandle_{1};
+    size_t active_{0};
+    std::optional<Clock::time_point> failure_;
+    size_t failoverCount_{0};
+    Clock::duration lastFailoverDuration_{};
+};
+
+}  // namespace opcua
+
+#endif
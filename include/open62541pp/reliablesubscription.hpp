@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "open62541pp/common.hpp"  // AttributeId
+#include "open62541pp/config.hpp"
+#include "open62541pp/services/monitoreditem.hpp"  // MonitoringParametersEx
+#include "open62541pp/services/subscription.hpp"  // SubscriptionParameters
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/types.hpp"  // IntegerId
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+class Client;
+
+/**
+ * Options of the ReliableSubscription.
+ */
+struct ReliableSubscriptionOptions {
+    /// Parameters of the subscription.
+    /// The keep-alive interval (publishing interval * max keep-alive count) should be lower than
+    /// the request timeout of the client.
+    SubscriptionParameters subscriptionParameters{};
+    /// Number of outstanding Publish requests.
+    size_t publishRequests = 2;
+    /// Maximum number of outstanding Republish requests.
+    /// Gaps with more missing messages are given up and recovered by the fallback re-read.
+    size_t maxRepublishRequests = 16;
+    /// Maximum number of nodes per Read request of the fallback re-read.
+    size_t maxNodesPerRead = 1000;
+};
+
+/**
+ * Statistics of the ReliableSubscription.
+ */
+struct ReliableSubscriptionStatistics {
+    uint64_t notificationMessages;  ///< Notification messages delivered in sequence
+    uint64_t keepAliveMessages;  ///< Keep-alive messages
+    uint64_t gaps;  ///< Detected gaps of sequence numbers
+    uint64_t missingMessages;  ///< Missing notification messages of all gaps
+    uint64_t republishedMessages;  ///< Missing messages recovered with Republish requests
+    uint64_t lostMessages;  ///< Missing messages not available for Republish or given up
+    uint64_t rereads;  ///< Fallback re-reads of the affected monitored items
+    uint64_t rereadValues;  ///< Values delivered by fallback re-reads
+};
+
+/**
+ * Subscription with notification sequence tracking and gap recovery.
+ *
+ * The sequence numbers of the notification messages are tracked. If notification messages are
+ * lost, e.g. PublishResponses during a short network interruption, the gap is detected by the
+ * sequence number of the next notification or keep-alive message. The missing messages are
+ * requested with Republish requests from the retransmission queue of the server. Notifications
+ * received after a gap are buffered until the gap is closed, so notifications are always delivered
+ * in sequence.
+ *
+ * If a missing message is not available for Republish anymore, the values of the affected
+ * monitored items are re-read in batched Read requests. Monitored items with notifications
+ * after the gap are not affected, their latest values are already delivered. Gaps with more
+ * missing messages than ReliableSubscriptionOptions::maxRepublishRequests are given up without
+ * Republish requests. Notifications received during a re-read are buffered until the re-read
+ * values are delivered, so re-read values never overwrite newer notifications.
+ *
+ * The open62541 client processes PublishResponses internally and doesn't expose the sequence
+ * numbers. Therefore, the reliable subscription manages the subscription, its monitored items and
+ * the Publish requests itself. Use a dedicated client (session) without other subscriptions,
+ * otherwise the Publish requests of the client and the reliable subscription compete for the
+ * notification messages.
+ *
+ * @code
+ * opcua::ReliableSubscription sub(client);
+ * sub.subscribeDataChange(id, opcua::AttributeId::Value, {}, onDataChange);
+ * while (true) {
+ *     sub.runIterate(100);
+ * }
+ * @endcode
+ *
+ * @note The class is not thread-safe. The client must outlive the reliable subscription.
+ */
+class ReliableSubscription {
+public:
+    /// Create the subscription.
+    /// @exception BadStatus If the subscription can't be created
+    explicit ReliableSubscription(Client& client, ReliableSubscriptionOptions options = {});
+
+    /// Delete the subscription.
+    ~ReliableSubscription();
+
+    ReliableSubscription(const ReliableSubscription&) = delete;
+    ReliableSubscription(ReliableSubscription&&) noexcept = delete;
+    ReliableSubscription& operator=(const ReliableSubscription&) = delete;
+    ReliableSubscription& operator=(ReliableSubscription&&) noexcept = delete;
+
+    /// Get the server-assigned identifier of the subscription.
+    IntegerId subscriptionId() const noexcept;
+
+    /**
+     * Create a monitored item for data change notifications.
+     * @return Monitored item identifier
+     * @exception BadStatus If the monitored item can't be created
+     */
+    IntegerId subscribeDataChange(
+        const NodeId& id,
+        AttributeId attribute,
+        const MonitoringParametersEx& parameters,
+        DataChangeNotificationCallback onDataChange
+    );
+
+    /// Delete a monitored item.
+    /// @exception BadStatus If the monitored item can't be deleted
+    void unsubscribe(IntegerId monitoredItemId);
+
+    /// Send Publish requests up to ReliableSubscriptionOptions::publishRequests.
+    void publish();
+
+    /// Send Publish requests and run a single iteration of the client.
+    void runIterate(uint16_t timeoutMilliseconds = 1000);
+
+    /// Get the sequence number of the next expected notification message.
+    uint32_t nextSequenceNumber() const noexcept;
+
+    /// Get the recovery statistics.
+    ReliableSubscriptionStatistics statistics() const noexcept;
+
+private:
+    struct State;
+
+    std::shared_ptr<State> state_;
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/subscription.hpp"
+#include "open62541pp/types.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+class Client;
+class Server;
+
+/**
+ * Options of the ReplicationSender.
+ */
+struct ReplicationOptions {
+    /// Sampling interval of the replicated variables in milliseconds.
+    double samplingInterval = 50.0;
+    /// Maximum number of values per frame (Write request).
+    size_t maxFrameSize = 1000;
+    /// Maximum number of frames in flight (sent, but not acknowledged).
+    size_t maxFramesInFlight = 4;
+    /// Replicate only the latest pending value of a variable.
+    bool coalesce = true;
+};
+
+/**
+ * Statistics of the ReplicationSender.
+ */
+struct ReplicationStatistics {
+    uint64_t capturedValues;  ///< Value changes captured on the primary server
+    uint64_t sentValues;  ///< Values sent to the standby server
+    uint64_t appliedValues;  ///< Values applied by the standby server
+    uint64_t failedValues;  ///< Values rejected by the standby server
+    uint64_t requeuedValues;  ///< Values of failed frames put back to the pending values
+    uint64_t sentFrames;  ///< Frames (Write requests) sent to the standby server
+    size_t pendingValues;  ///< Captured values, not sent yet
+    size_t framesInFlight;  ///< Frames sent, but not acknowledged yet
+    /// Replication lag (from capture to acknowledgement) of the last acknowledged frame.
+    std::chrono::steady_clock::duration lastLag;
+    /// Maximum replication lag.
+    std::chrono::steady_clock::duration maxLag;
+};
+
+/**
+ * Hot-standby replication of variable values from a primary server to a standby server.
+ *
+ * The value changes of the replicated variables are captured on the primary server with local
+ * monitored items. Pending values are batched into frames and sent with pipelined Write requests
+ * to the standby server, encoded with the OPC UA binary protocol over the session of a client.
+ * The standby server applies each frame with a single Write service call.
+ *
+ * The nodes of the replicated variables must exist on both servers. Address space changes are not
+ * replicated.
+ *
+ * @code
+ * opcua::Client standbyClient;
+ * standbyClient.connect("opc.tcp://standby:4840");
+ * opcua::ReplicationSender sender(primary, standbyClient);
+ * sender.addVariable(id);
+ * while (true) {
+ *     primary.runIterate();
+ *     sender.flush();
+ *     standbyClient.runIterate(0);
+ * }
+ * @endcode
+ *
+ * @note Captured values are queued thread-safe, so the primary server and the standby client might
+ *       run in different threads. Add and remove variables within the thread running the primary
+ *       server (or before it runs). Call @ref flush within the thread running the standby client.
+ */
+class ReplicationSender {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Create a replication sender.
+    /// @param primary Primary server
+    /// @param standby Client connected to the standby server
+    /// @param options Replication options
+    ReplicationSender(Server& primary, Client& standby, ReplicationOptions options = {});
+
+    ~ReplicationSender();
+
+    ReplicationSender(const ReplicationSender&) = delete;
+    ReplicationSender(ReplicationSender&&) noexcept = delete;
+    ReplicationSender& operator=(const ReplicationSender&) = delete;
+    ReplicationSender& operator=(ReplicationSender&&) noexcept = delete;
+
+    /// Replicate the value changes of a variable.
+    void addVariable(const NodeId& id);
+
+    /// Stop the replication of a variable.
+    void removeVariable(const NodeId& id);
+
+    /// Capture a value change manually, e.g. within a value callback.
+    void capture(const NodeId& id, const DataValue& value);
+
+    /**
+     * Send the pending values to the standby server.
+     * The values are sent in frames of up to ReplicationOptions::maxFrameSize values, as long as
+     * the number of frames in flight is below ReplicationOptions::maxFramesInFlight.
+     * The acknowledgements are processed by the event loop of the standby client.
+     * If a frame can't be sent (e.g. the standby client is disconnected), the frame and all
+     * following frames are put back to the pending values. The error is rethrown by the event
+     * loop of the standby client.
+     * Values of frames that fail after they were sent (bad service result or response dropped,
+     * e.g. on disconnect) are put back to the pending values as well, unless a newer value of the
+     * variable was captured in the meantime. Values rejected individually by the standby server
+     * are not retried.
+     * @return Number of sent values
+     */
+    size_t flush();
+
+    /// Get the replication statistics.
+    ReplicationStatistics statistics() const;
+
+private:
+    struct State;
+
+    Server& primary_;
+    Client& standby_;
+    ReplicationOptions options_;
+    Subscription<Server> subscription_;
+    std::unordered_map<NodeId, IntegerId> monitoredItems_;
+    std::shared_ptr<State> state_;
+};
+
+/**
+ * Standby role of a server within a hot-standby replication.
+ *
+ * The standby server announces the redundancy mode `Hot` and a reduced ServiceLevel, so that
+ * redundancy-aware clients (e.g. RedundantClient) prefer the primary server. The values are kept
+ * warm by the ReplicationSender of the primary server. On failover, @ref promote raises the
+ * ServiceLevel and the standby server takes over with the replicated values.
+ */
+class ReplicationStandby {
+public:
+    /// @param standby Standby server
+    /// @param serviceLevel ServiceLevel of the standby server (not promoted)
+    explicit ReplicationStandby(Server& standby, uint8_t serviceLevel = 100);
+
+    /// Promote the standby server.
+    /// @param serviceLevel ServiceLevel of the promoted server
+    void promote(uint8_t serviceLevel = 255);
+
+    /// Check if the standby server is promoted.
+    bool isPromoted() const noexcept {
+        return promoted_;
+    }
+
+private:
+    Server& server_;
+    bool promoted_{false};
+};
+
+}  // namespace opcua
+
+#endif
@@ -1,10 +1,11 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
-#include <utility>  // move
+#include <utility>  // forward, move
 #include <vector>
 
 #include "open62541pp/common.hpp"  // NamespaceIndex
@@ -16,11 +17,13 @@
 #include "open62541pp/session.hpp"
 #include "open62541pp/span.hpp"
 #include "open62541pp/subscription.hpp"
+#include "open62541pp/timer.hpp"
 #include "open62541pp/types.hpp"
 #include "open62541pp/ua/nodeids.hpp"
 #include "open62541pp/wrapper.hpp"
 
 #include "open62541pp/plugin/accesscontrol.hpp"
+#include "open62541pp/plugin/certificateverification.hpp"
 #include "open62541pp/plugin/log.hpp"
 #include "open62541pp/plugin/log_default.hpp"  // LogFunction
 #include "open62541pp/plugin/nodestore.hpp"
@@ -109,6 +112,17 @@ public:
     void setAccessControl(AccessControlBase& accessControl);
     /// Set custom access control (transfer ownership to Server).
     void setAccessControl(std::unique_ptr<AccessControlBase>&& accessControl);
+
+    /**
+     * Cache the certificate verification results of secure channels.
+     * The configured verification plugin is decorated with a CertificateVerificationCache, which
+     * is owned by the config (and the Server respectively).
+     * Call this function after the trust list is configured.
+     * @return Reference to the cache, e.g. to invalidate the cache after revocation list updates
+     */
+    CertificateVerificationCache& enableCertificateVerificationCache(
+        const CertificateVerificationCacheOptions& options = {}
+    );
 };
 
 /* ------------------------------------------- Server ------------------------------------------- */
@@ -128,6 +142,18 @@ public:
  * Don't overwrite the UA_ServerConfig::context pointer! The context pointer is used to store a
  * pointer to the Server instance (for asWrapper(UA_Server*)) and to get access to the underlying
  * server context.
+ *
+ * @par Thread safety
+ * If open62541 is built with `UA_MULTITHREADING >= 100` (`UAPP_HAS_CONCURRENT_SERVER`), the
+ * server can be used concurrently: While one thread runs the main loop with run() or runIterate(),
+ * other threads may call the `services::*` functions, Node methods, setVariableNode*(),
+ * schedule() and cancelTimer() on the same server. open62541 locks the server internally, the
+ * state of the wrapper (node callbacks, sessions, timers and monitored items) is synchronized by
+ * the wrapper. Callbacks are invoked by the thread that triggered them, e.g. a value callback by
+ * the main loop for client requests or by the thread calling services::readValue. Exceptions of
+ * callbacks are stored and rethrown by the main loop, regardless of the invoking thread.
+ * The configuration, setCustomDataTypes() and the lifetime functions (constructor, run(),
+ * runIterate() and stop()) must not be called concurrently.
  */
 class Server {
 public:
@@ -221,6 +247,14 @@ public:
         return sessions();
     }
 
+    /**
+     * Enable or disable the refresh of the server diagnostics of the sessions (disabled by
+     * default). If enabled, the server loop reads the session diagnostics array at most once per
+     * second and Session::statistics returns them. Disabling the refresh discards the diagnostics.
+     * @note Requires `UA_ENABLE_DIAGNOSTICS` (since open62541 v1.3), no effect otherwise.
+     */
+    void setSessionDiagnosticsEnabled(bool enabled);
+
     /// Get all defined namespaces.
     std::vector<std::string> namespaceArray();
 
@@ -249,6 +283,47 @@ public:
     Event createEvent(const NodeId& eventType = ObjectTypeId::BaseEventType);
 #endif
 
+    /**
+     * Schedule a repeated callback in the main loop of the server.
+     * Timers with equal intervals are coalesced and executed in the same wakeup of the main loop.
+     * Execution statistics including overruns (invocations taking longer than the interval) are
+     * available with Server::timerStatistics.
+     * @param interval Interval of the callback
+     * @param callback Callable with signature `void()`, move-only callables are allowed
+     * @return Timer identifier to cancel the timer
+     * @exception BadStatus If the timer can't be added to the main loop
+     * @note Timers are executed within the thread of the main loop. With
+     *       `UAPP_HAS_CONCURRENT_SERVER`, timers may be scheduled/cancelled from any thread,
+     *       otherwise only within the thread of the main loop.
+     */
+    template <typename Callback>
+    TimerId schedule(std::chrono::milliseconds interval, Callback&& callback) {
+        return addTimer(
+            interval, false, detail::makeTimerCallback(std::forward<Callback>(callback))
+        );
+    }
+
+    /**
+     * Schedule a one-shot callback in the main loop of the server.
+     * The timer is removed after its execution.
+     * @param delay Delay until the execution of the callback
+     * @param callback Callable with signature `void()`, move-only callables are allowed
+     * @return Timer identifier to cancel the timer
+     * @exception BadStatus If the timer can't be added to the main loop
+     */
+    template <typename Callback>
+    TimerId scheduleOnce(std::chrono::milliseconds delay, Callback&& callback) {
+        return addTimer(delay, true, detail::makeTimerCallback(std::forward<Callback>(callback)));
+    }
+
+    /// Cancel a timer.
+    /// @return `false` if the timer doesn't exist (anymore)
+    bool cancelTimer(TimerId id);
+
+    /// Get the execution statistics of a timer.
+    /// @exception BadStatus (BadNotFound) If the timer doesn't exist (anymore)
+    TimerStatistics timerStatistics(TimerId id) const;
+
     /// Run a single iteration of the server's main loop.
     /// @return Maximum wait period until next Server::runIterate call (in ms)
     uint16_t runIterate();
@@ -274,6 +349,8 @@ private:
 
     friend detail::ServerContext& detail::getContext(Server& server) noexcept;
 
+    TimerId addTimer(std::chrono::milliseconds interval, bool once, TimerCallback&& callback);
+
     struct Deleter {
         void operator()(UA_Server* server) noexcept;
     };
@@ -16,6 +16,7 @@
 
 namespace opcua {
 class Client;
+class Server;
 }  // namespace opcua
 
 namespace opcua::services {
@@ -311,6 +312,44 @@ auto writeDataValueAsync(
     );
 }
 
+/**
+ * Write the AttributeId::Value attribute of a node only if the value or status changed (server
+ * only).
+ * The value and status are compared to the current value of the node, timestamps are ignored. If
+ * both are unchanged, the write is skipped: the node is not updated and no value callbacks or data
+ * change notifications of monitored items are triggered. The node is not read, instead a hash of
+ * the value and status written by this function is stored per node and reset by every other write
+ * of the value (the native onWrite value callback of the node is used for that), so the comparison
+ * is cheap and doesn't invoke value callbacks or data sources. Values with equal hashes are
+ * assumed to be unchanged.
+ *
+ * The first write of a node is never skipped, neither is the first write after a write by other
+ * services, clients or the native API. Nodes with data sources are always written.
+ * @note The node context and native value callbacks of the node are set by the wrapper (like
+ *       Server::setVariableNodeValueCallback), don't replace them with the native API.
+ * @param connection Instance of type Server
+ * @param id Node to write
+ * @param value Value to write
+ * @return True if the value was written, false if the value and status were unchanged
+ * @ingroup Write
+ */
+Result<bool> writeDataValueIfChanged(
+    Server& connection, const NodeId& id, const DataValue& value
+) noexcept;
+
+/**
+ * Write the AttributeId::Value attribute of a node only if the value changed (server only).
+ * @see writeDataValueIfChanged
+ * @param connection Instance of type Server
+ * @param id Node to write
+ * @param value Value to write
+ * @return True if the value was written, false if the value was unchanged
+ * @ingroup Write
+ */
+Result<bool> writeValueIfChanged(
+    Server& connection, const NodeId& id, const Variant& value
+) noexcept;
+
 /**
  * @}
  */
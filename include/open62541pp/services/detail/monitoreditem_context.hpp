@@ -2,10 +2,13 @@
 
 #include <cstdint>
 #include <functional>
+#include <optional>
 
+#include "open62541pp/aggregate.hpp"
 #include "open62541pp/services/detail/callbackadapter.hpp"
 #include "open62541pp/span.hpp"
-#include "open62541pp/ua/types.hpp"  // DataValue, IntegerId, Variant
+#include "open62541pp/types.hpp"  // DataValue, DateTime, NodeId, Variant
+#include "open62541pp/ua/types.hpp"  // IntegerId, ReadValueId
 #include "open62541pp/wrapper.hpp"  // asWrapper
 
 struct UA_Client;
@@ -13,6 +16,15 @@ struct UA_Server;
 
 namespace opcua::services::detail {
 
+/// State of server-side aggregation (AggregateFilter) of a local monitored item.
+struct MonitoredItemAggregate {
+    NodeId aggregateType;
+    int64_t processingInterval{0};  // 100 nanosecond intervals
+    AggregateCalculator calculator;
+    IntegerId monitoredItemId{0};
+    uint64_t callbackId{0};
+};
+
 struct MonitoredItemContext : CallbackAdapter {
     bool stale{false};
     bool inserted{false};
@@ -20,6 +32,7 @@ struct MonitoredItemContext : CallbackAdapter {
     std::function<void(IntegerId subId, IntegerId monId, const DataValue&)> dataChangeCallback;
     std::function<void(IntegerId subId, IntegerId monId, Span<const Variant>)> eventCallback;
     std::function<void(IntegerId subId, IntegerId monId)> deleteCallback;
+    std::optional<MonitoredItemAggregate> aggregate;
 
     static void dataChangeCallbackNativeServer(
         [[maybe_unused]] UA_Server* server,
@@ -35,10 +48,50 @@ struct MonitoredItemContext : CallbackAdapter {
             if (!self->inserted) {
                 return;  // avoid immediate callbacks before insertion
             }
+            if (self->aggregate.has_value()) {
+                self->aggregate->calculator.add(asWrapper<DataValue>(*value));
+                return;  // only publish aggregates
+            }
             self->invoke(self->dataChangeCallback, 0U, monId, asWrapper<DataValue>(*value));
         }
     }
 
+    static void publishAggregate(MonitoredItemContext& self, DateTime endTime) {
+        auto& aggregate = self.aggregate.value();
+        if (self.dataChangeCallback != nullptr) {
+            self.dataChangeCallback(
+                0U,
+                aggregate.monitoredItemId,
+                aggregate.calculator.result(aggregate.aggregateType, endTime)
+            );
+        }
+    }
+
+    /// Repeated server callback to close processing intervals.
+    static void aggregateCallbackNativeServer(
+        [[maybe_unused]] UA_Server* server, void* data
+    ) noexcept {
+        if (data != nullptr) {
+            auto* self = static_cast<MonitoredItemContext*>(data);
+            if (!self->inserted || !self->aggregate.has_value()) {
+                return;
+            }
+            auto& aggregate = *self->aggregate;
+            const int64_t now = DateTime::now().get();
+            const int64_t startTime = aggregate.calculator.startTime().get();
+            const int64_t endTime = startTime + aggregate.processingInterval;
+            if (endTime > now) {
+                return;
+            }
+            self->invoke(&publishAggregate, *self, DateTime(endTime));
+            // skip the intervals elapsed while the server was busy, they contain no values
+            const int64_t elapsed = (now - startTime) / aggregate.processingInterval;
+            aggregate.calculator.reset(
+                DateTime(startTime + elapsed * aggregate.processingInterval)
+            );
+        }
+    }
+
     static void dataChangeCallbackNativeClient(
         [[maybe_unused]] UA_Client* client,
         IntegerId subId,
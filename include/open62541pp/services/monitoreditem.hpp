@@ -60,6 +60,9 @@ struct MonitoringParametersEx {
     /// Filter is used by the server to determine if the MonitoredItem should generate
     /// notifications. The filter parameter type is an extensible parameter type and can be, for
     /// example, of type DataChangeFilter, EventFilter or AggregateFilter.
+    /// AggregateFilters of local (server-side) monitored items are evaluated by open62541pp with
+    /// the AggregateCalculator, only the aggregates are forwarded to the callback.
+    /// AggregateFilters of remote clients are not supported and still rejected by open62541.
     /// @see https://reference.opcfoundation.org/Core/Part4/v105/docs/7.22
     ExtensionObject filter;
     /// Size of the MonitoringItem queue.
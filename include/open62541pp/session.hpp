@@ -1,19 +1,84 @@
 #pragma once
 
-#include <utility>  // move
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>  // forward, move
 
+#include "open62541pp/detail/session_context.hpp"
 #include "open62541pp/types.hpp"
 
 namespace opcua {
 
 class Server;
 
+/**
+ * Request counter of a service (total and failed requests).
+ */
+struct ServiceCounter {
+    uint32_t total{0};
+    uint32_t errors{0};
+};
+
+/**
+ * Snapshot of the statistics of a session.
+ * @see Session::statistics
+ */
+struct SessionStatistics {
+    /**
+     * @name Access checks
+     * Calls of the access control callbacks of the server for this session, counted lock-free.
+     * These are not service operations: the server checks the access per node, possibly several
+     * times per operation (e.g. user rights and access level of a read) and also for requests of
+     * other services. Use the server diagnostics to count requests.
+     * @{
+     */
+    uint64_t attributeAccessChecks{0};  ///< User access level/rights mask checks
+    uint64_t methodAccessChecks{0};  ///< User executable checks
+    uint64_t browseAccessChecks{0};  ///< Browse node checks (since open62541 v1.1)
+    uint64_t nodeManagementAccessChecks{0};  ///< Add/delete nodes/references checks
+    DateTime lastAccessCheck;  ///< Time of the last access check
+    /// @}
+
+    /**
+     * @name Server diagnostics
+     * Requests by service type, subscriptions and monitored items maintained by the server.
+     * Only available if `UA_ENABLE_DIAGNOSTICS` is enabled (since open62541 v1.3) and the refresh
+     * is enabled with Server::setSessionDiagnosticsEnabled. The diagnostics of all sessions are
+     * then refreshed by the server loop at most once per second.
+     * Bytes sent/received are not tracked per session by open62541 and therefore not provided.
+     * @{
+     */
+    bool hasDiagnostics{false};
+    ServiceCounter totalRequests;
+    ServiceCounter readRequests;
+    ServiceCounter writeRequests;
+    ServiceCounter callRequests;
+    ServiceCounter browseRequests;
+    ServiceCounter browseNextRequests;
+    ServiceCounter translateBrowsePathsRequests;
+    ServiceCounter historyReadRequests;
+    ServiceCounter createSubscriptionRequests;
+    ServiceCounter deleteSubscriptionsRequests;
+    ServiceCounter publishRequests;
+    ServiceCounter republishRequests;
+    ServiceCounter createMonitoredItemsRequests;
+    ServiceCounter deleteMonitoredItemsRequests;
+    uint32_t currentSubscriptions{0};
+    uint32_t currentMonitoredItems{0};
+    uint32_t currentPublishRequestsInQueue{0};  ///< Publish queue depth
+    DateTime clientLastContactTime;
+    /// @}
+};
+
 /**
  * High-level session class to manage client sessions.
  *
  * Sessions are identified by a server-assigned session id (of type NodeId).
  * A session carries attributes in a key-value list. Custom attributes/meta-data can be attached to
  * a session as key-value pairs of QualifiedName and Variant.
+ * Arbitrary C++ objects (e.g. user roles) can be attached to a session with typed context slots,
+ * see @ref context.
  *
  * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.7
  */
@@ -23,6 +88,13 @@ public:
         : connection_(&connection),
           sessionId_(std::move(sessionId)) {}
 
+    /// Create a session with known context slots (e.g. the session context of access control
+    /// callbacks) to skip the lookup in the session registry.
+    Session(Server& connection, NodeId sessionId, detail::SessionContext* context) noexcept
+        : connection_(&connection),
+          sessionId_(std::move(sessionId)),
+          context_(context) {}
+
     /// Get the server instance.
     Server& connection() noexcept {
         return *connection_;
@@ -50,13 +122,76 @@ public:
     /// @note Supported since open62541 v1.3
     void deleteSessionAttribute(const QualifiedName& key);
 
+    /**
+     * Get the context object of type `T` attached to this session.
+     * The context object is default-constructed on first access. Context objects are native C++
+     * objects (no Variant conversion) stored in typed slots of the session.
+     *
+     * Session objects passed to the callbacks of AccessControlBase know the slots of the session,
+     * so the lookup is a slot access guarded by a per-session mutex. Otherwise the session is
+     * looked up first in the session registry of the server, logarithmic in the number of active
+     * sessions and guarded by a server-wide mutex.
+     *
+     * The slots are synchronized, the context objects themselves are not. The returned pointer
+     * shares the ownership of the context object, so it stays valid after the session is closed or
+     * the object is replaced.
+     * @exception BadStatus (BadSessionIdInvalid) If the session is not active
+     */
+    template <typename T>
+    std::shared_ptr<T> context() {
+        detail::SessionContext* ctx = nullptr;
+        const auto lock = lockSessionContext(ctx);
+        return ctx->findOrEmplace<T>();
+    }
+
+    /// Get the context object of type `T` or `nullptr` if not attached.
+    /// @exception BadStatus (BadSessionIdInvalid) If the session is not active
+    template <typename T>
+    std::shared_ptr<T> findContext() {
+        detail::SessionContext* ctx = nullptr;
+        const auto lock = lockSessionContext(ctx);
+        return ctx->find<T>();
+    }
+
+    /// Attach a context object of type `T`, constructed with the given arguments.
+    /// An existing context object of the same type is replaced.
+    /// @exception BadStatus (BadSessionIdInvalid) If the session is not active
+    template <typename T, typename... Args>
+    std::shared_ptr<T> emplaceContext(Args&&... args) {
+        detail::SessionContext* ctx = nullptr;
+        const auto lock = lockSessionContext(ctx);
+        return ctx->emplace<T>(std::forward<Args>(args)...);
+    }
+
+    /// Remove the context object of type `T`.
+    /// @exception BadStatus (BadSessionIdInvalid) If the session is not active
+    template <typename T>
+    void eraseContext() {
+        detail::SessionContext* ctx = nullptr;
+        const auto lock = lockSessionContext(ctx);
+        ctx->erase<T>();
+    }
+
+    /**
+     * Get a snapshot of the session statistics.
+     * The access checks are counted by the access control callbacks, the server diagnostics are
+     * refreshed by the server loop (if enabled). Both are copied, so they can be read from any
+     * thread while the server is running. The server is not queried.
+     * @exception BadStatus (BadSessionIdInvalid) If the session is not active
+     */
+    SessionStatistics statistics();
+
     /// Manually close this session.
     /// @note Supported since open62541 v1.3
     void close();
 
 private:
+    /// Find the session context, the returned lock guards the session against closing.
+    std::unique_lock<std::mutex> lockSessionContext(detail::SessionContext*& context);
+
     Server* connection_;
     NodeId sessionId_;
+    detail::SessionContext* context_{nullptr};
 };
 
 bool operator==(const Session& lhs, const Session& rhs) noexcept;
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <utility>  // pair
+#include <vector>
+
+#include "open62541pp/common.hpp"  // AttributeId
+#include "open62541pp/config.hpp"
+#include "open62541pp/services/monitoreditem.hpp"  // MonitoringParametersEx
+#include "open62541pp/services/subscription.hpp"  // SubscriptionParameters
+#include "open62541pp/span.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/types.hpp"  // IntegerId
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+class Client;
+
+/**
+ * Strategy to assign monitored items to the shards of a ShardedSubscription.
+ */
+enum class ShardingStrategy {
+    // clang-format off
+    Hash,       ///< Distribute items by the hash of the monitored node id
+    RateClass,  ///< Group items by sampling interval, distribute by hash within a rate class
+    // clang-format on
+};
+
+/**
+ * Options of the ShardedSubscription.
+ */
+struct ShardedSubscriptionOptions {
+    /// Number of subscriptions per session (per rate class with ShardingStrategy::RateClass).
+    size_t shardsPerSession = 4;
+    /// Maximum number of monitored items per subscription (0 if unlimited).
+    size_t maxItemsPerSubscription = 0;
+    /// Strategy to assign monitored items to the shards.
+    ShardingStrategy strategy = ShardingStrategy::Hash;
+    /// Upper bounds of the sampling intervals in milliseconds per rate class (ascending).
+    /// The publishing interval of the subscriptions of a rate class is set to its bound.
+    /// Only used with ShardingStrategy::RateClass.
+    std::vector<double> rateClasses{100.0, 1000.0, 10000.0};
+    /// Parameters of the subscriptions.
+    SubscriptionParameters subscriptionParameters{};
+};
+
+/**
+ * Monitored items distributed across multiple subscriptions and sessions.
+ *
+ * Servers limit the number of monitored items per subscription and process the publishing of a
+ * subscription sequentially. A sharded subscription spreads the monitored items across multiple
+ * subscriptions (shards), optionally of multiple sessions (clients of a pool). The subscriptions
+ * are created on demand.
+ *
+ * If a shard is full, either by ShardedSubscriptionOptions::maxItemsPerSubscription or rejected by
+ * the server with `BadTooManyMonitoredItems`, the item is placed in the next shard. If all shards
+ * are full, additional shards are created. Sessions rejecting new subscriptions with
+ * `BadTooManySubscriptions` are skipped.
+ *
+ * The notifications of all shards are forwarded to a single callback. Monitored items are
+ * identified by a handle, which is stable regardless of the subscription the item is placed in.
+ *
+ * @code
+ * opcua::ShardedSubscription sharded(client);
+ * sharded.setNotificationCallback([](opcua::IntegerId handle, const opcua::DataValue& dv) {});
+ * const auto handle = sharded.subscribeDataChange(id, opcua::AttributeId::Value);
+ * @endcode
+ *
+ * @note The class is not thread-safe. The clients must outlive the sharded subscription.
+ */
+class ShardedSubscription {
+public:
+    /// Unified data change notification callback.
+    /// @param handle Handle of the monitored item returned by @ref subscribeDataChange
+    /// @param value Changed value
+    using NotificationCallback = std::function<void(IntegerId handle, const DataValue& value)>;
+
+    /// Shard information.
+    struct Shard {
+        Client* session;
+        IntegerId subscriptionId;
+        size_t rateClass;
+        size_t itemCount;
+        bool full;  ///< Rejected items with `BadTooManyMonitoredItems`
+    };
+
+    /// Create a sharded subscription within a single session.
+    explicit ShardedSubscription(Client& client, ShardedSubscriptionOptions options = {});
+
+    /// Create a sharded subscription across a pool of sessions.
+    explicit ShardedSubscription(
+        Span<Client* const> sessions, ShardedSubscriptionOptions options = {}
+    );
+
+    /// Delete all subscriptions of the shards.
+    ~ShardedSubscription();
+
+    ShardedSubscription(const ShardedSubscription&) = delete;
+    ShardedSubscription(ShardedSubscription&&) noexcept = delete;
+    ShardedSubscription& operator=(const ShardedSubscription&) = delete;
+    ShardedSubscription& operator=(ShardedSubscription&&) noexcept = delete;
+
+    /// Set the callback for the data change notifications of all monitored items.
+    void setNotificationCallback(NotificationCallback callback);
+
+    /**
+     * Create a monitored item for data change notifications in one of the shards.
+     * @return Handle of the monitored item
+     * @exception BadStatus If the item can't be placed in any shard
+     */
+    IntegerId subscribeDataChange(
+        const NodeId& id, AttributeId attribute, const MonitoringParametersEx& parameters = {}
+    );
+
+    /// Delete a monitored item.
+    /// @exception BadStatus (BadMonitoredItemIdInvalid) If the handle is unknown
+    void unsubscribe(IntegerId handle);
+
+    /// Get the shard of a monitored item.
+    /// @exception BadStatus (BadMonitoredItemIdInvalid) If the handle is unknown
+    const Shard& shard(IntegerId handle) const;
+
+    /// Get the subscription-specific monitored item identifier of a monitored item.
+    /// @exception BadStatus (BadMonitoredItemIdInvalid) If the handle is unknown
+    IntegerId monitoredItemId(IntegerId handle) const;
+
+    /// Get all created shards.
+    Span<const Shard> shards() const noexcept {
+        return shards_;
+    }
+
+    /// Number of monitored items of all shards.
+    size_t size() const noexcept {
+        return items_.size();
+    }
+
+private:
+    struct Item {
+        size_t shard;
+        IntegerId monitoredItemId;
+    };
+
+    size_t rateClass(double samplingInterval) const noexcept;
+    std::optional<size_t> getOrCreateShard(size_t rateClass, size_t slot);
+
+    std::vector<Client*> sessions_;
+    ShardedSubscriptionOptions options_;
+    NotificationCallback callback_;
+    std::vector<Shard> shards_;
+    std::map<std::pair<size_t, size_t>, size_t> slots_;  // (rate class, slot) -> shard
+    std::vector<bool> sessionsFull_;
+    std::unordered_map<IntegerId, Item> items_;
+    IntegerId nextHandle_{1};
+};
+
+}  // namespace opcua
+
+#endif
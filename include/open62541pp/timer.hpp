@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>  // forward
+
+namespace opcua {
+
+/// Identifier of a timer scheduled with Server::schedule or Client::schedule.
+using TimerId = uint64_t;
+
+/// Timer callback.
+using TimerCallback = std::function<void()>;
+
+/**
+ * Execution statistics of a timer.
+ */
+struct TimerStatistics {
+    uint64_t invocations;  ///< Number of callback invocations
+    uint64_t overruns;  ///< Invocations with a duration exceeding the interval
+    std::chrono::steady_clock::duration lastDuration;  ///< Duration of the last invocation
+    std::chrono::steady_clock::duration maxDuration;  ///< Maximum duration of all invocations
+};
+
+namespace detail {
+
+/// Create a timer callback from any callable, move-only callables are stored in a shared pointer.
+template <typename F>
+TimerCallback makeTimerCallback(F&& func) {
+    using Func = std::decay_t<F>;
+    static_assert(std::is_invocable_r_v<void, Func&>, "Timer callback must be invocable as void()");
+    if constexpr (std::is_copy_constructible_v<Func>) {
+        return TimerCallback(std::forward<F>(func));
+    } else {
+        return [ptr = std::make_shared<Func>(std::forward<F>(func))] { (*ptr)(); };
+    }
+}
+
+}  // namespace detail
+
+}  // namespace opcua
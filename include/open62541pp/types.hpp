@@ -5,6 +5,7 @@
 #include <cassert>
 #include <chrono>
 #include <cstdint>
+#include <cstring>  // memmove
 #include <functional>  // hash
 #include <initializer_list>
 #include <iosfwd>  // forward declare ostream
@@ -1274,6 +1275,8 @@ public:
 
     /**
      * Assign scalar/array to variant (copy and convert if required).
+     * If the variant owns a value of the same pointer-free data type (and the same array length),
+     * the existing storage is reused without reallocation.
      * @param value Value to copy to the variant. It can be:
      *              - A scalar native, wrapper or convertible value.
      *              - A container with native, wrapper or convertible elements.
@@ -1339,6 +1342,37 @@ public:
         setArrayCopyImpl(first, last, type);
     }
 
+    /**
+     * Create a scalar of type `T` in the variant and return a reference to it.
+     * The storage of the current value is reused if the variant owns a scalar of the same type,
+     * otherwise a new scalar is allocated.
+     * @param args Arguments to construct the scalar, the scalar is zero-initialized if omitted
+     *
+     * @code
+     * opcua::Variant var;
+     * while (polling) {
+     *     var.emplaceScalar<int32_t>() = readCounter();  // allocates only once
+     * }
+     * @endcode
+     */
+    template <typename T, typename... Args>
+    T& emplaceScalar(Args&&... args) {
+        assertIsRegistered<T>();
+        assertNoVariant<T>();
+        const auto& type = opcua::getDataType<T>();
+        auto* native = static_cast<T*>(reusableStorage(type, 0));
+        if (native != nullptr) {
+            detail::clear(*native, type);
+        } else {
+            native = detail::allocate<T>(type);
+            setScalarImpl(native, type, UA_VARIANT_DATA);  // move ownership
+        }
+        if constexpr (sizeof...(Args) > 0) {
+            *native = T(std::forward<Args>(args)...);
+        }
+        return *native;
+    }
+
     /// Assign pointer to scalar/array to variant (no copy).
     /// @see assign(T*)
     template <typename T, typename = std::enable_if_t<!isVariant<T>>>
@@ -1419,6 +1453,12 @@ public:
         return !empty() && !isScalar();
     }
 
+    /// Get the hash of the type, array dimensions and values.
+    /// Equal variants (see operator==) have the same hash.
+    size_t hash() const noexcept {
+        return detail::hash(handle(), UA_TYPES[UA_TYPES_VARIANT]);
+    }
+
     /// Check if the variant type is equal to the provided data type.
     bool isType(const UA_DataType* type) const noexcept {
         return (
@@ -1657,6 +1697,16 @@ private:
         static_assert(!isVariant<T>, "Variants cannot directly contain another variant");
     }
 
+    /// Get the owned storage of the current value for in-place assignment.
+    /// Returns `nullptr` if the data type, the array length or the ownership don't match.
+    void* reusableStorage(const UA_DataType& type, size_t arrayLength) noexcept {
+        const auto* native = handle();
+        const bool reusable = native->storageType == UA_VARIANT_DATA && native->type == &type &&
+            native->arrayLength == arrayLength && native->arrayDimensionsSize == 0 &&
+            native->data > UA_EMPTY_ARRAY_SENTINEL;  // NOLINT
+        return reusable ? native->data : nullptr;
+    }
+
     void checkIsScalar() const {
         if (!isScalar()) {
             throw BadVariantAccess("Variant is not a scalar");
@@ -1755,6 +1805,12 @@ void Variant::setArrayImpl(
 
 template <typename T>
 void Variant::setScalarCopyImpl(const T& value, const UA_DataType& type) {
+    if (type.pointerFree) {
+        if (void* storage = reusableStorage(type, 0)) {
+            std::memmove(storage, &value, sizeof(T));  // might be a self-assignment
+            return;
+        }
+    }
     auto native = detail::allocateUniquePtr<T>(type);
     *native = detail::copy(value, type);
     setScalarImpl(native.release(), type, UA_VARIANT_DATA);  // move ownership
@@ -1764,6 +1820,12 @@ template <typename T>
 void Variant::setScalarCopyConvertImpl(const T& value) {
     using Native = typename TypeConverter<T>::NativeType;
     const auto& type = opcua::getDataType<Native>();
+    if constexpr (detail::isPointerFree<Native>) {
+        if (auto* storage = static_cast<Native*>(reusableStorage(type, 0))) {
+            *storage = detail::toNative(value);
+            return;
+        }
+    }
     auto native = detail::allocateUniquePtr<Native>(type);
     *native = detail::toNative(value);
     setScalarImpl(native.release(), type, UA_VARIANT_DATA);  // move ownership
@@ -1773,6 +1835,14 @@ template <typename InputIt>
 void Variant::setArrayCopyImpl(InputIt first, InputIt last, const UA_DataType& type) {
     using ValueType = typename std::iterator_traits<InputIt>::value_type;
     const size_t size = std::distance(first, last);
+    if (type.pointerFree) {
+        if (auto* storage = static_cast<ValueType*>(reusableStorage(type, size))) {
+            std::transform(first, last, storage, [&](const ValueType& value) {
+                return detail::copy(value, type);
+            });
+            return;
+        }
+    }
     auto native = detail::allocateArrayUniquePtr<ValueType>(size, type);
     std::transform(first, last, native.get(), [&](const ValueType& value) {
         return detail::copy(value, type);
@@ -1786,6 +1856,14 @@ void Variant::setArrayCopyConvertImpl(InputIt first, InputIt last) {
     using Native = typename TypeConverter<ValueType>::NativeType;
     const auto& type = opcua::getDataType<Native>();
     const size_t size = std::distance(first, last);
+    if constexpr (detail::isPointerFree<Native>) {
+        if (auto* storage = static_cast<Native*>(reusableStorage(type, size))) {
+            std::transform(first, last, storage, [&](const ValueType& value) {
+                return detail::toNative(value);
+            });
+            return;
+        }
+    }
     auto native = detail::allocateArrayUniquePtr<Native>(size, type);
     std::transform(first, last, native.get(), [&](const ValueType& value) {
         return detail::toNative(value);
@@ -1793,6 +1871,17 @@ void Variant::setArrayCopyConvertImpl(InputIt first, InputIt last) {
     setArrayImpl(native.release(), size, type, UA_VARIANT_DATA);  // move ownership
 }
 
+/// Deep comparison of the type, array dimensions and values.
+/// @relates Variant
+inline bool operator==(const UA_Variant& lhs, const UA_Variant& rhs) noexcept {
+    return detail::isEqual(&lhs, &rhs, UA_TYPES[UA_TYPES_VARIANT]);
+}
+
+/// @relates Variant
+inline bool operator!=(const UA_Variant& lhs, const UA_Variant& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
 /* ------------------------------------------ DataValue ----------------------------------------- */
 
 /**
@@ -2016,8 +2105,26 @@ public:
     StatusCode getStatus() const noexcept {
         return status();
     }
+
+    /// Get the hash of the value, timestamps, picoseconds and status.
+    /// Equal data values (see operator==) have the same hash.
+    size_t hash() const noexcept {
+        return detail::hash(handle(), UA_TYPES[UA_TYPES_DATAVALUE]);
+    }
 };
 
+/// Deep comparison of the value, timestamps, picoseconds and status.
+/// Only the fields marked as set are compared.
+/// @relates DataValue
+inline bool operator==(const UA_DataValue& lhs, const UA_DataValue& rhs) noexcept {
+    return detail::isEqual(&lhs, &rhs, UA_TYPES[UA_TYPES_DATAVALUE]);
+}
+
+/// @relates DataValue
+inline bool operator!=(const UA_DataValue& lhs, const UA_DataValue& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
 /* --------------------------------------- ExtensionObject -------------------------------------- */
 
 /**
@@ -2502,3 +2609,17 @@ struct std::hash<opcua::ExpandedNodeId> {
         return id.hash();
     }
 };
+
+template <>
+struct std::hash<opcua::Variant> {
+    std::size_t operator()(const opcua::Variant& value) const noexcept {
+        return value.hash();
+    }
+};
+
+template <>
+struct std::hash<opcua::DataValue> {
+    std::size_t operator()(const opcua::DataValue& value) const noexcept {
+        return value.hash();
+    }
+};
@@ -0,0 +1,267 @@
+#include "open62541pp/adaptivemonitoring.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // clamp, max, min
+#include <cmath>  // ceil
+#include <utility>  // move
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/client_utils.hpp"  // getLogger
+#include "open62541pp/services/attribute_highlevel.hpp"  // readValue
+#include "open62541pp/services/monitoreditem.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+namespace opcua {
+
+// status code info bits, see https://reference.opcfoundation.org/Core/Part4/v105/docs/7.39.1
+constexpr UA_StatusCode infoTypeDataValue = 0x00000400;
+constexpr UA_StatusCode infoBitsOverflow = 0x00000080;
+
+static bool isOverflow(const DataValue& value) noexcept {
+    if (!value.hasStatus()) {
+        return false;
+    }
+    const UA_StatusCode code = value->status;
+    return (code & infoTypeDataValue) != 0 && (code & infoBitsOverflow) != 0;
+}
+
+AdaptiveMonitoringController::AdaptiveMonitoringController(
+    Subscription<Client> subscription, double publishingInterval, AdaptiveMonitoringOptions options
+)
+    : subscription_(subscription),
+      publishingInterval_(publishingInterval),
+      options_(options),
+      lastEvaluation_(Clock::now()) {
+    if (options_.maxItemsPerCall > 0) {
+        maxItemsPerCall_ = options_.maxItemsPerCall;
+    }
+}
+
+MonitoredItem<Client> AdaptiveMonitoringController::subscribeDataChange(
+    const NodeId& id,
+    AttributeId attribute,
+    const MonitoringParametersEx& parameters,
+    DataChangeNotificationCallback onDataChange
+) {
+    auto& connection = subscription_.connection();
+    const auto result = services::createMonitoredItemDataChange(
+        connection,
+        subscription_.subscriptionId(),
+        ReadValueId(id, attribute),
+        MonitoringMode::Reporting,
+        parameters,
+        callback(std::move(onDataChange)),
+        {}
+    );
+    result.statusCode().throwIfBad();
+    MonitoringParametersEx revised = parameters;
+    revised.queueSize = result.revisedQueueSize();
+    revised.samplingInterval = result.revisedSamplingInterval();
+    addItem(result.monitoredItemId(), revised);
+    return {connection, subscription_.subscriptionId(), result.monitoredItemId()};
+}
+
+void AdaptiveMonitoringController::addItem(
+    IntegerId monitoredItemId, const MonitoringParametersEx& parameters
+) {
+    items_[monitoredItemId].parameters = parameters;
+}
+
+void AdaptiveMonitoringController::removeItem(IntegerId monitoredItemId) {
+    items_.erase(monitoredItemId);
+}
+
+void AdaptiveMonitoringController::notify(IntegerId monitoredItemId, const DataValue& value) {
+    const auto it = items_.find(monitoredItemId);
+    if (it == items_.end()) {
+        return;
+    }
+    ++it->second.notifications;
+    ++metrics_.notifications;
+    if (isOverflow(value)) {
+        ++it->second.overflows;
+        ++metrics_.overflows;
+    }
+}
+
+DataChangeNotificationCallback AdaptiveMonitoringController::callback(
+    DataChangeNotificationCallback onDataChange
+) {
+    return [this, onDataChange = std::move(onDataChange)](
+               IntegerId subId, IntegerId monId, const DataValue& value
+           ) {
+        notify(monId, value);
+        if (onDataChange) {
+            onDataChange(subId, monId, value);
+        }
+    };
+}
+
+std::vector<AdaptiveMonitoringController::Decision> AdaptiveMonitoringController::update(
+    Clock::time_point now
+) {
+    const std::chrono::duration<double, std::milli> elapsed = now - lastEvaluation_;
+    if (elapsed.count() < options_.evaluationInterval || elapsed.count() <= 0.0) {
+        return {};
+    }
+    lastEvaluation_ = now;
+    ++metrics_.evaluations;
+
+    std::vector<Decision> decisions;
+    std::vector<MonitoringParametersEx> requested;
+    for (auto& [id, item] : items_) {
+        if (item.overflows > 0) {
+            const double rate = item.notifications / (elapsed.count() / 1000.0);
+            MonitoringParametersEx parameters = item.parameters;
+            if (adjust(parameters, rate)) {
+                decisions.push_back(
+                    {id,
+                     item.overflows,
+                     rate,
+                     item.parameters.queueSize,
+                     parameters.queueSize,
+                     item.parameters.samplingInterval,
+                     parameters.samplingInterval,
+                     UA_STATUSCODE_GOOD}
+                );
+                requested.push_back(std::move(parameters));
+            } else {
+                ++metrics_.saturatedItems;
+            }
+        }
+        item.notifications = 0;
+        item.overflows = 0;
+    }
+    if (!decisions.empty()) {
+        modify(decisions, requested);
+    }
+    return decisions;
+}
+
+const MonitoringParametersEx* AdaptiveMonitoringController::parameters(
+    IntegerId monitoredItemId
+) const noexcept {
+    const auto it = items_.find(monitoredItemId);
+    return it == items_.end() ? nullptr : &it->second.parameters;
+}
+
+bool AdaptiveMonitoringController::adjust(
+    MonitoringParametersEx& parameters, double notificationRate
+) const {
+    // grow queue to fit the notifications of a publishing interval
+    const uint32_t queueSize = parameters.queueSize;
+    if (queueSize < options_.maxQueueSize) {
+        const double required = notificationRate * publishingInterval_ / 1000.0 * options_.headroom;
+        const double grown = std::max(
+            std::ceil(queueSize * options_.queueGrowthFactor), std::ceil(required)
+        );
+        parameters.queueSize = static_cast<uint32_t>(
+            std::clamp(grown, queueSize + 1.0, static_cast<double>(options_.maxQueueSize))
+        );
+        return true;
+    }
+    // relax sampling interval, special values (0, -1) are replaced by the observed interval
+    double samplingInterval = parameters.samplingInterval;
+    if (samplingInterval <= 0.0) {
+        samplingInterval = notificationRate > 0.0 ? 1000.0 / notificationRate : publishingInterval_;
+    }
+    if (samplingInterval < options_.maxSamplingInterval) {
+        parameters.samplingInterval = std::min(
+            samplingInterval * options_.samplingRelaxFactor, options_.maxSamplingInterval
+        );
+        return true;
+    }
+    return false;
+}
+
+void AdaptiveMonitoringController::modify(
+    Span<Decision> decisions, Span<const MonitoringParametersEx> parameters
+) {
+    auto& connection = subscription_.connection();
+    auto* logger = detail::getLogger(connection.config().handle());
+    const size_t limit = maxItemsPerCall();
+
+    for (size_t first = 0; first < decisions.size();) {
+        // chunk by operation limit, timestamps to return are set per request
+        size_t last = first + 1;
+        while (last < decisions.size() && (limit == 0 || last - first < limit) &&
+               parameters[last].timestamps == parameters[first].timestamps) {
+            ++last;
+        }
+        std::vector<MonitoredItemModifyRequest> items;
+        items.reserve(last - first);
+        for (size_t i = first; i < last; ++i) {
+            const auto& p = parameters[i];
+            items.emplace_back(
+                decisions[i].monitoredItemId,
+                MonitoringParameters(p.samplingInterval, p.filter, p.queueSize, p.discardOldest)
+            );
+        }
+        const auto response = services::modifyMonitoredItems(
+            connection,
+            ModifyMonitoredItemsRequest(
+                {}, subscription_.subscriptionId(), parameters[first].timestamps, items
+            )
+        );
+        ++metrics_.requests;
+
+        const StatusCode serviceResult = response.responseHeader().serviceResult();
+        const auto results = response.results();
+        for (size_t i = first; i < last; ++i) {
+            auto& decision = decisions[i];
+            const size_t index = i - first;
+            if (serviceResult.isBad() || index >= results.size()) {
+                decision.statusCode = serviceResult.isBad()
+                    ? serviceResult
+                    : StatusCode(UA_STATUSCODE_BADUNEXPECTEDERROR);
+            } else {
+                decision.statusCode = results[index].statusCode();
+                decision.revisedQueueSize = results[index].revisedQueueSize();
+                decision.revisedSamplingInterval = results[index].revisedSamplingInterval();
+            }
+            if (decision.statusCode.isGood()) {
+                ++metrics_.modifiedItems;
+                if (const auto it = items_.find(decision.monitoredItemId); it != items_.end()) {
+                    it->second.parameters = parameters[i];
+                    it->second.parameters.queueSize = decision.revisedQueueSize;
+                    it->second.parameters.samplingInterval = decision.revisedSamplingInterval;
+                }
+            } else {
+                ++metrics_.failedItems;
+            }
+            // NOLINTNEXTLINE
+            UA_LOG_INFO(
+                logger,
+                UA_LOGCATEGORY_CLIENT,
+                "Adaptive monitoring: MonitoredItem %u overflows=%u rate=%.1f/s "
+                "queueSize=%u->%u samplingInterval=%.1f->%.1f status=%s",
+                decision.monitoredItemId,
+                decision.overflows,
+                decision.notificationRate,
+                decision.queueSize,
+                decision.revisedQueueSize,
+                decision.samplingInterval,
+                decision.revisedSamplingInterval,
+                decision.statusCode.name().data()
+            );
+        }
+        first = last;
+    }
+}
+
+size_t AdaptiveMonitoringController::maxItemsPerCall() {
+    if (!maxItemsPerCall_.has_value()) {
+        const auto result = services::readValue(
+            subscription_.connection(),
+            NodeId(VariableId::Server_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall)
+        );
+        const bool valid = result && result->isScalar() && result->isType<uint32_t>();
+        maxItemsPerCall_ = valid ? result->scalar<uint32_t>() : 0U;
+    }
+    return maxItemsPerCall_.value();
+}
+
+}  // namespace opcua
+
+#endif
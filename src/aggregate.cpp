@@ -0,0 +1,428 @@
+#include "open62541pp/aggregate.hpp"
+
+#include <algorithm>  // max, min
+#include <cassert>
+#include <cmath>  // abs, sqrt
+#include <limits>
+#include <utility>  // move
+
+#include "open62541pp/detail/types_handling.hpp"  // toDouble
+#include "open62541pp/ua/nodeids.hpp"
+
+namespace opcua {
+
+static DateTime getTimestamp(const DataValue& value) noexcept {
+    if (value.hasSourceTimestamp()) {
+        return value.sourceTimestamp();
+    }
+    if (value.hasServerTimestamp()) {
+        return value.serverTimestamp();
+    }
+    return DateTime::now();
+}
+
+static std::optional<ObjectId> getAggregateFunction(const NodeId& aggregateType) noexcept {
+    const auto* id = aggregateType.identifierIf<uint32_t>();
+    if (aggregateType.namespaceIndex() != 0 || id == nullptr) {
+        return std::nullopt;
+    }
+    return static_cast<ObjectId>(*id);
+}
+
+/* ------------------------------------- AggregateCalculator ------------------------------------ */
+
+bool AggregateCalculator::isSupported(const NodeId& aggregateType) noexcept {
+    switch (getAggregateFunction(aggregateType).value_or(ObjectId{})) {
+    case ObjectId::AggregateFunction_Average:
+    case ObjectId::AggregateFunction_TimeAverage:
+    case ObjectId::AggregateFunction_Minimum:
+    case ObjectId::AggregateFunction_Maximum:
+    case ObjectId::AggregateFunction_Count:
+    case ObjectId::AggregateFunction_StandardDeviationSample:
+    case ObjectId::AggregateFunction_StandardDeviationPopulation:
+    case ObjectId::AggregateFunction_VarianceSample:
+    case ObjectId::AggregateFunction_VariancePopulation:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void AggregateCalculator::reset(DateTime startTime) noexcept {
+    startTime_ = startTime.get();
+    count_ = 0;
+    sum_ = 0.0;
+    min_ = 0.0;
+    max_ = 0.0;
+    mean_ = 0.0;
+    m2_ = 0.0;
+    lastTime_ = startTime_;
+    weightedSum_ = 0.0;
+    weightedDuration_ = 0;
+}
+
+void AggregateCalculator::add(double value, DateTime timestamp) noexcept {
+    ++count_;
+    sum_ += value;
+    if (count_ == 1) {
+        min_ = value;
+        max_ = value;
+    } else {
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+    const double delta = value - mean_;
+    mean_ += delta / count_;
+    m2_ += delta * (value - mean_);
+
+    // samples out of order or before the interval are clamped to the last known time
+    const int64_t time = std::max({timestamp.get(), startTime_, hasLast_ ? lastTime_ : 0});
+    if (hasLast_) {
+        const int64_t duration = time - lastTime_;
+        weightedSum_ += lastValue_ * static_cast<double>(duration);
+        weightedDuration_ += duration;
+    }
+    hasLast_ = true;
+    lastValue_ = value;
+    lastTime_ = time;
+}
+
+bool AggregateCalculator::add(const DataValue& value) noexcept {
+    if (value.status().isBad()) {
+        return false;
+    }
+    const auto number = detail::toDouble(value.value());
+    if (!number.has_value()) {
+        return false;
+    }
+    add(*number, getTimestamp(value));
+    return true;
+}
+
+double AggregateCalculator::variancePopulation() const noexcept {
+    return count_ > 0 ? m2_ / count_ : 0.0;
+}
+
+double AggregateCalculator::varianceSample() const noexcept {
+    return count_ > 1 ? m2_ / (count_ - 1) : 0.0;
+}
+
+double AggregateCalculator::standardDeviationPopulation() const noexcept {
+    return std::sqrt(variancePopulation());
+}
+
+double AggregateCalculator::standardDeviationSample() const noexcept {
+    return std::sqrt(varianceSample());
+}
+
+std::optional<double> AggregateCalculator::timeAverage(DateTime endTime) const noexcept {
+    if (!hasLast_) {
+        return std::nullopt;
+    }
+    const int64_t duration = std::max(endTime.get() - lastTime_, int64_t{0});
+    const int64_t totalDuration = weightedDuration_ + duration;
+    if (totalDuration == 0) {
+        return lastValue_;
+    }
+    const double weightedSum = weightedSum_ + lastValue_ * static_cast<double>(duration);
+    return weightedSum / static_cast<double>(totalDuration);
+}
+
+DataValue AggregateCalculator::result(const NodeId& aggregateType, DateTime endTime) const {
+    auto makeResult = [&](Variant value, StatusCode status) {
+        return DataValue(std::move(value), startTime(), {}, {}, {}, status);
+    };
+    auto makeResultIf = [&](bool hasData, double value) {
+        return hasData ? makeResult(Variant(value), UA_STATUSCODE_GOOD)
+                       : makeResult({}, UA_STATUSCODE_BADNODATA);
+    };
+
+    if (!isSupported(aggregateType)) {
+        return makeResult({}, UA_STATUSCODE_BADAGGREGATENOTSUPPORTED);
+    }
+    switch (*getAggregateFunction(aggregateType)) {
+    case ObjectId::AggregateFunction_Count:
+        return makeResult(Variant(count_), UA_STATUSCODE_GOOD);
+    case ObjectId::AggregateFunction_Average:
+        return makeResultIf(count_ > 0, average());
+    case ObjectId::AggregateFunction_Minimum:
+        return makeResultIf(count_ > 0, minimum());
+    case ObjectId::AggregateFunction_Maximum:
+        return makeResultIf(count_ > 0, maximum());
+    case ObjectId::AggregateFunction_StandardDeviationPopulation:
+        return makeResultIf(count_ > 0, standardDeviationPopulation());
+    case ObjectId::AggregateFunction_StandardDeviationSample:
+        return makeResultIf(count_ > 1, standardDeviationSample());
+    case ObjectId::AggregateFunction_VariancePopulation:
+        return makeResultIf(count_ > 0, variancePopulation());
+    case ObjectId::AggregateFunction_VarianceSample:
+        return makeResultIf(count_ > 1, varianceSample());
+    case ObjectId::AggregateFunction_TimeAverage: {
+        const auto value = timeAverage(endTime);
+        return makeResultIf(value.has_value(), value.value_or(0.0));
+    }
+    default:
+        return makeResult({}, UA_STATUSCODE_BADAGGREGATENOTSUPPORTED);
+    }
+}
+
+/* ------------------------------------ DataChangeAggregator ------------------------------------ */
+
+static constexpr double notANumber = std::numeric_limits<double>::quiet_NaN();
+
+DataChangeAggregator::DataChangeAggregator(
+    double interval, BatchCallback onBatch, DateTime startTime
+)
+    : interval_(std::max(static_cast<int64_t>(interval * UA_DATETIME_MSEC), int64_t{1})),
+      startTime_(startTime.get()),
+      onBatch_(std::move(onBatch)) {}
+
+void DataChangeAggregator::reserve(size_t size) {
+    rows_.reserve(size);
+    subscriptionIds_.reserve(size);
+    ids_.reserve(size);
+    counts_.reserve(size);
+    minimums_.reserve(size);
+    maximums_.reserve(size);
+    means_.reserve(size);
+    lastValues_.reserve(size);
+    lastTimestamps_.reserve(size);
+    downsampledValues_.reserve(size);
+    downsampledTimestamps_.reserve(size);
+    sums_.reserve(size);
+    sumTimes_.reserve(size);
+    firsts_.reserve(size);
+    minimumTimes_.reserve(size);
+    maximumTimes_.reserve(size);
+    candidates_.reserve(size);
+    candidateCounts_.reserve(size);
+    selected_.reserve(size);
+    hasSelected_.reserve(size);
+}
+
+void DataChangeAggregator::addItem(IntegerId subscriptionId, IntegerId monitoredItemId) {
+    findOrAddItem(subscriptionId, monitoredItemId);
+}
+
+size_t DataChangeAggregator::findOrAddItem(IntegerId subscriptionId, IntegerId monitoredItemId) {
+    const size_t row = ids_.size();
+    const auto [it, inserted] = rows_.try_emplace(rowKey(subscriptionId, monitoredItemId), row);
+    if (!inserted) {
+        return it->second;
+    }
+    subscriptionIds_.push_back(subscriptionId);
+    ids_.push_back(monitoredItemId);
+    counts_.push_back(0);
+    minimums_.push_back(notANumber);
+    maximums_.push_back(notANumber);
+    means_.push_back(notANumber);
+    lastValues_.push_back(notANumber);
+    lastTimestamps_.emplace_back();
+    downsampledValues_.push_back(notANumber);
+    downsampledTimestamps_.emplace_back();
+    sums_.push_back(0.0);
+    sumTimes_.push_back(0.0);
+    firsts_.emplace_back();
+    minimumTimes_.push_back(0);
+    maximumTimes_.push_back(0);
+    candidates_.emplace_back();
+    candidateCounts_.push_back(0);
+    selected_.emplace_back();
+    hasSelected_.push_back(0);
+    return row;
+}
+
+template <typename T>
+static void swapRemove(std::vector<T>& column, size_t row) {
+    assert(row < column.size());
+    if (row != column.size() - 1) {
+        column[row] = std::move(column.back());
+    }
+    column.pop_back();
+}
+
+void DataChangeAggregator::removeItem(IntegerId subscriptionId, IntegerId monitoredItemId) {
+    const auto it = rows_.find(rowKey(subscriptionId, monitoredItemId));
+    if (it == rows_.end()) {
+        return;
+    }
+    const size_t row = it->second;
+    rows_.erase(it);
+    sampleCount_ -= counts_[row];
+    if (candidateCounts_[row] > 0) {
+        --pendingCount_;
+    }
+    if (row != ids_.size() - 1) {
+        rows_[rowKey(subscriptionIds_.back(), ids_.back())] = row;
+    }
+    swapRemove(subscriptionIds_, row);
+    swapRemove(ids_, row);
+    swapRemove(counts_, row);
+    swapRemove(minimums_, row);
+    swapRemove(maximums_, row);
+    swapRemove(means_, row);
+    swapRemove(lastValues_, row);
+    swapRemove(lastTimestamps_, row);
+    swapRemove(downsampledValues_, row);
+    swapRemove(downsampledTimestamps_, row);
+    swapRemove(sums_, row);
+    swapRemove(sumTimes_, row);
+    swapRemove(firsts_, row);
+    swapRemove(minimumTimes_, row);
+    swapRemove(maximumTimes_, row);
+    swapRemove(candidates_, row);
+    swapRemove(candidateCounts_, row);
+    swapRemove(selected_, row);
+    swapRemove(hasSelected_, row);
+}
+
+void DataChangeAggregator::add(
+    IntegerId subscriptionId, IntegerId monitoredItemId, double value, DateTime timestamp
+) {
+    const size_t row = findOrAddItem(subscriptionId, monitoredItemId);
+    const int64_t time = timestamp.get();
+    const uint32_t count = ++counts_[row];
+    ++sampleCount_;
+    if (count == 1) {
+        firsts_[row] = {time, value};
+        minimums_[row] = value;
+        maximums_[row] = value;
+        minimumTimes_[row] = time;
+        maximumTimes_[row] = time;
+    } else if (value < minimums_[row]) {
+        minimums_[row] = value;
+        minimumTimes_[row] = time;
+    } else if (value > maximums_[row]) {
+        maximums_[row] = value;
+        maximumTimes_[row] = time;
+    }
+    sums_[row] += value;
+    sumTimes_[row] += static_cast<double>(time - startTime_);
+    lastValues_[row] = value;
+    lastTimestamps_[row] = timestamp;
+}
+
+bool DataChangeAggregator::add(
+    IntegerId subscriptionId, IntegerId monitoredItemId, const DataValue& value
+) {
+    advance(DateTime::now());
+    if (value.status().isBad()) {
+        return false;
+    }
+    const auto number = detail::toDouble(value.value());
+    if (!number.has_value()) {
+        return false;
+    }
+    add(subscriptionId, monitoredItemId, *number, getTimestamp(value));
+    return true;
+}
+
+void DataChangeAggregator::advance(DateTime now) {
+    while (startTime_ + interval_ <= now.get()) {
+        if (sampleCount_ == 0 && pendingCount_ == 0) {
+            // skip idle intervals at once
+            startTime_ += (now.get() - startTime_) / interval_ * interval_;
+            break;
+        }
+        closeInterval();
+    }
+}
+
+std::function<void(IntegerId subId, IntegerId monId, const DataValue& value)>
+DataChangeAggregator::callback() {
+    return [this](IntegerId subId, IntegerId monId, const DataValue& value) {
+        add(subId, monId, value);
+    };
+}
+
+static double triangleArea(
+    int64_t timeA, double valueA, int64_t timeB, double valueB, double timeC, double valueC
+) noexcept {
+    // times relative to point A to preserve precision
+    const auto tb = static_cast<double>(timeB - timeA);
+    const auto tc = timeC - static_cast<double>(timeA);
+    return std::abs(tb * (valueC - valueA) - tc * (valueB - valueA)) / 2.0;
+}
+
+void DataChangeAggregator::closeInterval() {
+    for (size_t row = 0; row < ids_.size(); ++row) {
+        const uint32_t count = counts_[row];
+        means_[row] = count > 0 ? sums_[row] / count : notANumber;
+
+        // select LTTB point of the preceding interval with the mean of this interval as the third
+        // bucket, fallback to the last point of the preceding interval if this interval is empty
+        const auto& candidates = candidates_[row];
+        const uint32_t candidateCount = candidateCounts_[row];
+        if (candidateCount > 0) {
+            const auto& lastCandidate = candidates[candidateCount - 1];
+            const double nextTime = count > 0
+                ? static_cast<double>(startTime_) + sumTimes_[row] / count
+                : static_cast<double>(lastCandidate.time);
+            const double nextValue = count > 0 ? means_[row] : lastCandidate.value;
+            Point best = candidates[0];
+            if (hasSelected_[row] != 0) {
+                const auto& prev = selected_[row];
+                double bestArea = -1.0;
+                for (uint32_t i = 0; i < candidateCount; ++i) {
+                    const auto& c = candidates[i];
+                    const double area = triangleArea(
+                        prev.time, prev.value, c.time, c.value, nextTime, nextValue
+                    );
+                    if (area > bestArea) {
+                        bestArea = area;
+                        best = c;
+                    }
+                }
+            }
+            selected_[row] = best;
+            hasSelected_[row] = 1;
+            downsampledValues_[row] = best.value;
+            downsampledTimestamps_[row] = DateTime(best.time);
+        } else {
+            downsampledValues_[row] = notANumber;
+            downsampledTimestamps_[row] = DateTime();
+        }
+    }
+
+    if (onBatch_) {
+        onBatch_(*this);
+    }
+
+    sampleCount_ = 0;
+    pendingCount_ = 0;
+    for (size_t row = 0; row < ids_.size(); ++row) {
+        // keep first, minimum, maximum and last point (sorted by time) as LTTB candidates
+        const uint32_t count = counts_[row];
+        auto& candidates = candidates_[row];
+        uint32_t candidateCount = 0;
+        if (count > 0) {
+            std::array<Point, 4> points{{
+                firsts_[row],
+                {minimumTimes_[row], minimums_[row]},
+                {maximumTimes_[row], maximums_[row]},
+                {lastTimestamps_[row].get(), lastValues_[row]},
+            }};
+            std::sort(points.begin(), points.end(), [](const Point& lhs, const Point& rhs) {
+                return lhs.time < rhs.time;
+            });
+            for (const auto& point : points) {
+                if (candidateCount == 0 || point.time != candidates[candidateCount - 1].time) {
+                    candidates[candidateCount++] = point;
+                }
+            }
+        }
+        candidateCounts_[row] = candidateCount;
+        if (candidateCount > 0) {
+            ++pendingCount_;
+        }
+
+        counts_[row] = 0;
+        minimums_[row] = notANumber;
+        maximums_[row] = notANumber;
+        sums_[row] = 0.0;
+        sumTimes_[row] = 0.0;
+    }
+    startTime_ += interval_;
+}
+
+}  // namespace opcua
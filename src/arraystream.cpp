@@ -0,0 +1,389 @@
+#include "open62541pp/arraystream.hpp"
+
+#include <algorithm>  // max, min
+#include <cstdint>
+#include <cstring>  // memcpy, memset
+#include <deque>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>  // move, pair
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/open62541/common.h"
+#include "open62541pp/detail/scope.hpp"
+#include "open62541pp/exception.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/services/detail/client_service.hpp"
+
+namespace opcua {
+
+/// Reserve for the encoding overhead of a slice (message header, DataValue, Variant, ...).
+static constexpr size_t sliceOverhead = 256;
+
+static constexpr size_t unknownSize = std::numeric_limits<size_t>::max();
+
+struct ArrayStream::Operation {
+    struct Slice {
+        size_t begin;
+        size_t end;  // exclusive
+    };
+
+    bool active{true};  // false after the transfer returned, ignore late responses
+    StatusCode status;
+    size_t total{0};  // 0 if unknown
+    size_t next{0};  // index after the last element completed in sequence
+    size_t issued{0};  // index after the last issued element
+    size_t limit{unknownSize};  // end of the transfer
+    size_t sliceElements{1};
+    size_t maxPending{1};
+    size_t pending{0};
+    const UA_DataType* expectedType{nullptr};  // type check of read slices
+    std::deque<Slice> retries;  // split slices
+    std::map<size_t, std::pair<size_t, Variant>> completed;  // begin -> (end, chunk)
+
+    std::function<size_t(size_t begin)> sliceEnd;
+    std::function<void(const Slice& slice)> send;
+    std::function<void(size_t offset, Variant& chunk)> deliver;
+    std::function<void(size_t transferred, size_t total)> onProgress;
+
+    bool finished() const noexcept {
+        return pending == 0 && retries.empty() && issued >= limit;
+    }
+
+    void issue();
+    void onResponse(const Slice& slice, StatusCode code, Variant* chunk);
+    void deliverCompleted();
+};
+
+void ArrayStream::Operation::issue() {
+    while (status.isGood() && pending < maxPending) {
+        Slice slice{};
+        if (!retries.empty()) {
+            slice = retries.front();
+            retries.pop_front();
+            if (slice.begin >= limit) {
+                continue;
+            }
+            slice.end = std::min(slice.end, limit);
+        } else if (issued < limit) {
+            slice = {issued, sliceEnd(issued)};
+            issued = slice.end;
+        } else {
+            break;
+        }
+        ++pending;
+        send(slice);
+    }
+}
+
+static bool isTooLarge(StatusCode code) noexcept {
+    return code == UA_STATUSCODE_BADRESPONSETOOLARGE ||
+           code == UA_STATUSCODE_BADREQUESTTOOLARGE ||
+           code == UA_STATUSCODE_BADENCODINGLIMITSEXCEEDED;
+}
+
+void ArrayStream::Operation::onResponse(const Slice& slice, StatusCode code, Variant* chunk) {
+    --pending;
+    if (!active || slice.begin >= limit) {
+        return;
+    }
+    if (code == UA_STATUSCODE_BADINDEXRANGENODATA) {
+        limit = slice.begin;  // end of the array
+        return;
+    }
+    if (isTooLarge(code) && slice.end - slice.begin > 1) {
+        const size_t middle = slice.begin + (slice.end - slice.begin) / 2;
+        retries.push_front({middle, slice.end});
+        retries.push_front({slice.begin, middle});
+        sliceElements = std::max<size_t>(1, sliceElements / 2);
+        return;
+    }
+    if (code.isGood() && chunk != nullptr && !chunk->empty()) {
+        if (!chunk->isArray() || (expectedType != nullptr && !chunk->isType(expectedType))) {
+            code = UA_STATUSCODE_BADTYPEMISMATCH;
+        }
+    }
+    if (code.isBad()) {
+        if (status.isGood()) {
+            status = code;
+        }
+        return;
+    }
+    size_t end = slice.end;
+    Variant value;
+    if (chunk != nullptr) {
+        end = slice.begin + std::min(chunk->arrayLength(), slice.end - slice.begin);
+        if (end < slice.end) {
+            limit = std::min(limit, end);  // short slice -> end of the array
+        }
+        value = std::move(*chunk);
+    }
+    completed.insert_or_assign(slice.begin, std::make_pair(end, std::move(value)));
+}
+
+void ArrayStream::Operation::deliverCompleted() {
+    while (!completed.empty() && completed.begin()->first == next) {
+        auto node = completed.extract(completed.begin());
+        auto& [end, chunk] = node.mapped();
+        if (end > next && deliver) {
+            deliver(next, chunk);
+        }
+        next = end;
+        if (onProgress) {
+            onProgress(next, total);
+        }
+    }
+}
+
+static std::string encodeRange(size_t begin, size_t end) {
+    // single index for a single element, min < max required otherwise
+    return end - begin == 1 ? std::to_string(begin)
+                            : std::to_string(begin) + ":" + std::to_string(end - 1);
+}
+
+static size_t calcSize(const void* element, const UA_DataType& type) noexcept {
+    return std::max<size_t>(1, UA_calcSizeBinary(element, &type));
+}
+
+size_t ArrayStream::sliceBudget(size_t bufferSize) const noexcept {
+    if (options_.maxSliceBytes != 0) {
+        bufferSize = options_.maxSliceBytes;
+    }
+    return bufferSize > sliceOverhead ? bufferSize - sliceOverhead : 0;
+}
+
+ArrayStream::ArrayStream(Client& client, NodeId id, ArrayStreamOptions options)
+    : client_(client),
+      id_(std::move(id)),
+      options_(std::move(options)) {}
+
+size_t ArrayStream::size() {
+    const auto dimensions = services::readArrayDimensions(client_, id_).value();
+    return dimensions.size() == 1 ? dimensions[0] : 0;
+}
+
+ArrayStreamResult ArrayStream::read(const ArrayChunkCallback& onChunk, size_t offset) {
+    auto operation = std::make_shared<Operation>();
+    operation->deliver = onChunk;
+    return readSlices(operation, nullptr, 0, offset);
+}
+
+ArrayStreamResult ArrayStream::readInto(
+    void* buffer, size_t size, const UA_DataType& type, size_t offset
+) {
+    auto operation = std::make_shared<Operation>();
+    operation->expectedType = &type;
+    operation->deliver = [buffer, &type](size_t index, Variant& chunk) {
+        // move the elements to the buffer, the chunk is cleared with zeroed (empty) elements
+        auto* dst = static_cast<uint8_t*>(buffer) + index * type.memSize;
+        auto* src = static_cast<uint8_t*>(chunk.data());
+        const size_t length = chunk.arrayLength();
+        if (!type.pointerFree) {
+            for (size_t i = 0; i < length; ++i) {
+                UA_clear(dst + i * type.memSize, &type);
+            }
+        }
+        std::memcpy(dst, src, length * type.memSize);
+        std::memset(src, 0, length * type.memSize);
+    };
+    return readSlices(operation, &type, size, offset);
+}
+
+ArrayStreamResult ArrayStream::readSlices(
+    const std::shared_ptr<Operation>& operation,
+    const UA_DataType* type,
+    size_t size,
+    size_t offset
+) {
+    operation->next = offset;
+    operation->issued = offset;
+    operation->limit = type != nullptr ? size : unknownSize;
+    operation->onProgress = options_.onProgress;
+    if (offset >= operation->limit) {
+        return {UA_STATUSCODE_GOOD, operation->limit};
+    }
+
+    // probe the first element and the array dimensions to size the slices
+    const String probeRange(encodeRange(offset, offset + 1));
+    UA_ReadValueId items[2]{};  // NOLINT(*-avoid-c-arrays)
+    items[0].nodeId = *id_.handle();
+    items[0].attributeId = UA_ATTRIBUTEID_VALUE;
+    items[0].indexRange = *probeRange.handle();
+    items[1].nodeId = *id_.handle();
+    items[1].attributeId = UA_ATTRIBUTEID_ARRAYDIMENSIONS;
+    UA_ReadRequest request{};
+    request.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
+    request.nodesToReadSize = 2;
+    request.nodesToRead = items;  // NOLINT(*-array-to-pointer-decay)
+    auto response = services::detail::sendRequest<UA_ReadRequest, ReadResponse>(client_, request);
+    if (response.responseHeader().serviceResult().isBad()) {
+        return {response.responseHeader().serviceResult(), offset};
+    }
+    if (response.results().size() != 2) {
+        return {UA_STATUSCODE_BADUNEXPECTEDERROR, offset};
+    }
+    auto& probe = response.results()[0];
+    if (probe.status() == UA_STATUSCODE_BADINDEXRANGENODATA) {
+        return {UA_STATUSCODE_GOOD, offset};  // end of the array
+    }
+    if (probe.status().isBad()) {
+        return {probe.status(), offset};
+    }
+    Variant& sample = probe.value();
+    if (!sample.isArray() || sample.arrayLength() == 0 || sample.type() == nullptr) {
+        return {UA_STATUSCODE_BADTYPEMISMATCH, offset};
+    }
+    if (type != nullptr && !sample.isType(type)) {
+        return {UA_STATUSCODE_BADTYPEMISMATCH, offset};
+    }
+    const auto& dimensions = response.results()[1];
+    if (dimensions.status().isGood() && dimensions.value().isType<uint32_t>() &&
+        dimensions.value().arrayLength() == 1) {
+        const size_t total = *static_cast<const uint32_t*>(dimensions.value().data());
+        if (total > 0) {
+            operation->total = total;
+            operation->limit = std::min(operation->limit, total);
+        }
+    }
+    if (type != nullptr && operation->total == 0) {
+        operation->total = size;
+    }
+
+    // size estimation of variable-size elements with a safety margin
+    const UA_DataType& sampleType = *sample.type();
+    const size_t elementBytes =
+        calcSize(sample.data(), sampleType) * (sampleType.pointerFree ? 1 : 2);
+    const size_t budget = sliceBudget(client_.config()->localConnectionConfig.recvBufferSize);
+    operation->sliceElements = std::max<size_t>(1, budget / elementBytes);
+    operation->sliceEnd = [op = operation.get()](size_t begin) {
+        return begin + std::min(op->sliceElements, op->limit - begin);
+    };
+    operation->send = [this, op = std::weak_ptr<Operation>(operation)](const auto& slice) {
+        const String range(encodeRange(slice.begin, slice.end));
+        UA_ReadValueId item{};
+        item.nodeId = *id_.handle();
+        item.attributeId = UA_ATTRIBUTEID_VALUE;
+        item.indexRange = *range.handle();
+        UA_ReadRequest request{};
+        request.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
+        request.nodesToReadSize = 1;
+        request.nodesToRead = &item;
+        services::detail::sendRequestAsync<UA_ReadRequest, UA_ReadResponse>(
+            client_,
+            request,
+            [op = op.lock(), slice](UA_ReadResponse& response) {
+                StatusCode code = response.responseHeader.serviceResult;
+                Variant* chunk = nullptr;
+                if (code.isGood() && response.resultsSize != 1) {
+                    code = UA_STATUSCODE_BADUNEXPECTEDERROR;
+                } else if (code.isGood()) {
+                    auto& result = asWrapper<DataValue>(response.results[0]);
+                    code = result.status();
+                    chunk = &result.value();
+                }
+                op->onResponse(slice, code, chunk);
+            }
+        );
+    };
+    return run(*operation);
+}
+
+ArrayStreamResult ArrayStream::write(
+    const void* data, size_t size, const UA_DataType& type, size_t offset
+) {
+    auto operation = std::make_shared<Operation>();
+    operation->next = offset;
+    operation->issued = offset;
+    operation->limit = size;
+    operation->total = size;
+    operation->onProgress = options_.onProgress;
+    if (offset >= size) {
+        return {UA_STATUSCODE_GOOD, size};
+    }
+
+    const auto* elements = static_cast<const uint8_t*>(data);
+    const size_t budget = sliceBudget(client_.config()->localConnectionConfig.sendBufferSize);
+    if (type.pointerFree) {
+        operation->sliceElements = std::max<size_t>(1, budget / calcSize(elements, type));
+        operation->sliceEnd = [op = operation.get()](size_t begin) {
+            return begin + std::min(op->sliceElements, op->limit - begin);
+        };
+    } else {
+        // exact slicing of variable-size elements
+        operation->sliceElements = unknownSize;
+        operation->sliceEnd = [op = operation.get(), elements, &type, budget](size_t begin) {
+            const size_t maxEnd = begin + std::min(op->sliceElements, op->limit - begin);
+            size_t end = begin;
+            size_t bytes = 0;
+            while (end < maxEnd) {
+                bytes += calcSize(elements + end * type.memSize, type);
+                if (bytes > budget && end > begin) {
+                    break;
+                }
+                ++end;
+            }
+            return end;
+        };
+    }
+    operation->send = [this, op = std::weak_ptr<Operation>(operation), elements, &type](
+                          const auto& slice
+                      ) {
+        const String range(encodeRange(slice.begin, slice.end));
+        UA_WriteValue item{};
+        item.nodeId = *id_.handle();
+        item.attributeId = UA_ATTRIBUTEID_VALUE;
+        item.indexRange = *range.handle();
+        item.value.hasValue = true;
+        UA_Variant_setArray(
+            &item.value.value,
+            const_cast<uint8_t*>(elements + slice.begin * type.memSize),  // NOLINT
+            slice.end - slice.begin,
+            &type
+        );
+        item.value.value.storageType = UA_VARIANT_DATA_NODELETE;
+        UA_WriteRequest request{};
+        request.nodesToWriteSize = 1;
+        request.nodesToWrite = &item;
+        services::detail::sendRequestAsync<UA_WriteRequest, UA_WriteResponse>(
+            client_,
+            request,
+            [op = op.lock(), slice](UA_WriteResponse& response) {
+                StatusCode code = response.responseHeader.serviceResult;
+                if (code.isGood()) {
+                    code = response.resultsSize == 1
+                        ? StatusCode(response.results[0])
+                        : StatusCode(UA_STATUSCODE_BADUNEXPECTEDERROR);
+                }
+                op->onResponse(slice, code, nullptr);
+            }
+        );
+    };
+    return run(*operation);
+}
+
+ArrayStreamResult ArrayStream::run(Operation& operation) {
+    const detail::ScopeExit deactivate([&] { operation.active = false; });
+    operation.maxPending = std::max<size_t>(1, options_.maxPendingRequests);
+    try {
+        while (true) {
+            operation.issue();
+            // failed initiations of async requests are stored in the exception catcher
+            detail::getExceptionCatcher(client_).rethrow();
+            operation.deliverCompleted();
+            if (operation.status.isBad() || operation.finished()) {
+                break;
+            }
+            client_.runIterate(options_.iterateTimeout);
+        }
+    } catch (const BadStatus& e) {
+        if (operation.status.isGood()) {
+            operation.status = e.code();
+        }
+    }
+    operation.deliverCompleted();
+    return {operation.status, operation.next};
+}
+
+}  // namespace opcua
@@ -471,6 +471,64 @@ std::vector<Subscription<Client>> Client::subscriptions() {
 }
 #endif
 
+static void removeTimerCallback(UA_Client* client, uint64_t callbackId) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    UA_Client_removeCallback(client, callbackId);
+#else
+    UA_Client_removeRepeatedCallback(client, callbackId);
+#endif
+}
+
+static void timerCallback(UA_Client* client, void* data) noexcept {
+    auto* context = detail::getContext(client);
+    if (context == nullptr) {
+        return;
+    }
+    context->timers.process(data, context->exceptionCatcher, [client](uint64_t callbackId) {
+        removeTimerCallback(client, callbackId);
+    });
+}
+
+TimerId Client::addTimer(
+    std::chrono::milliseconds interval, bool once, TimerCallback&& callback
+) {
+    auto* client = handle();
+    auto addNative = [client](void* data, double intervalMs, [[maybe_unused]] bool onceOnly) {
+        UA_UInt64 callbackId = 0;
+#if UAPP_OPEN62541_VER_GE(1, 1)
+        if (onceOnly) {
+            const auto date = UA_DateTime_nowMonotonic() +
+                              static_cast<UA_DateTime>(intervalMs * UA_DATETIME_MSEC);
+            throwIfBad(UA_Client_addTimedCallback(client, timerCallback, data, date, &callbackId));
+            return callbackId;
+        }
+#endif
+        throwIfBad(
+            UA_Client_addRepeatedCallback(client, timerCallback, data, intervalMs, &callbackId)
+        );
+        return callbackId;
+    };
+    auto removeNative = [client](uint64_t callbackId) { removeTimerCallback(client, callbackId); };
+    return context().timers.add(
+        static_cast<double>(interval.count()), once, std::move(callback), addNative, removeNative
+    );
+}
+
+bool Client::cancelTimer(TimerId id) {
+    auto* client = handle();
+    return context().timers.remove(id, [client](uint64_t callbackId) {
+        removeTimerCallback(client, callbackId);
+    });
+}
+
+TimerStatistics Client::timerStatistics(TimerId id) const {
+    const auto statistics = context().timers.statistics(id);
+    if (!statistics.has_value()) {
+        throw BadStatus(UA_STATUSCODE_BADNOTFOUND);
+    }
+    return *statistics;
+}
+
 void Client::runIterate(uint16_t timeoutMilliseconds) {
     throwIfBad(UA_Client_run_iterate(handle(), timeoutMilliseconds));
     context().exceptionCatcher.rethrow();
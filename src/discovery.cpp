@@ -0,0 +1,236 @@
+#include "open62541pp/discovery.hpp"
+
+#include <algorithm>  // clamp, max, min
+#include <atomic>
+#include <cmath>  // pow
+#include <random>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>  // move
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/detail/open62541/client.h"
+#include "open62541pp/exception.hpp"
+
+namespace opcua {
+
+using Clock = std::chrono::steady_clock;
+
+/// Time to wait for network events of all connecting clients per pass of `connectClients`.
+static constexpr std::chrono::milliseconds pollInterval{10};
+
+/* ------------------------------------------ Discovery ----------------------------------------- */
+
+static void discoverTarget(DiscoveryResult& result, const DiscoveryOptions& options) {
+    const auto deadline = Clock::now() + std::chrono::milliseconds(options.timeout);
+    auto remainingTimeout = [&] {
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - Clock::now()
+        );
+        if (remaining.count() <= 0) {
+            throw BadStatus(UA_STATUSCODE_BADTIMEOUT);
+        }
+        return static_cast<uint32_t>(remaining.count());
+    };
+
+    try {
+        Client client;
+        if (options.findServers) {
+            client.config().setTimeout(remainingTimeout());
+            result.servers = client.findServers(result.serverUrl);
+        }
+        if (options.getEndpoints) {
+            client.config().setTimeout(remainingTimeout());
+            result.endpoints = client.getEndpoints(result.serverUrl);
+        }
+    } catch (const BadStatus& e) {
+        result.status = e.code();
+    } catch (const std::exception&) {
+        result.status = UA_STATUSCODE_BADINTERNALERROR;
+    }
+}
+
+std::vector<DiscoveryResult> discover(
+    Span<const std::string> serverUrls, const DiscoveryOptions& options
+) {
+    std::vector<DiscoveryResult> results(serverUrls.size());
+    for (size_t i = 0; i < serverUrls.size(); ++i) {
+        results[i].serverUrl = serverUrls[i];
+    }
+
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (size_t i = next++; i < results.size(); i = next++) {
+            discoverTarget(results[i], options);
+        }
+    };
+
+    // the calling thread is one of the workers
+    const size_t workerCount = std::min(
+        std::max<size_t>(options.maxConcurrency, 1), results.size()
+    );
+    std::vector<std::thread> threads;
+    threads.reserve(workerCount);
+    try {
+        for (size_t i = 1; i < workerCount; ++i) {
+            threads.emplace_back(worker);
+        }
+    } catch (const std::system_error&) {  // NOLINT(bugprone-empty-catch)
+        // continue with less workers
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return results;
+}
+
+std::future<std::vector<DiscoveryResult>> discoverAsync(
+    std::vector<std::string> serverUrls, const DiscoveryOptions& options
+) {
+    return std::async(std::launch::async, [urls = std::move(serverUrls), options] {
+        return discover(urls, options);
+    });
+}
+
+/* --------------------------------------- Connection storm ------------------------------------- */
+
+static bool isSessionActivated(Client& client) noexcept {
+#if UAPP_OPEN62541_VER_LE(1, 0)
+    return UA_Client_getState(client.handle()) == UA_CLIENTSTATE_SESSION;
+#else
+    UA_SessionState sessionState{};
+    UA_Client_getState(client.handle(), nullptr, &sessionState, nullptr);
+    return sessionState == UA_SESSIONSTATE_ACTIVATED;
+#endif
+}
+
+static StatusCode getConnectStatus([[maybe_unused]] Client& client) noexcept {
+#if UAPP_OPEN62541_VER_LE(1, 0)
+    return UA_STATUSCODE_GOOD;
+#else
+    UA_StatusCode connectStatus{};
+    UA_Client_getState(client.handle(), nullptr, nullptr, &connectStatus);
+    return connectStatus;
+#endif
+}
+
+namespace {
+
+enum class ConnectPhase : uint8_t { Waiting, Connecting, Done };
+
+struct ConnectSlot {
+    ConnectPhase phase{ConnectPhase::Waiting};
+    size_t attempts{0};
+    Clock::time_point time;  // start of the next attempt or deadline of the current attempt
+    StatusCode status{UA_STATUSCODE_BADNOTCONNECTED};
+};
+
+}  // namespace
+
+std::vector<StatusCode> connectClients(
+    Span<Client* const> clients, Span<const std::string> endpointUrls, const ConnectOptions& options
+) {
+    if (endpointUrls.size() != 1 && endpointUrls.size() != clients.size()) {
+        throw std::invalid_argument("Number of endpoint URLs must be 1 or the number of clients");
+    }
+    const size_t maxConcurrency = std::max<size_t>(options.maxConcurrency, 1);
+    const size_t maxAttempts = std::max<size_t>(options.maxAttempts, 1);
+    const double jitter = std::clamp(options.jitter, 0.0, 1.0);
+
+    std::mt19937 rng(std::random_device{}());
+    std::uniform_real_distribution<double> jitterDistribution(1.0 - jitter, 1.0);
+    auto backoff = [&](size_t attempts) {
+        const double exponential = static_cast<double>(options.initialBackoff.count()) *
+            std::pow(2.0, static_cast<double>(attempts - 1));
+        const double delay = std::min(exponential, static_cast<double>(options.maxBackoff.count()));
+        return std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double, std::milli>(delay * jitterDistribution(rng))
+        );
+    };
+
+    std::vector<ConnectSlot> slots(clients.size());
+    size_t active = 0;
+    size_t done = 0;
+
+    auto complete = [&](ConnectSlot& slot, StatusCode status) {
+        slot.phase = ConnectPhase::Done;
+        slot.status = status;
+        ++done;
+    };
+
+    auto fail = [&](Client& client, ConnectSlot& slot, StatusCode status, Clock::time_point now) {
+        try {
+            client.disconnect();
+        } catch (const BadStatus&) {  // NOLINT(bugprone-empty-catch)
+            // ignore, the client is reconnected or given up anyway
+        }
+        if (slot.attempts >= maxAttempts) {
+            complete(slot, status);
+            return;
+        }
+        slot.phase = ConnectPhase::Waiting;
+        slot.status = status;
+        slot.time = now + backoff(slot.attempts);
+    };
+
+    while (done < clients.size()) {
+        const auto now = Clock::now();
+        // spread the poll interval over the connecting clients instead of busy polling
+        const auto iterateTimeout = static_cast<uint16_t>(
+            active > 0 ? pollInterval.count() / static_cast<int64_t>(active) : 0
+        );
+        for (size_t i = 0; i < clients.size(); ++i) {
+            auto& client = *clients[i];
+            auto& slot = slots[i];
+            if (slot.phase == ConnectPhase::Waiting) {
+                if (active >= maxConcurrency || now < slot.time) {
+                    continue;
+                }
+                ++slot.attempts;
+                try {
+                    client.connectAsync(endpointUrls[endpointUrls.size() == 1 ? 0 : i]);
+                    slot.phase = ConnectPhase::Connecting;
+                    slot.time = now + options.timeout;
+                    ++active;
+                } catch (const BadStatus& e) {
+                    fail(client, slot, e.code(), now);
+                }
+            } else if (slot.phase == ConnectPhase::Connecting) {
+                StatusCode status = UA_STATUSCODE_GOOD;
+                try {
+                    client.runIterate(iterateTimeout);
+                    status = getConnectStatus(client);
+                } catch (const BadStatus& e) {
+                    status = e.code();
+                }
+                if (status.isGood() && isSessionActivated(client)) {
+                    --active;
+                    complete(slot, UA_STATUSCODE_GOOD);
+                } else if (status.isBad()) {
+                    --active;
+                    fail(client, slot, status, now);
+                } else if (now >= slot.time) {
+                    --active;
+                    fail(client, slot, UA_STATUSCODE_BADTIMEOUT, now);
+                }
+            }
+        }
+        if ((active == 0 || iterateTimeout == 0) && done < clients.size()) {
+            // all remaining clients are waiting for their backoff or the poll interval is too short
+            // for the number of connecting clients
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    std::vector<StatusCode> result;
+    result.reserve(slots.size());
+    for (const auto& slot : slots) {
+        result.push_back(slot.status);
+    }
+    return result;
+}
+
+}  // namespace opcua
@@ -0,0 +1,405 @@
+#include "open62541pp/eventfilter.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // equal, find_if
+#include <cstddef>
+
+#include "open62541pp/detail/string_utils.hpp"  // toStringView
+#include "open62541pp/detail/types_handling.hpp"  // toDouble
+
+namespace opcua {
+
+static bool isSameOperand(
+    const SimpleAttributeOperand& lhs, const SimpleAttributeOperand& rhs
+) noexcept {
+    const auto lhsPath = lhs.browsePath();
+    const auto rhsPath = rhs.browsePath();
+    return lhs.attributeId() == rhs.attributeId() &&
+        std::equal(lhsPath.begin(), lhsPath.end(), rhsPath.begin(), rhsPath.end()) &&
+        lhs.indexRange() == rhs.indexRange();
+}
+
+static void checkOperandCount(FilterOperator filterOperator, size_t count) {
+    bool valid = false;
+    switch (filterOperator) {
+    case FilterOperator::IsNull:
+    case FilterOperator::Not:
+    case FilterOperator::OfType:
+        valid = count == 1;
+        break;
+    case FilterOperator::Equals:
+    case FilterOperator::GreaterThan:
+    case FilterOperator::LessThan:
+    case FilterOperator::GreaterThanOrEqual:
+    case FilterOperator::LessThanOrEqual:
+    case FilterOperator::Like:
+    case FilterOperator::And:
+    case FilterOperator::Or:
+        valid = count == 2;
+        break;
+    case FilterOperator::Between:
+        valid = count == 3;
+        break;
+    case FilterOperator::InList:
+        valid = count >= 2;
+        break;
+    default:
+        throw BadStatus(UA_STATUSCODE_BADFILTEROPERATORUNSUPPORTED);
+    }
+    if (!valid) {
+        throw BadStatus(UA_STATUSCODE_BADFILTEROPERANDCOUNTMISMATCH);
+    }
+}
+
+EventFilterEvaluator::EventFilterEvaluator(const EventFilter& filter)
+    : filter_(filter) {
+    const auto filterSelectClauses = filter.selectClauses();
+    std::vector<SimpleAttributeOperand> selectClauses(
+        filterSelectClauses.begin(), filterSelectClauses.end()
+    );
+
+    auto findOrAddSelectClause = [&](const SimpleAttributeOperand& operand) -> size_t {
+        const auto it = std::find_if(
+            selectClauses.begin(),
+            selectClauses.end(),
+            [&](const auto& selectClause) { return isSameOperand(selectClause, operand); }
+        );
+        if (it == selectClauses.end()) {
+            selectClauses.push_back(operand);
+            return selectClauses.size() - 1;
+        }
+        return static_cast<size_t>(it - selectClauses.begin());
+    };
+
+    auto compileOperand = [&](const ExtensionObject& operand, size_t elementIndex) -> Operand {
+        if (const auto* element = operand.decodedData<ElementOperand>()) {
+            // only forward references are allowed to prevent cycles
+            if (element->index() <= elementIndex ||
+                element->index() >= filter.whereClause().elements().size()) {
+                throw BadStatus(UA_STATUSCODE_BADFILTEROPERANDINVALID);
+            }
+            return {OperandKind::Element, element->index()};
+        }
+        if (const auto* literal = operand.decodedData<LiteralOperand>()) {
+            literals_.push_back(literal->value());
+            return {OperandKind::Literal, literals_.size() - 1};
+        }
+        if (const auto* attribute = operand.decodedData<SimpleAttributeOperand>()) {
+            return {OperandKind::Field, findOrAddSelectClause(*attribute)};
+        }
+        throw BadStatus(UA_STATUSCODE_BADFILTEROPERANDINVALID);
+    };
+
+    const auto elements = filter.whereClause().elements();
+    elements_.reserve(elements.size());
+    for (size_t i = 0; i < elements.size(); ++i) {
+        const auto operands = elements[i].filterOperands();
+        checkOperandCount(elements[i].filterOperator(), operands.size());
+        Element& compiled = elements_.emplace_back();
+        compiled.filterOperator = elements[i].filterOperator();
+        compiled.operands.reserve(operands.size());
+        for (const auto& operand : operands) {
+            compiled.operands.push_back(compileOperand(operand, i));
+        }
+        if (compiled.filterOperator == FilterOperator::OfType) {
+            // compare with the EventType field of the event
+            const QualifiedName eventType(0, "EventType");
+            compiled.operands.push_back(
+                {OperandKind::Field,
+                 findOrAddSelectClause(SimpleAttributeOperand(
+                     ObjectTypeId::BaseEventType, {&eventType, 1}, AttributeId::Value
+                 ))}
+            );
+        }
+    }
+
+    if (selectClauses.size() != filterSelectClauses.size()) {
+        filter_ = EventFilter(selectClauses, filter.whereClause());
+    }
+}
+
+/// Resolved operand value, boolean results of sub-elements are stored inline.
+class EventFilterEvaluator::OperandValue {
+public:
+    OperandValue() = default;
+    OperandValue(const OperandValue&) = delete;
+    OperandValue& operator=(const OperandValue&) = delete;
+
+    const Variant* get() const noexcept {
+        return value_;
+    }
+
+    void set(const Variant* value) noexcept {
+        value_ = value;
+    }
+
+    void setBoolean(bool value) noexcept {
+        boolean_ = value;
+        variant_.type = &UA_TYPES[UA_TYPES_BOOLEAN];
+        variant_.data = &boolean_;
+        value_ = asWrapper<Variant>(&variant_);
+    }
+
+    bool isNull() const noexcept {
+        return value_ == nullptr || value_->empty();
+    }
+
+private:
+    UA_Boolean boolean_{false};
+    UA_Variant variant_{};
+    const Variant* value_{nullptr};
+};
+
+void EventFilterEvaluator::resolve(
+    const Operand& operand, Span<const Variant> eventFields, OperandValue& value
+) const noexcept {
+    switch (operand.kind) {
+    case OperandKind::Element:
+        value.setBoolean(evaluateElement(operand.index, eventFields));
+        break;
+    case OperandKind::Literal:
+        value.set(&literals_[operand.index]);
+        break;
+    case OperandKind::Field:
+        value.set(operand.index < eventFields.size() ? &eventFields[operand.index] : nullptr);
+        break;
+    }
+}
+
+template <typename T>
+static int compareValues(const T& lhs, const T& rhs) noexcept {
+    return lhs < rhs ? -1 : (rhs < lhs ? 1 : 0);
+}
+
+static std::optional<std::string_view> getStringView(const Variant& value) noexcept {
+    if (!value.isScalar()) {
+        return std::nullopt;
+    }
+    if (value.isType<String>() || value.isType<ByteString>()) {
+        return detail::toStringView(*static_cast<const UA_String*>(value.data()));
+    }
+    if (value.isType<LocalizedText>()) {
+        return detail::toStringView(static_cast<const UA_LocalizedText*>(value.data())->text);
+    }
+    return std::nullopt;
+}
+
+/// Compare two scalar values, `std::nullopt` if the values are null or not comparable.
+static std::optional<int> compare(const Variant* lhs, const Variant* rhs) noexcept {
+    if (lhs == nullptr || rhs == nullptr || !lhs->isScalar() || !rhs->isScalar()) {
+        return std::nullopt;
+    }
+    // numeric values are compared independent of the data type
+    const auto lhsNumber = detail::toDouble(*lhs);
+    const auto rhsNumber = detail::toDouble(*rhs);
+    if (lhsNumber.has_value() && rhsNumber.has_value()) {
+        return compareValues(*lhsNumber, *rhsNumber);
+    }
+    const auto lhsString = getStringView(*lhs);
+    const auto rhsString = getStringView(*rhs);
+    if (lhsString.has_value() && rhsString.has_value()) {
+        return compareValues(*lhsString, *rhsString);
+    }
+    if (lhs->type() != rhs->type()) {
+        return std::nullopt;
+    }
+    const void* lhsData = lhs->data();
+    const void* rhsData = rhs->data();
+    switch (lhs->type()->typeKind) {
+    case UA_DATATYPEKIND_DATETIME:
+        return compareValues(
+            *static_cast<const UA_DateTime*>(lhsData), *static_cast<const UA_DateTime*>(rhsData)
+        );
+    case UA_DATATYPEKIND_STATUSCODE:
+        return compareValues(
+            *static_cast<const UA_StatusCode*>(lhsData),
+            *static_cast<const UA_StatusCode*>(rhsData)
+        );
+    case UA_DATATYPEKIND_NODEID: {
+        const auto order = UA_NodeId_order(
+            static_cast<const UA_NodeId*>(lhsData), static_cast<const UA_NodeId*>(rhsData)
+        );
+        return order == UA_ORDER_LESS ? -1 : (order == UA_ORDER_MORE ? 1 : 0);
+    }
+    case UA_DATATYPEKIND_GUID:
+        if (UA_Guid_equal(
+                static_cast<const UA_Guid*>(lhsData), static_cast<const UA_Guid*>(rhsData)
+            )) {
+            return 0;
+        }
+        return std::nullopt;
+    case UA_DATATYPEKIND_QUALIFIEDNAME: {
+        const auto& lhsName = *static_cast<const UA_QualifiedName*>(lhsData);
+        const auto& rhsName = *static_cast<const UA_QualifiedName*>(rhsData);
+        if (lhsName.namespaceIndex != rhsName.namespaceIndex) {
+            return compareValues(lhsName.namespaceIndex, rhsName.namespaceIndex);
+        }
+        return compareValues(
+            detail::toStringView(lhsName.name), detail::toStringView(rhsName.name)
+        );
+    }
+    default:
+        return std::nullopt;
+    }
+}
+
+/// Match a single pattern token of the Like operator and advance the pattern position.
+static bool matchLikeToken(char c, std::string_view pattern, size_t& pos) noexcept {
+    const char token = pattern[pos];
+    if (token == '\\' && pos + 1 < pattern.size()) {
+        pos += 2;
+        return c == pattern[pos - 1];
+    }
+    if (token == '_') {
+        ++pos;
+        return true;
+    }
+    if (token == '[') {
+        const size_t end = pattern.find(']', pos + 1);
+        if (end != std::string_view::npos) {
+            const bool negate = pos + 1 < end && pattern[pos + 1] == '^';
+            bool found = false;
+            for (size_t i = pos + 1 + (negate ? 1 : 0); i < end; ++i) {
+                if (i + 2 < end && pattern[i + 1] == '-') {
+                    found |= c >= pattern[i] && c <= pattern[i + 2];
+                    i += 2;
+                } else {
+                    found |= c == pattern[i];
+                }
+            }
+            pos = end + 1;
+            return found != negate;
+        }
+    }
+    ++pos;
+    return c == token;
+}
+
+/// Pattern matching of the Like operator with wildcards `%`, `_`, `[]`, `[^]` and `\` escapes.
+/// @see https://reference.opcfoundation.org/Core/Part4/v105/docs/7.7.3
+static bool matchLike(std::string_view str, std::string_view pattern) noexcept {
+    size_t s = 0;
+    size_t p = 0;
+    size_t wildcardPattern = std::string_view::npos;
+    size_t wildcardString = 0;
+    while (s < str.size()) {
+        if (p < pattern.size() && pattern[p] == '%') {
+            wildcardPattern = p++;
+            wildcardString = s;
+            continue;
+        }
+        size_t next = p;
+        if (p < pattern.size() && matchLikeToken(str[s], pattern, next)) {
+            p = next;
+            ++s;
+            continue;
+        }
+        if (wildcardPattern == std::string_view::npos) {
+            return false;
+        }
+        // backtrack: let the last % consume one more character
+        p = wildcardPattern + 1;
+        s = ++wildcardString;
+    }
+    while (p < pattern.size() && pattern[p] == '%') {
+        ++p;
+    }
+    return p == pattern.size();
+}
+
+static bool toBoolean(const Variant* value) noexcept {
+    if (value == nullptr) {
+        return false;
+    }
+    const auto number = detail::toDouble(*value);
+    return number.has_value() && *number != 0.0;
+}
+
+bool EventFilterEvaluator::evaluate(Span<const Variant> eventFields) const noexcept {
+    return elements_.empty() || evaluateElement(0, eventFields);
+}
+
+bool EventFilterEvaluator::evaluateElement(
+    size_t index, Span<const Variant> eventFields
+) const noexcept {
+    const auto& element = elements_[index];
+    const auto& operands = element.operands;
+    OperandValue first;
+    resolve(operands[0], eventFields, first);
+
+    auto compareWith = [&](size_t operandIndex) {
+        OperandValue other;
+        resolve(operands[operandIndex], eventFields, other);
+        return compare(first.get(), other.get());
+    };
+
+    switch (element.filterOperator) {
+    case FilterOperator::IsNull:
+        return first.isNull();
+    case FilterOperator::Not:
+        return !toBoolean(first.get());
+    case FilterOperator::And: {
+        if (!toBoolean(first.get())) {
+            return false;
+        }
+        OperandValue second;
+        resolve(operands[1], eventFields, second);
+        return toBoolean(second.get());
+    }
+    case FilterOperator::Or: {
+        if (toBoolean(first.get())) {
+            return true;
+        }
+        OperandValue second;
+        resolve(operands[1], eventFields, second);
+        return toBoolean(second.get());
+    }
+    case FilterOperator::Equals:
+        return compareWith(1).value_or(-1) == 0;
+    case FilterOperator::GreaterThan:
+        return compareWith(1).value_or(0) > 0;
+    case FilterOperator::LessThan:
+        return compareWith(1).value_or(0) < 0;
+    case FilterOperator::GreaterThanOrEqual:
+        return compareWith(1).value_or(-1) >= 0;
+    case FilterOperator::LessThanOrEqual:
+        return compareWith(1).value_or(1) <= 0;
+    case FilterOperator::Between:
+        return compareWith(1).value_or(-1) >= 0 && compareWith(2).value_or(1) <= 0;
+    case FilterOperator::InList:
+        for (size_t i = 1; i < operands.size(); ++i) {
+            if (compareWith(i).value_or(-1) == 0) {
+                return true;
+            }
+        }
+        return false;
+    case FilterOperator::OfType: {
+        // the type hierarchy is unknown client-side, only exact matches can be evaluated
+        OperandValue eventType;
+        resolve(operands[1], eventFields, eventType);
+        if (first.isNull() || !first.get()->isType<NodeId>()) {
+            return false;
+        }
+        const auto& typeId = *static_cast<const NodeId*>(first.get()->data());
+        return typeId == NodeId(ObjectTypeId::BaseEventType) ||
+            compare(first.get(), eventType.get()).value_or(-1) == 0;
+    }
+    case FilterOperator::Like: {
+        OperandValue pattern;
+        resolve(operands[1], eventFields, pattern);
+        if (first.isNull() || pattern.isNull()) {
+            return false;
+        }
+        const auto str = getStringView(*first.get());
+        const auto patternStr = getStringView(*pattern.get());
+        return str.has_value() && patternStr.has_value() && matchLike(*str, *patternStr);
+    }
+    default:
+        return false;
+    }
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,835 @@
+#include "open62541pp/filetype.hpp"
+
+#ifdef UA_ENABLE_METHODCALLS
+
+#include <algorithm>  // find_if, max, min, remove_if
+#include <array>
+#include <fstream>
+#include <istream>
+#include <iterator>  // istreambuf_iterator
+#include <limits>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>  // move, pair
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>  // open
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>  // close
+#endif
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/client_utils.hpp"  // getExceptionCatcher
+#include "open62541pp/detail/scope.hpp"
+#include "open62541pp/detail/server_context.hpp"
+#include "open62541pp/exception.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/session.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/services/method.hpp"
+#include "open62541pp/services/nodemanagement.hpp"
+#include "open62541pp/services/view.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+#include "open62541pp/ua/types.hpp"
+
+namespace opcua {
+
+static std::vector<ReferenceDescription> browseChildren(Client& client, const NodeId& id) {
+    return services::browseAll(
+               client,
+               BrowseDescription(
+                   id, BrowseDirection::Forward, ReferenceTypeId::HierarchicalReferences
+               )
+    )
+        .value();
+}
+
+static std::vector<ReferenceDescription> browseChildren(Server& server, const NodeId& id) {
+    return services::browseAll(
+               server,
+               BrowseDescription(
+                   id, BrowseDirection::Forward, ReferenceTypeId::HierarchicalReferences
+               )
+    )
+        .value();
+}
+
+/// Find a child by the name of its browse name, the namespace is ignored.
+static const ReferenceDescription* findChild(
+    const std::vector<ReferenceDescription>& children, std::string_view name
+) noexcept {
+    const auto it = std::find_if(children.begin(), children.end(), [&](const auto& ref) {
+        return ref.nodeId().isLocal() && ref.browseName().name() == name;
+    });
+    return it != children.end() ? &(*it) : nullptr;
+}
+
+/* --------------------------------------- FileTypeClient --------------------------------------- */
+
+struct FileTypeClient::Transfer {
+    bool active{true};  // false after the transfer returned, ignore late responses
+    bool finished{false};  // no more requests to issue
+    StatusCode status;
+    size_t pending{0};
+    uint64_t sent{0};  // sequence number of the next request
+    uint64_t bytes{0};
+    /// Issue the next request, returns `false` if there is nothing to send.
+    std::function<bool()> issueNext;
+    /// Process the completed responses in sequence.
+    std::function<void()> deliverCompleted;
+
+    void setStatus(StatusCode code) noexcept {
+        if (status.isGood()) {
+            status = code;
+        }
+    }
+};
+
+FileTypeClient::FileTypeClient(Client& client, NodeId fileId, FileTypeClientOptions options)
+    : client_(client),
+      fileId_(std::move(fileId)),
+      options_(options) {
+    const auto children = browseChildren(client_, fileId_);
+    auto resolve = [&](std::string_view name) {
+        const auto* ref = findChild(children, name);
+        if (ref == nullptr) {
+            throw BadStatus(UA_STATUSCODE_BADNOTFOUND);
+        }
+        return ref->nodeId().nodeId();
+    };
+    openId_ = resolve("Open");
+    closeId_ = resolve("Close");
+    readId_ = resolve("Read");
+    writeId_ = resolve("Write");
+    getPositionId_ = resolve("GetPosition");
+    setPositionId_ = resolve("SetPosition");
+    sizeId_ = resolve("Size");
+}
+
+FileTypeClient::~FileTypeClient() {
+    try {
+        close();
+    } catch (...) {  // NOLINT(bugprone-empty-catch)
+    }
+}
+
+void FileTypeClient::open(Bitmask<OpenFileMode> mode) {
+    if (handle_.has_value()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    const std::array input{Variant(mode.get())};
+    handle_ = call(openId_, input).to<uint32_t>();
+}
+
+void FileTypeClient::close() {
+    if (!handle_.has_value()) {
+        return;
+    }
+    const std::array input{Variant(*handle_)};
+    handle_.reset();
+    call(closeId_, input);
+}
+
+uint64_t FileTypeClient::size() {
+    return services::readValue(client_, sizeId_).value().to<uint64_t>();
+}
+
+uint64_t FileTypeClient::position() {
+    const std::array input{Variant(checkedHandle())};
+    return call(getPositionId_, input).to<uint64_t>();
+}
+
+void FileTypeClient::setPosition(uint64_t position) {
+    const std::array input{Variant(checkedHandle()), Variant(position)};
+    call(setPositionId_, input);
+}
+
+uint64_t FileTypeClient::read(const FileSink& sink) {
+    const uint32_t handle = checkedHandle();
+    const auto length = static_cast<int32_t>(
+        std::min<size_t>(std::max<size_t>(1, options_.chunkSize), INT32_MAX)
+    );
+    auto transfer = std::make_shared<Transfer>();
+    // completed chunks by sequence number, delivered in sequence
+    auto chunks = std::make_shared<std::map<uint64_t, ByteString>>();
+    uint64_t next = 0;
+
+    transfer->issueNext = [&, handle, length] {
+        const std::array input{Variant(handle), Variant(length)};
+        const uint64_t sequence = transfer->sent;
+        services::callAsync(
+            client_,
+            fileId_,
+            readId_,
+            input,
+            [transfer, chunks, sequence](CallMethodResult& result) {
+                --transfer->pending;
+                if (!transfer->active) {
+                    return;
+                }
+                if (result.statusCode().isBad()) {
+                    transfer->setStatus(result.statusCode());
+                    return;
+                }
+                auto outputs = result.outputArguments();
+                chunks->emplace(
+                    sequence, outputs.empty() ? ByteString{} : outputs[0].to<ByteString>()
+                );
+            }
+        );
+        ++transfer->sent;
+        return true;
+    };
+    transfer->deliverCompleted = [&] {
+        // the Read calls are processed in sequence, the first empty chunk marks the end of the
+        // file; a short chunk is not conclusive as the server may limit the chunk size
+        while (!transfer->finished && !chunks->empty() && chunks->begin()->first == next) {
+            const auto node = chunks->extract(chunks->begin());
+            const ByteString& data = node.mapped();
+            ++next;
+            if (data.empty()) {
+                transfer->finished = true;
+                break;
+            }
+            sink(Span<const uint8_t>(data.data(), data.size()));
+            transfer->bytes += data.size();
+        }
+    };
+
+    run(*transfer);
+    return transfer->bytes;
+}
+
+uint64_t FileTypeClient::read(std::ostream& stream) {
+    return read([&](Span<const uint8_t> data) {
+        stream.write(
+            reinterpret_cast<const char*>(data.data()),  // NOLINT(*reinterpret-cast)
+            static_cast<std::streamsize>(data.size())
+        );
+    });
+}
+
+uint64_t FileTypeClient::write(const FileSource& source) {
+    const uint32_t handle = checkedHandle();
+    const size_t chunkSize = std::min<size_t>(std::max<size_t>(1, options_.chunkSize), INT32_MAX);
+    auto transfer = std::make_shared<Transfer>();
+    std::vector<uint8_t> buffer(chunkSize);
+
+    transfer->issueNext = [&, handle] {
+        const size_t size = source(Span<uint8_t>(buffer));
+        if (size == 0) {
+            transfer->finished = true;
+            return false;
+        }
+        const std::array input{
+            Variant(handle), Variant(ByteString(Span<const uint8_t>(buffer.data(), size)))
+        };
+        services::callAsync(
+            client_,
+            fileId_,
+            writeId_,
+            input,
+            [transfer, size](CallMethodResult& result) {
+                --transfer->pending;
+                if (!transfer->active) {
+                    return;
+                }
+                if (result.statusCode().isBad()) {
+                    transfer->setStatus(result.statusCode());
+                    return;
+                }
+                transfer->bytes += size;
+            }
+        );
+        ++transfer->sent;
+        return true;
+    };
+    transfer->deliverCompleted = [] {};
+
+    run(*transfer);
+    return transfer->bytes;
+}
+
+uint64_t FileTypeClient::write(std::istream& stream) {
+    return write([&](Span<uint8_t> buffer) {
+        stream.read(
+            reinterpret_cast<char*>(buffer.data()),  // NOLINT(*reinterpret-cast)
+            static_cast<std::streamsize>(buffer.size())
+        );
+        return static_cast<size_t>(stream.gcount());
+    });
+}
+
+uint64_t FileTypeClient::write(Span<const uint8_t> data) {
+    return write([&](Span<uint8_t> buffer) {
+        const size_t size = std::min(buffer.size(), data.size());
+        std::copy_n(data.begin(), size, buffer.begin());
+        data = data.subview(size);
+        return size;
+    });
+}
+
+uint32_t FileTypeClient::checkedHandle() const {
+    if (!handle_.has_value()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    return *handle_;
+}
+
+Variant FileTypeClient::call(const NodeId& methodId, Span<const Variant> input) {
+    auto result = services::call(client_, fileId_, methodId, input);
+    result.statusCode().throwIfBad();
+    auto outputs = result.outputArguments();
+    return outputs.empty() ? Variant{} : std::move(outputs[0]);
+}
+
+void FileTypeClient::run(Transfer& transfer) {
+    const detail::ScopeExit deactivate([&] { transfer.active = false; });
+    const size_t maxPending = std::max<size_t>(1, options_.maxPendingRequests);
+    while (true) {
+        while (transfer.status.isGood() && !transfer.finished && transfer.pending < maxPending) {
+            if (!transfer.issueNext()) {
+                break;
+            }
+            ++transfer.pending;
+        }
+        // failed initiations of async requests are stored in the exception catcher
+        detail::getExceptionCatcher(client_).rethrow();
+        transfer.deliverCompleted();
+        // wait for all pending calls to leave the file handle in a defined state
+        if ((transfer.status.isBad() || transfer.finished) && transfer.pending == 0) {
+            break;
+        }
+        client_.runIterate(options_.iterateTimeout);
+    }
+    transfer.status.throwIfBad();
+}
+
+/* ---------------------------------------- File object ----------------------------------------- */
+
+namespace {
+
+/// Read-only view of a file, memory-mapped if supported by the platform.
+class MappedFile {
+public:
+    MappedFile() = default;
+
+    ~MappedFile() {
+        unmap();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) noexcept = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) noexcept = delete;
+
+    void map(const std::string& path) {
+        unmap();
+#ifndef _WIN32
+        const int fd = ::open(path.c_str(), O_RDONLY);  // NOLINT(*vararg)
+        if (fd < 0) {
+            throw BadStatus(UA_STATUSCODE_BADNOTREADABLE);
+        }
+        const detail::ScopeExit closeFile([&] { ::close(fd); });
+        struct stat info {};
+        if (::fstat(fd, &info) != 0) {
+            throw BadStatus(UA_STATUSCODE_BADNOTREADABLE);
+        }
+        const auto size = static_cast<size_t>(info.st_size);
+        if (size > 0) {
+            void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {  // NOLINT(*cstyle-cast, performance-no-int-to-ptr)
+                throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
+            }
+            data_ = static_cast<const uint8_t*>(data);
+        }
+        size_ = size;
+#else
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            throw BadStatus(UA_STATUSCODE_BADNOTREADABLE);
+        }
+        buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        data_ = reinterpret_cast<const uint8_t*>(buffer_.data());  // NOLINT(*reinterpret-cast)
+        size_ = buffer_.size();
+#endif
+    }
+
+    void unmap() noexcept {
+#ifndef _WIN32
+        if (data_ != nullptr) {
+            ::munmap(const_cast<uint8_t*>(data_), size_);  // NOLINT(*const-cast)
+        }
+#else
+        buffer_.clear();
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    Span<const uint8_t> data() const noexcept {
+        return {data_, size_};
+    }
+
+private:
+    const uint8_t* data_{nullptr};
+    size_t size_{0};
+#ifdef _WIN32
+    std::vector<char> buffer_;
+#endif
+};
+
+class FileObject;
+
+/**
+ * Handles of file objects opened by a session (context slot of the session).
+ * The handles are released when the session is closed.
+ */
+class SessionFileHandles {
+public:
+    SessionFileHandles() = default;
+    ~SessionFileHandles();
+
+    SessionFileHandles(const SessionFileHandles&) = delete;
+    SessionFileHandles(SessionFileHandles&&) noexcept = delete;
+    SessionFileHandles& operator=(const SessionFileHandles&) = delete;
+    SessionFileHandles& operator=(SessionFileHandles&&) noexcept = delete;
+
+    void add(std::weak_ptr<FileObject> file, uint32_t handle) {
+        const std::lock_guard lock(mutex_);
+        handles_.emplace_back(std::move(file), handle);
+    }
+
+    void remove(const FileObject* file, uint32_t handle) {
+        const std::lock_guard lock(mutex_);
+        handles_.erase(
+            std::remove_if(
+                handles_.begin(),
+                handles_.end(),
+                [&](const auto& entry) {
+                    return entry.second == handle && entry.first.lock().get() == file;
+                }
+            ),
+            handles_.end()
+        );
+    }
+
+private:
+    std::mutex mutex_;  // concurrent calls of the session
+    std::vector<std::pair<std::weak_ptr<FileObject>, uint32_t>> handles_;
+};
+
+class FileObject : public std::enable_shared_from_this<FileObject> {
+public:
+    FileObject(Server& server, std::string path, bool writable)
+        : server_(server),
+          path_(std::move(path)),
+          writable_(writable) {}
+
+    bool writable() const noexcept {
+        return writable_;
+    }
+
+    uint64_t fileSize() const {
+        const std::lock_guard lock(mutex_);
+        if (writer_ || readers_ > 0) {
+            return size_;
+        }
+        std::ifstream file(path_, std::ios::binary | std::ios::ate);
+        return file ? static_cast<uint64_t>(file.tellg()) : 0;
+    }
+
+    uint16_t openCount() const {
+        const std::lock_guard lock(mutex_);
+        return static_cast<uint16_t>(std::min<size_t>(handles_.size(), UINT16_MAX));
+    }
+
+    uint32_t open(const NodeId& session, Bitmask<OpenFileMode> mode) {
+        constexpr auto known = static_cast<uint8_t>(
+            OpenFileMode::Read | OpenFileMode::Write | OpenFileMode::EraseExisting |
+            OpenFileMode::Append
+        );
+        const bool write = mode.allOf(OpenFileMode::Write);
+        if ((mode.get() & ~known) != 0 ||
+            !mode.anyOf(OpenFileMode::Read | OpenFileMode::Write) ||
+            (!write && mode.anyOf(OpenFileMode::EraseExisting | OpenFileMode::Append))) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+        uint32_t handle = 0;
+        {
+            const std::lock_guard lock(mutex_);
+            if (write) {
+                if (!writable_) {
+                    throw BadStatus(UA_STATUSCODE_BADNOTWRITABLE);
+                }
+                if (!handles_.empty()) {
+                    throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);  // exclusive access required
+                }
+                openWriter(mode.allOf(OpenFileMode::EraseExisting));
+            } else {
+                if (writer_) {
+                    throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+                }
+                if (readers_ == 0) {
+                    mapping_.map(path_);
+                    size_ = mapping_.data().size();
+                }
+                ++readers_;
+            }
+            handle = nextHandle_++;
+            handles_[handle] = {session, mode, mode.allOf(OpenFileMode::Append) ? size_ : 0};
+        }
+        if (auto sessionHandles = findSessionHandles(session)) {
+            sessionHandles->add(weak_from_this(), handle);
+        }
+        return handle;
+    }
+
+    void close(const NodeId& session, uint32_t handle) {
+        {
+            const std::lock_guard lock(mutex_);
+            findHandle(session, handle);
+        }
+        if (auto sessionHandles = findSessionHandles(session)) {
+            sessionHandles->remove(this, handle);
+        }
+        if (!release(handle)) {
+            throw BadStatus(UA_STATUSCODE_BADNOTWRITABLE);
+        }
+    }
+
+    /// Release a handle without checking the session.
+    /// @return `false` if the buffered data of a handle with write access couldn't be written
+    bool release(uint32_t handle) {
+        const std::lock_guard lock(mutex_);
+        const auto it = handles_.find(handle);
+        if (it == handles_.end()) {
+            return true;  // already released
+        }
+        bool good = true;
+        if (it->second.mode.allOf(OpenFileMode::Write)) {
+            stream_.close();  // flush
+            good = !stream_.fail();
+            stream_.clear();
+            writer_ = false;
+        } else if (--readers_ == 0) {
+            mapping_.unmap();
+        }
+        handles_.erase(it);
+        return good;
+    }
+
+    ByteString read(const NodeId& session, uint32_t handle, int32_t length) {
+        const std::lock_guard lock(mutex_);
+        auto& state = findHandle(session, handle)->second;
+        if (!state.mode.allOf(OpenFileMode::Read)) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+        }
+        if (length < 0) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+        const auto begin = std::min(state.position, size_);
+        const auto size = static_cast<size_t>(
+            std::min<uint64_t>(static_cast<uint64_t>(length), size_ - begin)
+        );
+        ByteString data;
+        if (writer_) {
+            std::vector<uint8_t> buffer(size);
+            stream_.seekg(static_cast<std::streamoff>(begin));
+            stream_.read(
+                reinterpret_cast<char*>(buffer.data()),  // NOLINT(*reinterpret-cast)
+                static_cast<std::streamsize>(size)
+            );
+            if (!stream_) {
+                stream_.clear();
+                throw BadStatus(UA_STATUSCODE_BADNOTREADABLE);
+            }
+            data = ByteString(Span<const uint8_t>(buffer));
+        } else {
+            data = ByteString(mapping_.data().subview(static_cast<size_t>(begin), size));
+        }
+        state.position = begin + size;
+        return data;
+    }
+
+    void write(const NodeId& session, uint32_t handle, const ByteString& data) {
+        const std::lock_guard lock(mutex_);
+        auto& state = findHandle(session, handle)->second;
+        if (!state.mode.allOf(OpenFileMode::Write)) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+        }
+        const uint64_t begin = state.mode.allOf(OpenFileMode::Append) ? size_ : state.position;
+        // buffered by the stream, flushed on close
+        stream_.seekp(static_cast<std::streamoff>(begin));
+        stream_.write(
+            reinterpret_cast<const char*>(data.data()),  // NOLINT(*reinterpret-cast)
+            static_cast<std::streamsize>(data.size())
+        );
+        if (!stream_) {
+            stream_.clear();
+            throw BadStatus(UA_STATUSCODE_BADNOTWRITABLE);
+        }
+        state.position = begin + data.size();
+        size_ = std::max(size_, state.position);
+    }
+
+    uint64_t getPosition(const NodeId& session, uint32_t handle) {
+        const std::lock_guard lock(mutex_);
+        return findHandle(session, handle)->second.position;
+    }
+
+    void setPosition(const NodeId& session, uint32_t handle, uint64_t position) {
+        const std::lock_guard lock(mutex_);
+        // positions beyond the end of the file are set to the end of the file
+        findHandle(session, handle)->second.position = std::min(position, size_);
+    }
+
+private:
+    struct Handle {
+        NodeId session;  // owner, handles are only valid within the session that opened them
+        Bitmask<OpenFileMode> mode;
+        uint64_t position;
+    };
+
+    std::map<uint32_t, Handle>::iterator findHandle(const NodeId& session, uint32_t handle) {
+        const auto it = handles_.find(handle);
+        if (it == handles_.end() || it->second.session != session) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+        return it;
+    }
+
+    /// Get the handles of a session, `nullptr` for sessions without context slots (e.g. the
+    /// internal session of local calls).
+    std::shared_ptr<SessionFileHandles> findSessionHandles(const NodeId& session) {
+        try {
+            return Session(server_, session).context<SessionFileHandles>();
+        } catch (const BadStatus&) {
+            return nullptr;
+        }
+    }
+
+    void openWriter(bool erase) {
+        // create a missing file, fstream can't open a missing file for reading and writing
+        if (erase || !std::ifstream(path_).good()) {
+            std::ofstream(path_, std::ios::binary | std::ios::trunc);
+        }
+        stream_.open(path_, std::ios::in | std::ios::out | std::ios::binary);
+        if (!stream_) {
+            throw BadStatus(UA_STATUSCODE_BADNOTWRITABLE);
+        }
+        stream_.seekg(0, std::ios::end);
+        size_ = static_cast<uint64_t>(stream_.tellg());
+        writer_ = true;
+    }
+
+    Server& server_;
+    std::string path_;
+    bool writable_;
+    mutable std::mutex mutex_;  // method calls, property reads and closing sessions
+    std::map<uint32_t, Handle> handles_;
+    uint32_t nextHandle_{1};
+    uint64_t size_{0};  // size of the file while open
+    size_t readers_{0};
+    MappedFile mapping_;  // shared by the read-only handles
+    bool writer_{false};
+    std::fstream stream_;  // handle with write access
+};
+
+SessionFileHandles::~SessionFileHandles() {
+    for (const auto& [file, handle] : handles_) {
+        if (const auto locked = file.lock()) {
+            // the properties are computed on read, no server access within the session close
+            locked->release(handle);
+        }
+    }
+}
+
+/// Read-only data source of a property, computed on each read.
+template <typename F>
+ValueBackendDataSource computedProperty(F get) {
+    ValueBackendDataSource dataSource;
+    dataSource.read = [get = std::move(get)](
+                          DataValue& value, const NumericRange&, bool timestamp
+                      ) {
+        value.value() = get();
+        if (timestamp) {
+            value.setSourceTimestamp(DateTime::now());
+        }
+        return StatusCode(UA_STATUSCODE_GOOD);
+    };
+    return dataSource;
+}
+
+}  // namespace
+
+NodeId addFileObject(
+    Server& server,
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    std::string path,
+    bool writable
+) {
+    auto result = services::addObject(
+        server,
+        parentId,
+        id,
+        browseName,
+        ObjectAttributes{},
+        ObjectTypeId::FileType,
+        ReferenceTypeId::HasComponent
+    );
+    if (result.code() == UA_STATUSCODE_BADTYPEDEFINITIONINVALID) {
+        // FileType is not available with the reduced namespace zero
+        result = services::addObject(
+            server,
+            parentId,
+            id,
+            browseName,
+            ObjectAttributes{},
+            ObjectTypeId::BaseObjectType,
+            ReferenceTypeId::HasComponent
+        );
+    }
+    const NodeId objectId = result.value();
+    const auto children = browseChildren(server, objectId);
+    auto file = std::make_shared<FileObject>(server, std::move(path), writable);
+
+    auto childId = [&](std::string_view name) {
+        return NodeId(objectId.namespaceIndex(), objectId.toString() + "/" + std::string(name));
+    };
+
+    auto addProperty = [&](std::string_view name, const Variant& value) {
+        NodeId propertyId;
+        if (const auto* ref = findChild(children, name); ref != nullptr) {
+            propertyId = ref->nodeId().nodeId();
+        } else {
+            propertyId = services::addProperty(
+                             server,
+                             objectId,
+                             childId(name),
+                             name,
+                             VariableAttributes{}
+                                 .setDataType(asWrapper<NodeId>(value.type()->typeId))
+                                 .setValueRank(ValueRank::Scalar)
+                                 .setValue(value)
+            )
+                             .value();
+            services::writeBrowseName(server, propertyId, {0, name});
+        }
+        services::writeValue(server, propertyId, value).throwIfBad();
+        return propertyId;
+    };
+
+    using SessionMethodCallback = std::function<
+        void(const NodeId& session, Span<const Variant> input, Span<Variant> output)>;
+
+    auto addMethod = [&](std::string_view name,
+                         SessionMethodCallback callback,
+                         Span<const Argument> inputArguments,
+                         Span<const Argument> outputArguments) {
+        // methods of instantiated objects reference the shared method nodes of the type,
+        // replace them with methods bound to the file
+        if (const auto* ref = findChild(children, name); ref != nullptr) {
+            services::deleteReference(
+                server, objectId, ref->nodeId().nodeId(), ReferenceTypeId::HasComponent, true, true
+            )
+                .throwIfBad();
+        }
+        // the handles are bound to the calling session
+        detail::getContext(server).nodeContexts[childId(name)]->sessionMethodCallback.store(
+            std::move(callback)
+        );
+        const NodeId methodId = services::addMethod(
+                                    server,
+                                    objectId,
+                                    childId(name),
+                                    name,
+                                    {},
+                                    inputArguments,
+                                    outputArguments,
+                                    MethodAttributes{},
+                                    ReferenceTypeId::HasComponent
+        )
+                                    .value();
+        services::writeBrowseName(server, methodId, {0, name});
+    };
+
+    const Argument handleArgument("FileHandle", {}, DataTypeId::UInt32, ValueRank::Scalar);
+    const Argument positionArgument("Position", {}, DataTypeId::UInt64, ValueRank::Scalar);
+
+    const NodeId sizeId = addProperty("Size", Variant(file->fileSize()));
+    addProperty("Writable", Variant(writable));
+    addProperty("UserWritable", Variant(writable));
+    const NodeId openCountId = addProperty("OpenCount", Variant(uint16_t{0}));
+    // computed on read instead of written on each Open, Write and Close call
+    server.setVariableNodeValueBackend(
+        sizeId, computedProperty([file] { return Variant(file->fileSize()); })
+    );
+    server.setVariableNodeValueBackend(
+        openCountId, computedProperty([file] { return Variant(file->openCount()); })
+    );
+
+    addMethod(
+        "Open",
+        [file](const NodeId& session, Span<const Variant> input, Span<Variant> output) {
+            output.at(0) = file->open(session, input.at(0).to<uint8_t>());
+        },
+        {{"Mode", {}, DataTypeId::Byte, ValueRank::Scalar}},
+        {handleArgument}
+    );
+    addMethod(
+        "Close",
+        [file](const NodeId& session, Span<const Variant> input, Span<Variant>) {
+            file->close(session, input.at(0).to<uint32_t>());
+        },
+        {handleArgument},
+        {}
+    );
+    addMethod(
+        "Read",
+        [file](const NodeId& session, Span<const Variant> input, Span<Variant> output) {
+            output.at(0) = file->read(
+                session, input.at(0).to<uint32_t>(), input.at(1).to<int32_t>()
+            );
+        },
+        {handleArgument, {"Length", {}, DataTypeId::Int32, ValueRank::Scalar}},
+        {{"Data", {}, DataTypeId::ByteString, ValueRank::Scalar}}
+    );
+    addMethod(
+        "Write",
+        [file](const NodeId& session, Span<const Variant> input, Span<Variant>) {
+            file->write(session, input.at(0).to<uint32_t>(), input.at(1).scalar<ByteString>());
+        },
+        {handleArgument, {"Data", {}, DataTypeId::ByteString, ValueRank::Scalar}},
+        {}
+    );
+    addMethod(
+        "GetPosition",
+        [file](const NodeId& session, Span<const Variant> input, Span<Variant> output) {
+            output.at(0) = file->getPosition(session, input.at(0).to<uint32_t>());
+        },
+        {handleArgument},
+        {positionArgument}
+    );
+    addMethod(
+        "SetPosition",
+        [file](const NodeId& session, Span<const Variant> input, Span<Variant>) {
+            file->setPosition(session, input.at(0).to<uint32_t>(), input.at(1).to<uint64_t>());
+        },
+        {handleArgument, positionArgument},
+        {}
+    );
+    return objectId;
+}
+
+}  // namespace opcua
+
+#endif
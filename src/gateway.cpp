@@ -0,0 +1,706 @@
+#include "open62541pp/gateway.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <array>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <unordered_map>
+#include <utility>  // move, swap
+#include <vector>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/open62541/server.h"
+#include "open62541pp/detail/scope.hpp"
+#include "open62541pp/detail/server_context.hpp"
+#include "open62541pp/exception.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"  // readValue
+#include "open62541pp/services/method.hpp"
+#include "open62541pp/services/monitoreditem.hpp"
+#include "open62541pp/services/nodemanagement.hpp"
+#include "open62541pp/services/view.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+namespace opcua {
+
+namespace detail {
+
+struct MountedNode {
+    NodeId remoteId;
+    NodeId remoteParentId;
+    NodeClass nodeClass;
+    bool expanded{false};
+    std::shared_ptr<const DataValue> value;  // guarded by GatewayState::mutex
+};
+
+struct PendingWrite {
+    WriteValue value;
+    std::function<void(StatusCode)> answer;  // invoked exactly once
+};
+
+struct PendingCall {
+    NodeId objectId;
+    NodeId methodId;
+    std::vector<Variant> inputArguments;
+    std::function<void(CallMethodResult&)> answer;  // invoked exactly once
+};
+
+struct GatewayState : std::enable_shared_from_this<GatewayState> {
+    GatewayState(Server& server_, Client& client_, std::string_view name_, GatewayOptions options_)
+        : server(server_),
+          client(client_),
+          name(name_),
+          options(std::move(options_)) {}
+
+    Server& server;
+    Client& client;
+    std::string name;
+    GatewayOptions options;
+    NamespaceIndex namespaceIndex{0};
+    NodeId mountId;
+    IntegerId subscriptionId{0};
+    std::unordered_map<NodeId, std::unique_ptr<MountedNode>> nodes;  // by local id
+    std::vector<NodeId> order;  // local ids in order of creation
+    std::unordered_map<IntegerId, MountedNode*> monitoredItems;
+
+    // shared with the server and client threads
+    mutable std::mutex mutex;
+    bool mounted{true};
+    std::vector<PendingWrite> writes;
+    std::vector<PendingCall> calls;
+    GatewayStatistics statistics{};
+};
+
+}  // namespace detail
+
+using detail::GatewayState;
+using detail::MountedNode;
+using detail::PendingCall;
+using detail::PendingWrite;
+
+static NodeId makeLocalId(const GatewayState& state, const NodeId& remoteId) {
+    return {state.namespaceIndex, state.name + ":" + remoteId.toString()};
+}
+
+/// Use standard (reference) types of namespace zero, otherwise the fallback.
+static NodeId standardOr(const NodeId& id, const NodeId& fallback) {
+    return !id.isNull() && id.namespaceIndex() == 0 ? id : fallback;
+}
+
+static NodeId standardOr(const ExpandedNodeId& id, const NodeId& fallback) {
+    return id.isLocal() ? standardOr(id.nodeId(), fallback) : fallback;
+}
+
+static ValueBackendDataSource createDataSource(GatewayState& state, MountedNode& node) {
+    ValueBackendDataSource dataSource;
+    dataSource.read = [&state, &node](
+                          DataValue& value, const NumericRange& range, bool timestamp
+                      ) {
+        std::shared_ptr<const DataValue> cached;
+        {
+            const std::lock_guard lock(state.mutex);
+            ++state.statistics.reads;
+            cached = node.value;
+            if (cached == nullptr) {
+                ++state.statistics.cacheMisses;
+            }
+        }
+        if (cached == nullptr) {
+            return StatusCode(UA_STATUSCODE_BADWAITINGFORINITIALDATA);
+        }
+        // the only copy of the value, owned by the read response
+        if (range.empty()) {
+            value = *cached;
+        } else {
+            const UA_DataValue& native = *cached->handle();
+            const StatusCode status = UA_Variant_copyRange(
+                &native.value, &value->value, *range.handle()
+            );
+            if (status.isBad()) {
+                return status;
+            }
+            value->hasValue = true;
+            value->hasStatus = native.hasStatus;
+            value->status = native.status;
+            value->hasSourceTimestamp = native.hasSourceTimestamp;
+            value->sourceTimestamp = native.sourceTimestamp;
+        }
+        if (!timestamp) {
+            value->hasSourceTimestamp = false;
+            value->hasSourcePicoseconds = false;
+        }
+        value->hasServerTimestamp = false;
+        value->hasServerPicoseconds = false;
+        return StatusCode(UA_STATUSCODE_GOOD);
+    };
+    // forwarded synchronously like the method calls, the result of the downstream server is
+    // returned to the writing session
+    dataSource.write = [&state, &node](const DataValue& value, const NumericRange& range) {
+        auto result = std::make_shared<std::promise<StatusCode>>();
+        auto future = result->get_future();
+        {
+            const std::lock_guard lock(state.mutex);
+            if (!state.mounted) {
+                return StatusCode(UA_STATUSCODE_BADNODEIDUNKNOWN);
+            }
+            state.writes.push_back(
+                {WriteValue(
+                     node.remoteId,
+                     AttributeId::Value,
+                     range.empty() ? "" : range.toString(),
+                     value
+                 ),
+                 [result](StatusCode status) { result->set_value(status); }}
+            );
+            ++state.statistics.forwardedWrites;
+        }
+        const StatusCode status = future.wait_for(state.options.writeTimeout) ==
+                std::future_status::ready
+            ? future.get()
+            : StatusCode(UA_STATUSCODE_BADTIMEOUT);
+        if (status.isBad()) {
+            const std::lock_guard lock(state.mutex);
+            ++state.statistics.failedWrites;
+        }
+        return status;
+    };
+    return dataSource;
+}
+
+static CallMethodResult makeCallResult(StatusCode status) {
+    CallMethodResult result;
+    result->statusCode = status;
+    return result;
+}
+
+/// Queue a call for the next dispatch.
+/// @return `false` if the mount was deleted
+static bool queueCall(
+    GatewayState& state,
+    const MountedNode& node,
+    Span<const Variant> input,
+    std::function<void(CallMethodResult&)> answer
+) {
+    const std::lock_guard lock(state.mutex);
+    if (!state.mounted) {
+        return false;
+    }
+    state.calls.push_back(
+        {node.remoteParentId, node.remoteId, {input.begin(), input.end()}, std::move(answer)}
+    );
+    ++state.statistics.forwardedCalls;
+    return true;
+}
+
+/// Callback of local calls (and calls of client sessions without async method nodes), waits for
+/// the forwarded result.
+static MethodCallback createMethodCallback(GatewayState& state, MountedNode& node) {
+    return [&state, &node](Span<const Variant> input, Span<Variant> output) {
+        auto result = std::make_shared<std::promise<CallMethodResult>>();
+        auto future = result->get_future();
+        const bool queued = queueCall(state, node, input, [result](CallMethodResult& callResult) {
+            result->set_value(std::move(callResult));
+        });
+        if (!queued) {
+            throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+        }
+        if (future.wait_for(state.options.callTimeout) != std::future_status::ready) {
+            const std::lock_guard lock(state.mutex);
+            ++state.statistics.failedCalls;
+            throw BadStatus(UA_STATUSCODE_BADTIMEOUT);
+        }
+        const auto callResult = future.get();
+        callResult.statusCode().throwIfBad();
+        const auto outputArguments = callResult.outputArguments();
+        for (size_t i = 0; i < output.size() && i < outputArguments.size(); ++i) {
+            output[i] = outputArguments[i];
+        }
+    };
+}
+
+#if UAPP_HAS_ASYNC_METHODS
+static void answerAsyncCall(Server& server, CallMethodResult& result, void* operation) {
+    UA_Server_setAsyncOperationResult(
+        server.handle(),
+        reinterpret_cast<const UA_AsyncOperationResponse*>(result.handle()),  // NOLINT
+        operation
+    );
+}
+
+/// Turn a mounted method into an async method node. Calls of client sessions are queued without
+/// blocking the server loop and answered by the dispatch of the mount.
+static void setMethodAsync(GatewayState& state, const NodeId& localId, const MountedNode& node) {
+    auto* nodeContext = detail::getContext(state.server).nodeContexts[localId];
+    nodeContext->asyncMethodCallback.store(
+        [weakState = state.weak_from_this(), &node](
+            const CallMethodRequest& request, void* operation
+        ) {
+            const auto state = weakState.lock();
+            if (state == nullptr) {
+                return false;
+            }
+            return queueCall(
+                *state,
+                node,
+                request.inputArguments(),
+                [&server = state->server, operation](CallMethodResult& result) {
+                    answerAsyncCall(server, result, operation);
+                }
+            );
+        }
+    );
+    // calls of client sessions wait in the method callback if the node can't be made async
+    (void)UA_Server_setMethodNodeAsync(state.server.handle(), localId, true);
+}
+
+/// Take the calls of async method nodes from the server and hand them over to their mounts.
+/// Async method nodes without handler are called synchronously.
+static void takeAsyncCalls(Server& server) {
+    UA_AsyncOperationType type{};
+    const UA_AsyncOperationRequest* request = nullptr;
+    void* operation = nullptr;
+    UA_DateTime timeout{};
+    while (UA_Server_getAsyncOperationNonBlocking(
+        server.handle(), &type, &request, &operation, &timeout
+    )) {
+        const auto& callRequest = asWrapper<CallMethodRequest>(request->callMethodRequest);
+        const auto* nodeContext = detail::getContext(server).nodeContexts.find(
+            callRequest.methodId()
+        );
+        const auto callback = nodeContext != nullptr ? nodeContext->asyncMethodCallback.load()
+                                                     : nullptr;
+        if (callback && *callback && (*callback)(callRequest, operation)) {
+            continue;
+        }
+        CallMethodResult result = UA_Server_call(server.handle(), &request->callMethodRequest);
+        answerAsyncCall(server, result, operation);
+    }
+}
+#endif
+
+static std::vector<Argument> readArguments(
+    Client& client, const NodeId& methodId, std::string_view browseName
+) {
+    const auto refs = services::browseAll(
+        client,
+        BrowseDescription(
+            methodId,
+            BrowseDirection::Forward,
+            ReferenceTypeId::HasProperty,
+            true,
+            NodeClass::Variable
+        )
+    );
+    if (!refs) {
+        return {};
+    }
+    for (const auto& ref : *refs) {
+        if (ref.browseName().name() != browseName) {
+            continue;
+        }
+        const auto value = services::readValue(client, ref.nodeId().nodeId());
+        if (value && value->isArray() && value->isType<Argument>()) {
+            const auto arguments = value->array<Argument>();
+            return {arguments.begin(), arguments.end()};
+        }
+    }
+    return {};
+}
+
+/// Read the attributes of a downstream variable mirrored by the mounted variable.
+/// Access is limited to what the session of the downstream client may do.
+static VariableAttributes readVariableAttributes(Client& client, const NodeId& remoteId) {
+    const std::array<ReadValueId, 4> ids{
+        ReadValueId(remoteId, AttributeId::DataType),
+        ReadValueId(remoteId, AttributeId::ValueRank),
+        ReadValueId(remoteId, AttributeId::AccessLevel),
+        ReadValueId(remoteId, AttributeId::UserAccessLevel),
+    };
+    auto attributes = VariableAttributes{}
+                          .setDataType(DataTypeId::BaseDataType)
+                          .setValueRank(ValueRank::Any)
+                          .setAccessLevel(AccessLevel::CurrentRead)
+                          .setUserAccessLevel(AccessLevel::CurrentRead);
+    const auto response = services::read(client, ids, TimestampsToReturn::Neither);
+    const auto results = response.results();
+    if (response.responseHeader().serviceResult().isBad() || results.size() != ids.size()) {
+        return attributes;
+    }
+    if (const auto& dataType = results[0].value(); dataType.isType<NodeId>()) {
+        // custom data types of the downstream server are unknown to the gateway server
+        attributes.setDataType(standardOr(dataType.scalar<NodeId>(), DataTypeId::BaseDataType));
+    }
+    if (const auto& valueRank = results[1].value(); valueRank.isType<int32_t>()) {
+        attributes.setValueRank(static_cast<ValueRank>(valueRank.scalar<int32_t>()));
+    }
+    const auto& accessLevel = results[2].value();
+    const auto& userAccessLevel = results[3].value();
+    if (accessLevel.isType<uint8_t>() && userAccessLevel.isType<uint8_t>()) {
+        // history access is not mirrored
+        constexpr auto mask = static_cast<uint8_t>(
+            AccessLevel::CurrentRead | AccessLevel::CurrentWrite
+        );
+        const auto access = static_cast<uint8_t>(
+            accessLevel.scalar<uint8_t>() & userAccessLevel.scalar<uint8_t>() & mask
+        );
+        attributes.setAccessLevel(access).setUserAccessLevel(access);
+    }
+    return attributes;
+}
+
+static bool mountNode(
+    GatewayState& state,
+    const NodeId& parentLocalId,
+    const NodeId& parentRemoteId,
+    const ReferenceDescription& ref,
+    std::vector<MountedNode*>& variables
+) {
+    if (!ref.nodeId().isLocal()) {
+        return false;  // node of another server
+    }
+    const NodeId& remoteId = ref.nodeId().nodeId();
+    NodeId localId = makeLocalId(state, remoteId);
+    if (state.nodes.count(localId) > 0) {
+        return false;  // already mounted via another reference
+    }
+    const auto browseName = ref.browseName().name();
+    const auto referenceType = standardOr(ref.referenceTypeId(), ReferenceTypeId::Organizes);
+    auto node = std::make_unique<MountedNode>(
+        MountedNode{remoteId, parentRemoteId, ref.nodeClass(), false, nullptr}
+    );
+
+    StatusCode status;
+    if (ref.nodeClass() == NodeClass::Object) {
+        const auto result = services::addObject(
+            state.server,
+            parentLocalId,
+            localId,
+            browseName,
+            ObjectAttributes{}.setDisplayName(ref.displayName()),
+            standardOr(ref.typeDefinition(), ObjectTypeId::BaseObjectType),
+            referenceType
+        );
+        status = result.code();
+    } else if (ref.nodeClass() == NodeClass::Variable) {
+        const auto result = services::addVariable(
+            state.server,
+            parentLocalId,
+            localId,
+            browseName,
+            readVariableAttributes(state.client, remoteId).setDisplayName(ref.displayName()),
+            standardOr(ref.typeDefinition(), VariableTypeId::BaseDataVariableType),
+            referenceType
+        );
+        status = result.code();
+        if (status.isGood()) {
+            state.server.setVariableNodeValueBackend(localId, createDataSource(state, *node));
+            variables.push_back(node.get());
+        }
+    } else if (ref.nodeClass() == NodeClass::Method) {
+        const auto inputArguments = readArguments(state.client, remoteId, "InputArguments");
+        const auto outputArguments = readArguments(state.client, remoteId, "OutputArguments");
+        const auto result = services::addMethod(
+            state.server,
+            parentLocalId,
+            localId,
+            browseName,
+            createMethodCallback(state, *node),
+            inputArguments,
+            outputArguments,
+            MethodAttributes{}.setDisplayName(ref.displayName()),
+            ReferenceTypeId::HasComponent
+        );
+        status = result.code();
+#if UAPP_HAS_ASYNC_METHODS
+        if (status.isGood() && state.options.asyncMethods) {
+            setMethodAsync(state, localId, *node);
+        }
+#endif
+    } else {
+        return false;
+    }
+    if (status.isBad()) {
+        return false;
+    }
+    state.order.push_back(localId);
+    state.nodes.emplace(std::move(localId), std::move(node));
+    return true;
+}
+
+static size_t expandNode(
+    GatewayState& state,
+    const NodeId& localId,
+    MountedNode& node,
+    size_t depth,
+    std::vector<MountedNode*>& variables
+) {
+    if (depth == 0 || node.expanded || node.nodeClass == NodeClass::Method) {
+        return 0;
+    }
+    const auto refs = services::browseAll(
+        state.client,
+        BrowseDescription(
+            node.remoteId,
+            BrowseDirection::Forward,
+            ReferenceTypeId::HierarchicalReferences,
+            true,
+            NodeClass::Object | NodeClass::Variable | NodeClass::Method
+        )
+    );
+    refs.code().throwIfBad();
+    node.expanded = true;
+
+    size_t mounted = 0;
+    for (const auto& ref : *refs) {
+        if (mountNode(state, localId, node.remoteId, ref, variables)) {
+            ++mounted;
+            const NodeId childId = state.order.back();
+            mounted += expandNode(state, childId, *state.nodes.at(childId), depth - 1, variables);
+        }
+    }
+    return mounted;
+}
+
+/// Create the monitored items feeding the value caches with a single request.
+static void subscribeValues(GatewayState& state, Span<MountedNode* const> variables) {
+    if (variables.empty()) {
+        return;
+    }
+    std::vector<MonitoredItemCreateRequest> items;
+    items.reserve(variables.size());
+    for (const auto* node : variables) {
+        items.emplace_back(
+            ReadValueId(node->remoteId, AttributeId::Value),
+            MonitoringMode::Reporting,
+            MonitoringParameters(state.options.samplingInterval, {}, 1, true)
+        );
+    }
+    const auto response = services::createMonitoredItemsDataChange(
+        state.client,
+        CreateMonitoredItemsRequest({}, state.subscriptionId, TimestampsToReturn::Both, items),
+        [&state](IntegerId, IntegerId monId, const DataValue& value) {
+            // copy outside of the lock, reads share the cached value
+            auto cached = std::make_shared<const DataValue>(value);
+            const std::lock_guard lock(state.mutex);
+            ++state.statistics.notifications;
+            const auto it = state.monitoredItems.find(monId);
+            if (it != state.monitoredItems.end()) {
+                it->second->value = std::move(cached);
+            }
+        },
+        {}
+    );
+    response.responseHeader().serviceResult().throwIfBad();
+    const auto results = response.results();
+    for (size_t i = 0; i < results.size() && i < variables.size(); ++i) {
+        if (results[i].statusCode().isGood()) {
+            state.monitoredItems.emplace(results[i].monitoredItemId(), variables[i]);
+        }
+    }
+}
+
+/// Delete the downstream subscription and the mounted nodes.
+static void unmount(GatewayState& state) {
+    std::vector<PendingWrite> writes;
+    std::vector<PendingCall> calls;
+    {
+        const std::lock_guard lock(state.mutex);
+        state.mounted = false;
+        std::swap(writes, state.writes);
+        std::swap(calls, state.calls);
+    }
+    for (auto& write : writes) {
+        write.answer(UA_STATUSCODE_BADSHUTDOWN);
+    }
+    for (auto& call : calls) {
+        auto result = makeCallResult(UA_STATUSCODE_BADSHUTDOWN);
+        call.answer(result);
+    }
+    // ignore errors, e.g. if the downstream server failed
+    (void)services::deleteSubscription(state.client, state.subscriptionId);
+    state.monitoredItems.clear();
+    // delete children before parents
+    for (auto it = state.order.rbegin(); it != state.order.rend(); ++it) {
+        (void)services::deleteNode(state.server, *it, true);
+    }
+    state.order.clear();
+    state.nodes.clear();
+}
+
+GatewayMount::GatewayMount(
+    Server& server,
+    Client& downstream,
+    std::string_view name,
+    const NodeId& remoteRoot,
+    const NodeId& localFolder,
+    GatewayOptions options
+)
+    : state_(std::make_shared<GatewayState>(server, downstream, name, std::move(options))) {
+    auto& state = *state_;
+    state.namespaceIndex = server.registerNamespace(state.options.namespaceUri);
+    state.mountId = makeLocalId(state, remoteRoot);
+
+    const auto subscription = services::createSubscription(
+        downstream, state.options.subscriptionParameters, true, {}, {}
+    );
+    subscription.responseHeader().serviceResult().throwIfBad();
+    state.subscriptionId = subscription.subscriptionId();
+
+    try {
+        const auto folder = services::addFolder(
+            server,
+            localFolder,
+            state.mountId,
+            name,
+            ObjectAttributes{}.setDisplayName(LocalizedText("", name)),
+            ReferenceTypeId::Organizes
+        );
+        folder.code().throwIfBad();
+        state.order.push_back(state.mountId);
+        auto root = std::make_unique<MountedNode>(
+            MountedNode{remoteRoot, {}, NodeClass::Object, false, nullptr}
+        );
+        auto& rootNode = *root;
+        state.nodes.emplace(state.mountId, std::move(root));
+        std::vector<MountedNode*> variables;
+        expandNode(state, state.mountId, rootNode, state.options.maxDepth, variables);
+        subscribeValues(state, variables);
+    } catch (...) {
+        unmount(state);
+        throw;
+    }
+}
+
+GatewayMount::~GatewayMount() {
+    unmount(*state_);
+}
+
+const NodeId& GatewayMount::mountId() const noexcept {
+    return state_->mountId;
+}
+
+NodeId GatewayMount::localId(const NodeId& remoteId) const {
+    return makeLocalId(*state_, remoteId);
+}
+
+std::optional<NodeId> GatewayMount::remoteId(const NodeId& localId) const {
+    const auto it = state_->nodes.find(localId);
+    if (it == state_->nodes.end()) {
+        return std::nullopt;
+    }
+    return it->second->remoteId;
+}
+
+size_t GatewayMount::expand(const NodeId& localId) {
+    auto& state = *state_;
+    const auto it = state.nodes.find(localId);
+    if (it == state.nodes.end()) {
+        throw BadStatus(UA_STATUSCODE_BADNODEIDUNKNOWN);
+    }
+    std::vector<MountedNode*> variables;
+    const size_t mounted = expandNode(state, localId, *it->second, 1, variables);
+    subscribeValues(state, variables);
+    return mounted;
+}
+
+void GatewayMount::dispatch() {
+#if UAPP_HAS_ASYNC_METHODS
+    if (state_->options.asyncMethods) {
+        takeAsyncCalls(state_->server);
+    }
+#endif
+    std::vector<PendingWrite> writes;
+    std::vector<PendingCall> calls;
+    {
+        const std::lock_guard lock(state_->mutex);
+        std::swap(writes, state_->writes);
+        std::swap(calls, state_->calls);
+    }
+
+    // initiation errors are not thrown but stored in the exception catcher of the client and the
+    // completion handlers are destroyed without invocation, the guards answer them
+    if (!writes.empty()) {
+        std::vector<WriteValue> values;
+        values.reserve(writes.size());
+        auto answers = std::make_shared<std::vector<std::function<void(StatusCode)>>>();
+        answers->reserve(writes.size());
+        for (auto& write : writes) {
+            values.push_back(std::move(write.value));
+            answers->push_back(std::move(write.answer));
+        }
+        auto onAbandon = [answers]() {
+            for (auto& answer : *answers) {
+                answer(UA_STATUSCODE_BADCOMMUNICATIONERROR);
+            }
+        };
+        services::writeAsync(
+            state_->client,
+            values,
+            [answers, guard = detail::ScopeExit(std::move(onAbandon))](
+                const WriteResponse& response
+            ) mutable {
+                guard.release();
+                const StatusCode serviceResult = response.responseHeader().serviceResult();
+                const auto results = response.results();
+                for (size_t i = 0; i < answers->size(); ++i) {
+                    if (serviceResult.isBad()) {
+                        (*answers)[i](serviceResult);
+                    } else if (i < results.size()) {
+                        (*answers)[i](results[i]);
+                    } else {
+                        (*answers)[i](UA_STATUSCODE_BADUNEXPECTEDERROR);
+                    }
+                }
+            }
+        );
+    }
+
+    for (auto& call : calls) {
+        auto answer = std::make_shared<std::function<void(CallMethodResult&)>>(
+            std::move(call.answer)
+        );
+        auto onAbandon = [state = state_, answer]() {
+            {
+                const std::lock_guard lock(state->mutex);
+                ++state->statistics.failedCalls;
+            }
+            auto result = makeCallResult(UA_STATUSCODE_BADCOMMUNICATIONERROR);
+            (*answer)(result);
+        };
+        services::callAsync(
+            state_->client,
+            call.objectId,
+            call.methodId,
+            call.inputArguments,
+            [state = state_, answer, guard = detail::ScopeExit(std::move(onAbandon))](
+                CallMethodResult& result
+            ) mutable {
+                guard.release();
+                if (result.statusCode().isBad()) {
+                    const std::lock_guard lock(state->mutex);
+                    ++state->statistics.failedCalls;
+                }
+                (*answer)(result);
+            }
+        );
+    }
+}
+
+void GatewayMount::runIterate(uint16_t timeoutMilliseconds) {
+    dispatch();
+    state_->client.runIterate(timeoutMilliseconds);
+}
+
+GatewayStatistics GatewayMount::statistics() const {
+    const std::lock_guard lock(state_->mutex);
+    GatewayStatistics statistics = state_->statistics;
+    statistics.mountedNodes = state_->nodes.size() - 1;  // without mount folder
+    return statistics;
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,206 @@
+#include "open62541pp/limitalarm.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+#include <algorithm>  // max, min
+#include <cmath>  // isnan
+#include <stdexcept>
+
+#include "open62541pp/server.hpp"
+
+namespace opcua {
+
+std::string_view getLimitStateName(LimitState state) noexcept {
+    switch (state) {
+    case LimitState::LowLow:
+        return "LowLow";
+    case LimitState::Low:
+        return "Low";
+    case LimitState::Normal:
+        return "Normal";
+    case LimitState::High:
+        return "High";
+    case LimitState::HighHigh:
+        return "HighHigh";
+    default:
+        return "Unknown";
+    }
+}
+
+static size_t severityIndex(LimitState state) noexcept {
+    return static_cast<size_t>(static_cast<int>(state) + 2);
+}
+
+/// Evaluate the new states of a contiguous batch.
+/// The loop is free of branches and data-dependent control flow to allow auto-vectorization.
+static void evaluateStates(
+    size_t size,
+    const double* values,
+    const double* highHighs,
+    const double* highs,
+    const double* lows,
+    const double* lowLows,
+    const double* deadbands,
+    const int8_t* states,
+    int8_t* newStates
+) noexcept {
+    for (size_t i = 0; i < size; ++i) {
+        const double value = values[i];
+        const double deadband = deadbands[i];
+        const int state = states[i];
+        // state entered by the value
+        const int entered = static_cast<int>(value >= highs[i]) +
+            static_cast<int>(value >= highHighs[i]) - static_cast<int>(value <= lows[i]) -
+            static_cast<int>(value <= lowLows[i]);
+        // state kept by the value (limits relaxed by the deadband)
+        const int kept = static_cast<int>(value > highs[i] - deadband) +
+            static_cast<int>(value > highHighs[i] - deadband) -
+            static_cast<int>(value < lows[i] + deadband) -
+            static_cast<int>(value < lowLows[i] + deadband);
+        int next = entered;
+        next = state > 0 ? std::max(entered, std::min(state, kept)) : next;
+        next = state < 0 ? std::min(entered, std::max(state, kept)) : next;
+        newStates[i] = static_cast<int8_t>(std::isnan(value) ? state : next);
+    }
+}
+
+LimitAlarmEngine::LimitAlarmEngine(Server& connection, NodeId originId, const NodeId& eventType)
+    : originId_(std::move(originId)),
+      event_(connection, eventType) {}
+
+void LimitAlarmEngine::reserve(size_t size) {
+    sourceNodes_.reserve(size);
+    sourceNames_.reserve(size);
+    highHighs_.reserve(size);
+    highs_.reserve(size);
+    lows_.reserve(size);
+    lowLows_.reserve(size);
+    deadbands_.reserve(size);
+    states_.reserve(size);
+}
+
+size_t LimitAlarmEngine::add(
+    const NodeId& sourceNode, std::string_view sourceName, const LimitAlarmLimits& limits
+) {
+    sourceNodes_.push_back(sourceNode);
+    sourceNames_.emplace_back(sourceName);
+    highHighs_.push_back(limits.highHigh);
+    highs_.push_back(limits.high);
+    lows_.push_back(limits.low);
+    lowLows_.push_back(limits.lowLow);
+    deadbands_.push_back(limits.deadband);
+    states_.push_back(static_cast<int8_t>(LimitState::Normal));
+    return size() - 1;
+}
+
+void LimitAlarmEngine::setLimits(size_t alarm, const LimitAlarmLimits& limits) {
+    if (alarm >= size()) {
+        throw std::out_of_range("Alarm index out of range");
+    }
+    highHighs_[alarm] = limits.highHigh;
+    highs_[alarm] = limits.high;
+    lows_[alarm] = limits.low;
+    lowLows_[alarm] = limits.lowLow;
+    deadbands_[alarm] = limits.deadband;
+}
+
+void LimitAlarmEngine::setSeverity(LimitState state, uint16_t severity) noexcept {
+    const size_t index = severityIndex(state);
+    if (index < severities_.size()) {
+        severities_[index] = severity;
+    }
+}
+
+void LimitAlarmEngine::update(size_t alarm, double value, DateTime time) {
+    update({&alarm, 1}, {&value, 1}, time);
+}
+
+void LimitAlarmEngine::update(
+    Span<const size_t> alarms, Span<const double> values, DateTime time
+) {
+    if (alarms.size() != values.size()) {
+        throw std::invalid_argument("Number of alarms and values must be equal");
+    }
+    const size_t count = alarms.size();
+    for (auto& column : gathered_) {
+        column.resize(count);
+    }
+    gatheredStates_.resize(count);
+    newStates_.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        const size_t alarm = alarms[i];
+        if (alarm >= size()) {
+            throw std::out_of_range("Alarm index out of range");
+        }
+        gathered_[0][i] = highHighs_[alarm];
+        gathered_[1][i] = highs_[alarm];
+        gathered_[2][i] = lows_[alarm];
+        gathered_[3][i] = lowLows_[alarm];
+        gathered_[4][i] = deadbands_[alarm];
+        gatheredStates_[i] = states_[alarm];
+    }
+    evaluateStates(
+        count,
+        values.data(),
+        gathered_[0].data(),
+        gathered_[1].data(),
+        gathered_[2].data(),
+        gathered_[3].data(),
+        gathered_[4].data(),
+        gatheredStates_.data(),
+        newStates_.data()
+    );
+    for (size_t i = 0; i < count; ++i) {
+        if (newStates_[i] != gatheredStates_[i]) {
+            const size_t alarm = alarms[i];
+            states_[alarm] = newStates_[i];
+            emitTransition(alarm, static_cast<LimitState>(gatheredStates_[i]), values[i], time);
+        }
+    }
+}
+
+void LimitAlarmEngine::updateAll(Span<const double> values, DateTime time) {
+    if (values.size() != size()) {
+        throw std::invalid_argument("Number of values must be equal to the number of alarms");
+    }
+    newStates_.resize(size());
+    evaluateStates(
+        size(),
+        values.data(),
+        highHighs_.data(),
+        highs_.data(),
+        lows_.data(),
+        lowLows_.data(),
+        deadbands_.data(),
+        states_.data(),
+        newStates_.data()
+    );
+    for (size_t alarm = 0; alarm < size(); ++alarm) {
+        if (newStates_[alarm] != states_[alarm]) {
+            const auto from = static_cast<LimitState>(states_[alarm]);
+            states_[alarm] = newStates_[alarm];
+            emitTransition(alarm, from, values[alarm], time);
+        }
+    }
+}
+
+void LimitAlarmEngine::emitTransition(
+    size_t alarm, LimitState from, double value, DateTime time
+) {
+    const auto to = state(alarm);
+    if (onTransition_) {
+        onTransition_(alarm, from, to, value);
+    }
+    std::string message(sourceNames_[alarm]);
+    message.append(": ").append(getLimitStateName(to));
+    event_.writeProperty({0, "SourceNode"}, Variant(sourceNodes_[alarm]))
+        .writeSourceName(sourceNames_[alarm])
+        .writeTime(time)
+        .writeSeverity(severities_[severityIndex(to)])
+        .writeMessage({"", message});
+    event_.trigger(originId_);
+}
+
+}  // namespace opcua
+
+#endif
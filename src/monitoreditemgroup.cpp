@@ -0,0 +1,261 @@
+#include "open62541pp/monitoreditemgroup.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // find, min
+#include <memory>
+#include <utility>  // move
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"  // readValue
+#include "open62541pp/services/monitoreditem.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+namespace opcua {
+
+/// Send all requests at once and run the client until all responses are received.
+template <typename Response, typename Request, typename SendAsync>
+static std::vector<Response> sendPipelined(
+    Client& client, const std::vector<Request>& requests, SendAsync&& sendAsync
+) {
+    struct State {
+        std::vector<Response> responses;
+        size_t pending{0};
+    };
+
+    // shared with the callbacks, which might be called after an exception
+    auto state = std::make_shared<State>();
+    state->responses.resize(requests.size());
+    for (size_t i = 0; i < requests.size(); ++i) {
+        ++state->pending;
+        sendAsync(client, requests[i], [state, i](Response& response) {
+            state->responses[i] = std::move(response);
+            --state->pending;
+        });
+    }
+    while (state->pending > 0) {
+        client.runIterate(100);
+    }
+    return std::move(state->responses);
+}
+
+/// Send requests one after another (fallback without async services).
+template <typename Response, typename Request, typename Send>
+[[maybe_unused]] static std::vector<Response> sendSequential(
+    Client& client, const std::vector<Request>& requests, Send&& send
+) {
+    std::vector<Response> responses;
+    responses.reserve(requests.size());
+    for (const auto& request : requests) {
+        responses.push_back(send(client, request));
+    }
+    return responses;
+}
+
+/// Map the results of the chunk responses to the results of all items.
+template <typename Result, typename Response, typename SetStatus>
+static std::vector<Result> mergeResults(
+    const std::vector<Response>& responses, Span<const size_t> chunkSizes, SetStatus&& setStatus
+) {
+    std::vector<Result> results;
+    for (size_t chunk = 0; chunk < responses.size(); ++chunk) {
+        const auto& response = responses[chunk];
+        const StatusCode serviceResult = response.responseHeader().serviceResult();
+        const auto chunkResults = response.results();
+        for (size_t i = 0; i < chunkSizes[chunk]; ++i) {
+            if (serviceResult.isBad() || i >= chunkResults.size()) {
+                auto& result = results.emplace_back();
+                setStatus(
+                    result,
+                    serviceResult.isBad() ? serviceResult
+                                          : StatusCode(UA_STATUSCODE_BADUNEXPECTEDERROR)
+                );
+            } else {
+                results.push_back(chunkResults[i]);
+            }
+        }
+    }
+    return results;
+}
+
+MonitoredItemGroup::MonitoredItemGroup(
+    Subscription<Client> subscription,
+    Span<const IntegerId> monitoredItemIds,
+    size_t maxItemsPerCall
+)
+    : subscription_(subscription) {
+    if (maxItemsPerCall > 0) {
+        maxItemsPerCall_ = maxItemsPerCall;
+    }
+    add(monitoredItemIds);
+}
+
+void MonitoredItemGroup::add(IntegerId monitoredItemId) {
+    if (members_.insert(monitoredItemId).second) {
+        ids_.push_back(monitoredItemId);
+    }
+}
+
+void MonitoredItemGroup::add(const MonitoredItem<Client>& monitoredItem) {
+    add(monitoredItem.monitoredItemId());
+}
+
+void MonitoredItemGroup::add(Span<const IntegerId> monitoredItemIds) {
+    ids_.reserve(ids_.size() + monitoredItemIds.size());
+    members_.reserve(members_.size() + monitoredItemIds.size());
+    for (const auto id : monitoredItemIds) {
+        add(id);
+    }
+}
+
+void MonitoredItemGroup::remove(IntegerId monitoredItemId) {
+    if (members_.erase(monitoredItemId) > 0) {
+        ids_.erase(std::find(ids_.begin(), ids_.end(), monitoredItemId));
+    }
+}
+
+/// Split the monitored items into chunks and create a request per chunk.
+template <typename Request, typename CreateRequest>
+static std::vector<Request> createChunkedRequests(
+    Span<const IntegerId> ids,
+    size_t maxItemsPerCall,
+    std::vector<size_t>& chunkSizes,
+    CreateRequest&& createRequest
+) {
+    const size_t chunkSize = maxItemsPerCall == 0 ? ids.size() : maxItemsPerCall;
+    std::vector<Request> requests;
+    for (size_t first = 0; first < ids.size(); first += chunkSize) {
+        const size_t count = std::min(chunkSize, ids.size() - first);
+        requests.push_back(createRequest(ids.subview(first, count)));
+        chunkSizes.push_back(count);
+    }
+    return requests;
+}
+
+std::vector<StatusCode> MonitoredItemGroup::setMonitoringMode(MonitoringMode monitoringMode) {
+    std::vector<size_t> chunkSizes;
+    const auto requests = createChunkedRequests<SetMonitoringModeRequest>(
+        ids_, maxItemsPerCall(), chunkSizes, [&](Span<const IntegerId> ids) {
+            return SetMonitoringModeRequest(
+                {}, subscription_.subscriptionId(), monitoringMode, ids
+            );
+        }
+    );
+    const auto responses = sendPipelined<SetMonitoringModeResponse>(
+        subscription_.connection(),
+        requests,
+        [](Client& client, const SetMonitoringModeRequest& request, auto&& token) {
+            services::setMonitoringModeAsync(client, request, std::forward<decltype(token)>(token));
+        }
+    );
+    return mergeResults<StatusCode>(responses, chunkSizes, [](StatusCode& result, StatusCode code) {
+        result = code;
+    });
+}
+
+std::vector<MonitoredItemModifyResult> MonitoredItemGroup::modify(
+    const MonitoringParametersEx& parameters
+) {
+    const MonitoringParameters requestedParameters(
+        parameters.samplingInterval,
+        parameters.filter,
+        parameters.queueSize,
+        parameters.discardOldest
+    );
+    std::vector<size_t> chunkSizes;
+    const auto requests = createChunkedRequests<ModifyMonitoredItemsRequest>(
+        ids_, maxItemsPerCall(), chunkSizes, [&](Span<const IntegerId> ids) {
+            std::vector<MonitoredItemModifyRequest> items;
+            items.reserve(ids.size());
+            for (const auto id : ids) {
+                items.emplace_back(id, requestedParameters);
+            }
+            return ModifyMonitoredItemsRequest(
+                {}, subscription_.subscriptionId(), parameters.timestamps, items
+            );
+        }
+    );
+#if UAPP_HAS_ASYNC_SUBSCRIPTIONS
+    const auto responses = sendPipelined<ModifyMonitoredItemsResponse>(
+        subscription_.connection(),
+        requests,
+        [](Client& client, const ModifyMonitoredItemsRequest& request, auto&& token) {
+            services::modifyMonitoredItemsAsync(
+                client, request, std::forward<decltype(token)>(token)
+            );
+        }
+    );
+#else
+    const auto responses = sendSequential<ModifyMonitoredItemsResponse>(
+        subscription_.connection(),
+        requests,
+        [](Client& client, const ModifyMonitoredItemsRequest& request) {
+            return services::modifyMonitoredItems(client, request);
+        }
+    );
+#endif
+    return mergeResults<MonitoredItemModifyResult>(
+        responses,
+        chunkSizes,
+        [](MonitoredItemModifyResult& result, StatusCode code) { result->statusCode = code; }
+    );
+}
+
+std::vector<StatusCode> MonitoredItemGroup::deleteMonitoredItems() {
+    std::vector<size_t> chunkSizes;
+    const auto requests = createChunkedRequests<DeleteMonitoredItemsRequest>(
+        ids_, maxItemsPerCall(), chunkSizes, [&](Span<const IntegerId> ids) {
+            return DeleteMonitoredItemsRequest({}, subscription_.subscriptionId(), ids);
+        }
+    );
+#if UAPP_HAS_ASYNC_SUBSCRIPTIONS
+    const auto responses = sendPipelined<DeleteMonitoredItemsResponse>(
+        subscription_.connection(),
+        requests,
+        [](Client& client, const DeleteMonitoredItemsRequest& request, auto&& token) {
+            services::deleteMonitoredItemsAsync(
+                client, request, std::forward<decltype(token)>(token)
+            );
+        }
+    );
+#else
+    const auto responses = sendSequential<DeleteMonitoredItemsResponse>(
+        subscription_.connection(),
+        requests,
+        [](Client& client, const DeleteMonitoredItemsRequest& request) {
+            return services::deleteMonitoredItems(client, request);
+        }
+    );
+#endif
+    auto results = mergeResults<StatusCode>(
+        responses, chunkSizes, [](StatusCode& result, StatusCode code) { result = code; }
+    );
+
+    // remove deleted items from the group
+    std::vector<IntegerId> remaining;
+    for (size_t i = 0; i < ids_.size(); ++i) {
+        if (results[i].isBad() && results[i] != UA_STATUSCODE_BADMONITOREDITEMIDINVALID) {
+            remaining.push_back(ids_[i]);
+        } else {
+            members_.erase(ids_[i]);
+        }
+    }
+    ids_ = std::move(remaining);
+    return results;
+}
+
+size_t MonitoredItemGroup::maxItemsPerCall() {
+    if (!maxItemsPerCall_.has_value()) {
+        const auto result = services::readValue(
+            subscription_.connection(),
+            NodeId(VariableId::Server_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall)
+        );
+        const bool valid = result && result->isScalar() && result->isType<uint32_t>();
+        maxItemsPerCall_ = valid ? result->scalar<uint32_t>() : 0U;
+    }
+    return maxItemsPerCall_.value();
+}
+
+}  // namespace opcua
+
+#endif
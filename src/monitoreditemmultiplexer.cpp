@@ -0,0 +1,148 @@
+#include "open62541pp/monitoreditemmultiplexer.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // find
+#include <functional>  // hash
+#include <utility>  // move
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/types_handling.hpp"  // hash, isEqual
+#include "open62541pp/exception.hpp"
+
+namespace opcua {
+
+static size_t hashCombine(size_t seed, size_t value) noexcept {
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+size_t MonitoredItemMultiplexer::KeyHash::operator()(const Key& key) const noexcept {
+    size_t seed = key.id.hash();
+    seed = hashCombine(seed, static_cast<size_t>(key.attribute));
+    seed = hashCombine(seed, std::hash<double>{}(key.parameters.samplingInterval));
+    seed = hashCombine(
+        seed, detail::hash(key.parameters.filter.handle(), UA_TYPES[UA_TYPES_EXTENSIONOBJECT])
+    );
+    return seed;
+}
+
+bool MonitoredItemMultiplexer::KeyEqual::operator()(const Key& lhs, const Key& rhs) const noexcept {
+    const auto& a = lhs.parameters;
+    const auto& b = rhs.parameters;
+    return lhs.id == rhs.id && lhs.attribute == rhs.attribute &&
+           a.samplingInterval == b.samplingInterval && a.queueSize == b.queueSize &&
+           a.discardOldest == b.discardOldest && a.timestamps == b.timestamps &&
+           detail::isEqual(
+               a.filter.handle(), b.filter.handle(), UA_TYPES[UA_TYPES_EXTENSIONOBJECT]
+           );
+}
+
+MonitoredItemMultiplexer::MonitoredItemMultiplexer(
+    Client& client, const SubscriptionParameters& parameters
+)
+    : client_(client) {
+    const auto response = services::createSubscription(client, parameters, true, {}, {});
+    response.responseHeader().serviceResult().throwIfBad();
+    subscriptionId_ = response.subscriptionId();
+}
+
+MonitoredItemMultiplexer::~MonitoredItemMultiplexer() {
+    // ignore errors, e.g. if the session is already closed
+    (void)services::deleteSubscription(client_, subscriptionId_);
+}
+
+IntegerId MonitoredItemMultiplexer::subscribeDataChange(
+    const NodeId& id,
+    AttributeId attribute,
+    const MonitoringParametersEx& parameters,
+    DataChangeNotificationCallback onDataChange
+) {
+    Key key{id, attribute, parameters};
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        const auto result = services::createMonitoredItemDataChange(
+            client_,
+            subscriptionId_,
+            ReadValueId(id, attribute),
+            MonitoringMode::Reporting,
+            parameters,
+            [this](IntegerId, IntegerId monId, const DataValue& value) { notify(monId, value); },
+            {}
+        );
+        result.statusCode().throwIfBad();
+        const IntegerId monitoredItemId = result.monitoredItemId();
+        items_.emplace(monitoredItemId, Item{key, {}, std::nullopt});
+        it = index_.emplace(std::move(key), monitoredItemId).first;
+    }
+
+    const IntegerId monitoredItemId = it->second;
+    const IntegerId handle = nextHandle_++;
+    auto callback = std::make_shared<const DataChangeNotificationCallback>(std::move(onDataChange));
+    auto& item = items_.at(monitoredItemId);
+    item.subscribers.push_back(handle);
+    subscribers_.emplace(handle, Subscriber{monitoredItemId, callback});
+
+    // replay the initial notification for late subscribers
+    if (item.lastValue.has_value() && *callback) {
+        const DataValue lastValue = *item.lastValue;
+        (*callback)(subscriptionId_, monitoredItemId, lastValue);
+    }
+    return handle;
+}
+
+void MonitoredItemMultiplexer::unsubscribe(IntegerId handle) {
+    const IntegerId monitoredItemId = getSubscriber(handle).monitoredItemId;
+    subscribers_.erase(handle);
+    const auto it = items_.find(monitoredItemId);
+    auto& subscribers = it->second.subscribers;
+    subscribers.erase(std::find(subscribers.begin(), subscribers.end(), handle));
+    if (!subscribers.empty()) {
+        return;
+    }
+    // last subscriber
+    index_.erase(it->second.key);
+    items_.erase(it);
+    services::deleteMonitoredItem(client_, subscriptionId_, monitoredItemId).throwIfBad();
+}
+
+IntegerId MonitoredItemMultiplexer::monitoredItemId(IntegerId handle) const {
+    return getSubscriber(handle).monitoredItemId;
+}
+
+size_t MonitoredItemMultiplexer::subscriberCount(IntegerId handle) const {
+    return items_.at(getSubscriber(handle).monitoredItemId).subscribers.size();
+}
+
+void MonitoredItemMultiplexer::notify(IntegerId monitoredItemId, const DataValue& value) {
+    const auto it = items_.find(monitoredItemId);
+    if (it == items_.end()) {
+        return;
+    }
+    it->second.lastValue = value;
+    // callbacks might (un)subscribe, iterate over a snapshot of the subscribers
+    const std::vector<IntegerId> handles = it->second.subscribers;
+    for (const IntegerId handle : handles) {
+        const auto subscriber = subscribers_.find(handle);
+        if (subscriber == subscribers_.end()) {
+            continue;  // unsubscribed by a previous callback
+        }
+        const CallbackPtr callback = subscriber->second.callback;  // keep alive during the call
+        if (*callback) {
+            (*callback)(subscriptionId_, monitoredItemId, value);
+        }
+    }
+}
+
+const MonitoredItemMultiplexer::Subscriber& MonitoredItemMultiplexer::getSubscriber(
+    IntegerId handle
+) const {
+    const auto it = subscribers_.find(handle);
+    if (it == subscribers_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    return it->second;
+}
+
+}  // namespace opcua
+
+#endif
@@ -25,12 +25,19 @@ static const WrapperType& asWrapperRef(const NativeType* nativePtr) {
     return nativePtr == nullptr ? empty : asWrapper<WrapperType>(*nativePtr);
 }
 
-static std::optional<Session> getSession(UA_Server* server, const UA_NodeId* sessionId) noexcept {
+static std::optional<Session> getSession(
+    UA_Server* server, const UA_NodeId* sessionId, void* sessionContext = nullptr
+) noexcept {
     auto* wrapper = asWrapper(server);
     if (wrapper == nullptr) {
         return std::nullopt;
     }
-    return Session(*wrapper, asWrapperRef<NodeId>(sessionId));
+    // the session context is only used by the server for the session context slots
+    return Session(
+        *wrapper,
+        asWrapperRef<NodeId>(sessionId),
+        static_cast<detail::SessionContext*>(sessionContext)
+    );
 }
 
 static void logException(
@@ -67,10 +74,13 @@ static UA_StatusCode activateSessionNative(
     const UA_ByteString* secureChannelRemoteCertificate,
     const UA_NodeId* sessionId,
     const UA_ExtensionObject* userIdentityToken,
-    [[maybe_unused]] void** sessionContext
+    void** sessionContext
 ) {
     return invokeAccessCallback(server, "activateSession", UA_STATUSCODE_BADINTERNALERROR, [&] {
-        auto session = getSession(server, sessionId);
+        // the server sets the session context to the context slots before this call
+        auto session = getSession(
+            server, sessionId, sessionContext == nullptr ? nullptr : *sessionContext
+        );
         return getAdapter(ac)
             .activateSession(
                 session.value(),
@@ -88,7 +98,7 @@ static void closeSessionNative(
     const UA_NodeId* sessionId,
     [[maybe_unused]] void* sessionContext
 ) {
-    invokeAccessCallback(server, "activateSession", UA_STATUSCODE_GOOD, [&] {
+    invokeAccessCallback(server, "closeSession", UA_STATUSCODE_GOOD, [&] {
         auto session = getSession(server, sessionId);
         getAdapter(ac).closeSession(session.value());  // NOLINT(bugprone-unchecked-optional-access)
         return UA_STATUSCODE_GOOD;
@@ -99,12 +109,12 @@ static UA_UInt32 getUserRightsMaskNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     [[maybe_unused]] void* nodeContext
 ) {
     return invokeAccessCallback(server, "getUserRightsMask", UA_UInt32{}, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac)
             .getUserRightsMask(session.value(), asWrapperRef<NodeId>(nodeId))
             .get();
@@ -115,12 +125,12 @@ static UA_Byte getUserAccessLevelNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     [[maybe_unused]] void* nodeContext
 ) {
     return invokeAccessCallback(server, "getUserAccessLevel", UA_Byte{}, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac)
             .getUserAccessLevel(session.value(), asWrapperRef<NodeId>(nodeId))
             .get();
@@ -131,12 +141,12 @@ static UA_Boolean getUserExecutableNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* methodId,
     [[maybe_unused]] void* methodContext
 ) {
     return invokeAccessCallback(server, "getUserExecutable", false, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac).getUserExecutable(session.value(), asWrapperRef<NodeId>(methodId));
     });
 }
@@ -145,14 +155,14 @@ static UA_Boolean getUserExecutableOnObjectNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* methodId,
     [[maybe_unused]] void* methodContext,
     const UA_NodeId* objectId,
     [[maybe_unused]] void* objectContext
 ) {
     return invokeAccessCallback(server, "getUserExecutableOnObject", false, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac).getUserExecutableOnObject(
             session.value(), asWrapperRef<NodeId>(methodId), asWrapperRef<NodeId>(objectId)
         );
@@ -163,11 +173,11 @@ static UA_Boolean allowAddNodeNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_AddNodesItem* item
 ) {
     return invokeAccessCallback(server, "allowAddNode", false, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac).allowAddNode(session.value(), asWrapperRef<AddNodesItem>(item));
     });
 }
@@ -176,11 +186,11 @@ static UA_Boolean allowAddReferenceNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_AddReferencesItem* item
 ) {
     return invokeAccessCallback(server, "allowAddReference", false, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac).allowAddReference(
             session.value(), asWrapperRef<AddReferencesItem>(item)
         );
@@ -191,11 +201,11 @@ static UA_Boolean allowDeleteNodeNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_DeleteNodesItem* item
 ) {
     return invokeAccessCallback(server, "allowDeleteNode", false, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac).allowDeleteNode(session.value(), asWrapperRef<DeleteNodesItem>(item));
     });
 }
@@ -204,11 +214,11 @@ static UA_Boolean allowDeleteReferenceNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_DeleteReferencesItem* item
 ) {
     return invokeAccessCallback(server, "allowDeleteReference", false, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac).allowDeleteReference(
             session.value(), asWrapperRef<DeleteReferencesItem>(item)
         );
@@ -219,12 +229,12 @@ static UA_Boolean allowDeleteReferenceNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     [[maybe_unused]] void* nodeContext
 ) {
     return invokeAccessCallback(server, "allowBrowseNode", false, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac).allowBrowseNode(session.value(), asWrapperRef<NodeId>(nodeId));
     });
 }
@@ -234,13 +244,13 @@ static UA_Boolean allowDeleteReferenceNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* oldSessionId,
-    [[maybe_unused]] void* oldSessionContext,
+    void* oldSessionContext,
     const UA_NodeId* newSessionId,
-    [[maybe_unused]] void* newSessionContext
+    void* newSessionContext
 ) {
     return invokeAccessCallback(server, "allowTransferSubscription", false, [&] {
-        auto oldSession = getSession(server, oldSessionId);
-        auto newSession = getSession(server, newSessionId);
+        auto oldSession = getSession(server, oldSessionId, oldSessionContext);
+        auto newSession = getSession(server, newSessionId, newSessionContext);
         return getAdapter(ac).allowTransferSubscription(oldSession.value(), newSession.value());
     });
 }
@@ -251,13 +261,13 @@ static UA_Boolean allowHistoryUpdateUpdateDataNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     UA_PerformUpdateType performInsertReplace,
     const UA_DataValue* value
 ) {
     return invokeAccessCallback(server, "allowHistoryUpdate", false, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac).allowHistoryUpdate(
             session.value(),
             asWrapperRef<NodeId>(nodeId),
@@ -271,14 +281,14 @@ static UA_Boolean allowHistoryUpdateDeleteRawModifiedNative(
     UA_Server* server,
     UA_AccessControl* ac,
     const UA_NodeId* sessionId,
-    [[maybe_unused]] void* sessionContext,
+    void* sessionContext,
     const UA_NodeId* nodeId,
     UA_DateTime startTimestamp,
     UA_DateTime endTimestamp,
     bool isDeleteModified
 ) {
     return invokeAccessCallback(server, "allowHistoryDelete", false, [&] {
-        auto session = getSession(server, sessionId);
+        auto session = getSession(server, sessionId, sessionContext);
         return getAdapter(ac).allowHistoryDelete(
             session.value(),
             asWrapperRef<NodeId>(nodeId),
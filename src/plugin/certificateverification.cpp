@@ -0,0 +1,232 @@
+#include "open62541pp/plugin/certificateverification.hpp"
+
+#include <algorithm>  // min, max
+#include <atomic>
+#include <future>
+#include <iterator>  // next
+#include <string_view>
+#include <type_traits>  // remove_reference_t
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/wrapper.hpp"  // asWrapper
+
+namespace opcua {
+
+static CertificateVerificationCache& getAdapter(void* context) noexcept {
+    return *static_cast<CertificateVerificationCache*>(context);
+}
+
+/// Forward the native plugin function to the decorated plugin.
+template <typename F>
+struct Forwarder;
+
+#if UAPP_OPEN62541_VER_GE(1, 4)
+template <typename R, typename... Args>
+struct Forwarder<R (*)(UA_CertificateGroup*, Args...)> {
+    template <auto Member, bool Invalidate>
+    static R invoke(UA_CertificateGroup* group, Args... args) {
+        auto& adapter = getAdapter(group->context);
+        auto& plugin = adapter.plugin();
+        if constexpr (Invalidate) {
+            const R result = (plugin.*Member)(&plugin, args...);
+            adapter.invalidate();
+            return result;
+        } else {
+            return (plugin.*Member)(&plugin, args...);
+        }
+    }
+};
+#else
+template <typename R, typename... Args>
+struct Forwarder<R (*)(void*, Args...)> {
+    template <auto Member, bool Invalidate>
+    static R invoke(void* context, Args... args) {
+        auto& plugin = getAdapter(context).plugin();
+        return (plugin.*Member)(plugin.context, args...);
+    }
+};
+#endif
+
+template <auto Member, bool Invalidate = false>
+static void forward(
+    NativeCertificateVerification& native, const NativeCertificateVerification& plugin
+) noexcept {
+    using F = std::remove_reference_t<decltype(native.*Member)>;
+    native.*Member = (plugin.*Member != nullptr)
+        ? &Forwarder<F>::template invoke<Member, Invalidate>
+        : nullptr;
+}
+
+static UA_StatusCode verifyCertificateNative(
+    CertificateVerificationCache& adapter, const UA_ByteString* certificate
+) noexcept {
+    if (certificate == nullptr) {
+        return UA_STATUSCODE_BADINTERNALERROR;
+    }
+    try {
+        return adapter.verifyCertificate(asWrapper<ByteString>(*certificate)).get();
+    } catch (...) {
+        return UA_STATUSCODE_BADINTERNALERROR;
+    }
+}
+
+CertificateVerificationCache::CertificateVerificationCache(
+    NativeCertificateVerification&& plugin, CertificateVerificationCacheOptions options
+) noexcept
+    : plugin_(plugin),
+      options_(options) {
+    plugin = {};  // take ownership
+}
+
+CertificateVerificationCache::~CertificateVerificationCache() {
+    detail::clear(plugin_);
+}
+
+StatusCode CertificateVerificationCache::verifyCertificate(const ByteString& certificate) {
+    std::string key(static_cast<std::string_view>(certificate));
+    {
+        const auto now = std::chrono::steady_clock::now();
+        const std::lock_guard lock(mutex_);
+        const auto it = entries_.find(key);
+        if (it != entries_.end()) {
+            if (it->second.expiry > now) {
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return it->second.status;
+            }
+            entries_.erase(it);
+        }
+    }
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    if (plugin_.verifyCertificate == nullptr) {
+        return UA_STATUSCODE_BADINTERNALERROR;
+    }
+    UA_StatusCode status{};
+    {
+        std::unique_lock lock(pluginMutex_, std::defer_lock);
+        if (!options_.concurrentVerification) {
+            lock.lock();
+        }
+#if UAPP_OPEN62541_VER_GE(1, 4)
+        status = plugin_.verifyCertificate(&plugin_, certificate.handle());
+#else
+        status = plugin_.verifyCertificate(plugin_.context, certificate.handle());
+#endif
+    }
+    insert(std::move(key), status);
+    return status;
+}
+
+void CertificateVerificationCache::prevalidate(
+    Span<const ByteString> certificates, size_t workers
+) {
+    if (certificates.empty()) {
+        return;
+    }
+    workers = std::min(std::max(workers, size_t{1}), certificates.size());
+    std::atomic<size_t> next{0};
+    const auto work = [&] {
+        for (size_t i = next++; i < certificates.size(); i = next++) {
+            verifyCertificate(certificates[i]);
+        }
+    };
+    std::vector<std::future<void>> futures;
+    futures.reserve(workers - 1);
+    for (size_t i = 1; i < workers; ++i) {
+        futures.push_back(std::async(std::launch::async, work));
+    }
+    work();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+void CertificateVerificationCache::invalidate() noexcept {
+    const std::lock_guard lock(mutex_);
+    entries_.clear();
+}
+
+size_t CertificateVerificationCache::size() const noexcept {
+    const std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+CertificateVerificationCache::Statistics CertificateVerificationCache::statistics(
+) const noexcept {
+    return {
+        hits_.load(std::memory_order_relaxed),
+        misses_.load(std::memory_order_relaxed),
+    };
+}
+
+void CertificateVerificationCache::insert(std::string&& key, UA_StatusCode status) {
+    if (options_.maxEntries == 0 || options_.ttl <= std::chrono::steady_clock::duration::zero()) {
+        return;
+    }
+    const auto now = std::chrono::steady_clock::now();
+    const std::lock_guard lock(mutex_);
+    if (entries_.size() >= options_.maxEntries) {
+        for (auto it = entries_.begin(); it != entries_.end();) {
+            it = it->second.expiry <= now ? entries_.erase(it) : std::next(it);
+        }
+    }
+    if (entries_.size() >= options_.maxEntries) {
+        entries_.erase(entries_.begin());
+    }
+    entries_.insert_or_assign(std::move(key), Entry{status, now + options_.ttl});
+}
+
+NativeCertificateVerification CertificateVerificationCache::create(bool ownsAdapter) {
+    NativeCertificateVerification native = plugin_;  // shallow copy of the context-free members
+    native.context = this;
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    native.verifyCertificate = [](UA_CertificateGroup* group, const UA_ByteString* certificate) {
+        return verifyCertificateNative(getAdapter(group->context), certificate);
+    };
+    forward<&UA_CertificateGroup::getTrustList>(native, plugin_);
+    forward<&UA_CertificateGroup::setTrustList, true>(native, plugin_);
+    forward<&UA_CertificateGroup::addToTrustList, true>(native, plugin_);
+    forward<&UA_CertificateGroup::removeFromTrustList, true>(native, plugin_);
+    forward<&UA_CertificateGroup::getRejectedList>(native, plugin_);
+    forward<&UA_CertificateGroup::getCertificateCrls>(native, plugin_);
+#else
+    native.verifyCertificate = [](void* context, const UA_ByteString* certificate) {
+        return verifyCertificateNative(getAdapter(context), certificate);
+    };
+    forward<&UA_CertificateVerification::verifyApplicationURI>(native, plugin_);
+#endif
+
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    auto& clear = native.clear;
+#else
+    auto& clear = native.deleteMembers;
+#endif
+    if (ownsAdapter) {
+        clear = [](NativeCertificateVerification* plugin) {
+            if (plugin != nullptr) {
+                delete static_cast<CertificateVerificationCache*>(plugin->context);  // NOLINT
+                plugin->context = nullptr;
+            }
+        };
+    } else {
+        clear = nullptr;
+    }
+    return native;
+}
+
+namespace detail {
+void clear(NativeCertificateVerification& plugin) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    if (plugin.clear != nullptr) {
+        plugin.clear(&plugin);
+    }
+#else
+    if (plugin.deleteMembers != nullptr) {
+        plugin.deleteMembers(&plugin);
+    }
+#endif
+    plugin = {};
+}
+}  // namespace detail
+
+}  // namespace opcua
@@ -0,0 +1,33 @@
+#include "open62541pp/preparedread.hpp"
+
+#include <utility>  // swap
+
+#include "open62541pp/detail/open62541/common.h"
+
+namespace opcua {
+
+PreparedRead::PreparedRead(
+    Client& client,
+    Span<const ReadValueId> nodesToRead,
+    TimestampsToReturn timestamps,
+    double maxAge
+)
+    : client_(client),
+      request_(RequestHeader{}, maxAge, timestamps, nodesToRead) {}
+
+StatusCode PreparedRead::takeResults(ReadResponse& response, Span<DataValue> results) noexcept {
+    const StatusCode serviceResult = response.responseHeader().serviceResult();
+    if (serviceResult.isBad()) {
+        return serviceResult;
+    }
+    auto received = response.results();
+    if (received.size() != results.size()) {
+        return UA_STATUSCODE_BADUNEXPECTEDERROR;
+    }
+    for (size_t i = 0; i < results.size(); ++i) {
+        std::swap(*results[i].handle(), *received[i].handle());
+    }
+    return serviceResult;
+}
+
+}  // namespace opcua
@@ -0,0 +1,236 @@
+#include "open62541pp/redundantclient.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/client_context.hpp"
+#include "open62541pp/exception.hpp"
+
+namespace opcua {
+
+RedundantClient::RedundantClient(Client& primary, Client& backup, RedundantClientOptions options)
+    : clients_{&primary, &backup},
+      options_(std::move(options)) {
+    subscriptionIds_[0] = createSubscription(0);
+    try {
+        subscriptionIds_[1] = createSubscription(1);
+    } catch (const BadStatus&) {
+        (void)services::deleteSubscription(primary, *subscriptionIds_[0]);
+        throw;
+    }
+    for (size_t index = 0; index < clients_.size(); ++index) {
+        auto& client = *clients_[index];
+        client.onDisconnected([this, index] { setFailed(index); });
+        client.onInactive([this, index] { setFailed(index); });
+        client.onSubscriptionInactive([this, index](IntegerId subscriptionId) {
+            if (subscriptionIds_[index] == subscriptionId) {
+                setFailed(index);
+            }
+        });
+    }
+}
+
+RedundantClient::~RedundantClient() {
+    for (size_t index = 0; index < clients_.size(); ++index) {
+        auto& client = *clients_[index];
+        client.onDisconnected({});
+        client.onInactive({});
+        client.onSubscriptionInactive({});
+        if (subscriptionIds_[index].has_value()) {
+            // ignore errors, e.g. if the server failed
+            (void)services::deleteSubscription(client, *subscriptionIds_[index]);
+        }
+    }
+}
+
+void RedundantClient::onFailover(FailoverCallback callback) {
+    failoverCallback_ = std::move(callback);
+}
+
+IntegerId RedundantClient::subscribeDataChange(
+    const NodeId& id,
+    AttributeId attribute,
+    const MonitoringParametersEx& parameters,
+    DataChangeNotificationCallback onDataChange
+) {
+    const IntegerId handle = nextHandle_;
+    Item item{id, attribute, parameters, std::move(onDataChange), {}};
+    item.monitoredItemIds[active_] = createMonitoredItem(active_, handle, item);
+    if (isStandbyAvailable()) {
+        const size_t standby = 1 - active_;
+        try {
+            item.monitoredItemIds[standby] = createMonitoredItem(standby, handle, item);
+        } catch (const BadStatus&) {
+            (void)services::deleteMonitoredItem(
+                active(), *subscriptionIds_[active_], *item.monitoredItemIds[active_]
+            );
+            throw;
+        }
+    }
+    items_.emplace(handle, std::move(item));
+    ++nextHandle_;
+    return handle;
+}
+
+void RedundantClient::unsubscribe(IntegerId handle) {
+    const auto it = items_.find(handle);
+    if (it == items_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    StatusCode status;
+    for (size_t index = 0; index < clients_.size(); ++index) {
+        const auto& monitoredItemId = it->second.monitoredItemIds[index];
+        if (subscriptionIds_[index].has_value() && monitoredItemId.has_value()) {
+            const auto result = services::deleteMonitoredItem(
+                *clients_[index], *subscriptionIds_[index], *monitoredItemId
+            );
+            if (index == active_) {
+                status = result;
+            }
+        }
+    }
+    items_.erase(it);
+    status.throwIfBad();
+}
+
+void RedundantClient::runIterate(uint16_t timeoutMilliseconds) {
+    for (const size_t index : {active_, 1 - active_}) {
+        auto& client = *clients_[index];
+        if (!client.isConnected()) {
+            setFailed(index);
+            continue;
+        }
+        // only errors of the iteration itself indicate a server failure, exceptions of the
+        // user callbacks are rethrown (a pending failure is handled by the next iteration)
+        const StatusCode status = UA_Client_run_iterate(
+            client.handle(), index == active_ ? timeoutMilliseconds : 0
+        );
+        if (status.isBad()) {
+            setFailed(index);
+        }
+        detail::getContext(client).exceptionCatcher.rethrow();
+    }
+    if (failure_.has_value()) {
+        failover();
+    }
+}
+
+void RedundantClient::failover() {
+    const auto start = failure_.value_or(Clock::now());
+    const size_t next = 1 - active_;
+    if (!subscriptionIds_[next].has_value()) {
+        throw BadStatus(UA_STATUSCODE_BADSERVERNOTCONNECTED);
+    }
+
+    // switch all mirrored items in a single request
+    std::vector<IntegerId> monitoredItemIds;
+    monitoredItemIds.reserve(items_.size());
+    for (const auto& [handle, item] : items_) {
+        if (item.monitoredItemIds[next].has_value()) {
+            monitoredItemIds.push_back(*item.monitoredItemIds[next]);
+        }
+    }
+    const auto response = services::setMonitoringMode(
+        *clients_[next],
+        SetMonitoringModeRequest(
+            {}, *subscriptionIds_[next], MonitoringMode::Reporting, monitoredItemIds
+        )
+    );
+    response.responseHeader().serviceResult().throwIfBad();
+
+    const size_t previous = active_;
+    active_ = next;
+    failure_.reset();
+    ++failoverCount_;
+    lastFailoverDuration_ = Clock::now() - start;
+
+    // demote the previous server to standby if it is still reachable
+    bool demoted = false;
+    if (subscriptionIds_[previous].has_value() && clients_[previous]->isConnected()) {
+        monitoredItemIds.clear();
+        for (const auto& [handle, item] : items_) {
+            if (item.monitoredItemIds[previous].has_value()) {
+                monitoredItemIds.push_back(*item.monitoredItemIds[previous]);
+            }
+        }
+        const auto demoteResponse = services::setMonitoringMode(
+            *clients_[previous],
+            SetMonitoringModeRequest(
+                {}, *subscriptionIds_[previous], options_.standbyMode, monitoredItemIds
+            )
+        );
+        demoted = demoteResponse.responseHeader().serviceResult().isGood();
+    }
+    if (!demoted) {
+        setFailed(previous);
+    }
+
+    if (failoverCallback_) {
+        failoverCallback_(active_);
+    }
+}
+
+void RedundantClient::restoreStandby() {
+    const size_t standby = 1 - active_;
+    if (subscriptionIds_[standby].has_value()) {
+        (void)services::deleteSubscription(*clients_[standby], *subscriptionIds_[standby]);
+        subscriptionIds_[standby].reset();
+    }
+    const IntegerId subscriptionId = createSubscription(standby);
+    subscriptionIds_[standby] = subscriptionId;
+    for (auto& [handle, item] : items_) {
+        item.monitoredItemIds[standby] = createMonitoredItem(standby, handle, item);
+    }
+}
+
+IntegerId RedundantClient::createSubscription(size_t index) {
+    const auto response = services::createSubscription(
+        *clients_[index], options_.subscriptionParameters, true, {}, {}
+    );
+    response.responseHeader().serviceResult().throwIfBad();
+    return response.subscriptionId();
+}
+
+IntegerId RedundantClient::createMonitoredItem(size_t index, IntegerId handle, const Item& item) {
+    const auto result = services::createMonitoredItemDataChange(
+        *clients_[index],
+        subscriptionIds_[index].value(),
+        ReadValueId(item.id, item.attribute),
+        index == active_ ? MonitoringMode::Reporting : options_.standbyMode,
+        item.parameters,
+        [this, index, handle](IntegerId subId, IntegerId monId, const DataValue& value) {
+            // forward notifications of the active server only
+            if (index != active_) {
+                return;
+            }
+            const auto it = items_.find(handle);
+            if (it != items_.end() && it->second.callback) {
+                it->second.callback(subId, monId, value);
+            }
+        },
+        {}
+    );
+    result.statusCode().throwIfBad();
+    return result.monitoredItemId();
+}
+
+void RedundantClient::setFailed(size_t index) noexcept {
+    if (index == active_) {
+        if (!failure_.has_value()) {
+            failure_ = Clock::now();
+        }
+        return;
+    }
+    // standby is unavailable until restoreStandby
+    subscriptionIds_[index].reset();
+    for (auto& [handle, item] : items_) {
+        item.monitoredItemIds[index].reset();
+    }
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,486 @@
+#include "open62541pp/reliablesubscription.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // max, min
+#include <iterator>  // next
+#include <map>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>  // move, pair
+#include <vector>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/scope.hpp"
+#include "open62541pp/exception.hpp"
+#include "open62541pp/services/attribute.hpp"
+#include "open62541pp/services/detail/client_service.hpp"
+
+namespace opcua {
+
+/// Successor of a sequence number, the sequence number 0 is skipped on wrap-around.
+static constexpr uint32_t nextSequence(uint32_t sequenceNumber) noexcept {
+    return sequenceNumber == UINT32_MAX ? 1 : sequenceNumber + 1;
+}
+
+/// Check if the sequence number `a` is after `b` (with wrap-around).
+static constexpr bool isAfter(uint32_t a, uint32_t b) noexcept {
+    return a != b && static_cast<uint32_t>(a - b) < 0x80000000U;
+}
+
+/// Number of sequence numbers from `from` (inclusive) to `to` (exclusive).
+static constexpr uint32_t sequenceDistance(uint32_t from, uint32_t to) noexcept {
+    const auto distance = static_cast<uint32_t>(to - from);
+    return to < from ? distance - 1 : distance;  // 0 is skipped on wrap-around
+}
+
+struct ReliableSubscription::State : std::enable_shared_from_this<State> {
+    using Notifications = std::vector<std::pair<IntegerId, DataValue>>;  // client handle, value
+    using CallbackPtr = std::shared_ptr<const DataChangeNotificationCallback>;
+
+    struct Item {
+        ReadValueId readValueId;
+        IntegerId monitoredItemId;
+        CallbackPtr callback;
+    };
+
+    Client* client;  // nullptr after destruction of the reliable subscription
+    ReliableSubscriptionOptions options;
+    IntegerId subscriptionId{0};
+    std::unordered_map<IntegerId, Item> items;  // by client handle
+    std::unordered_map<IntegerId, IntegerId> clientHandles;  // by monitored item id
+    IntegerId nextClientHandle{1};
+
+    size_t outstandingPublishRequests{0};
+    std::vector<uint32_t> acknowledgements;
+    uint32_t expected{1};  // sequence number of the next notification message
+    std::map<uint32_t, Notifications> buffered;  // received, but not delivered yet
+    std::set<uint32_t> republishing;
+    std::set<uint32_t> lost;
+    std::optional<uint32_t> lostBefore;  // all missing messages before are given up
+    size_t pendingRereads{0};  // delivery is held until the re-reads are completed
+    ReliableSubscriptionStatistics statistics{};
+
+    void publish();
+    void onPublishResponse(UA_PublishResponse& response);
+    void processMessage(UA_NotificationMessage& message);
+    void detectGap(uint32_t sequenceNumber);
+    void republish(uint32_t sequenceNumber);
+    void deliver();
+    void reread(const std::vector<IntegerId>& clientHandles);
+    void notify(IntegerId clientHandle, const DataValue& value);
+};
+
+void ReliableSubscription::State::publish() {
+    const size_t maxRequests = std::max<size_t>(options.publishRequests, 1);
+    while (client != nullptr && outstandingPublishRequests < maxRequests) {
+        if (!client->isConnected()) {
+            return;
+        }
+        std::vector<UA_SubscriptionAcknowledgement> acks;
+        acks.reserve(acknowledgements.size());
+        for (const uint32_t sequenceNumber : acknowledgements) {
+            acks.push_back({subscriptionId, sequenceNumber});
+        }
+        // the request is encoded immediately, the acknowledgements array is borrowed
+        UA_PublishRequest request{};
+        request.subscriptionAcknowledgementsSize = acks.size();
+        request.subscriptionAcknowledgements = acks.data();
+        // initiation errors are not thrown but stored in the exception catcher of the client and
+        // the completion handler is destroyed without invocation, also if the response is dropped
+        auto abandoned = std::make_shared<bool>(false);
+        auto onAbandon = [state = shared_from_this(), abandoned]() {
+            *abandoned = true;
+            --state->outstandingPublishRequests;
+        };
+        ++outstandingPublishRequests;
+        services::detail::sendRequestAsync<UA_PublishRequest, UA_PublishResponse>(
+            *client,
+            request,
+            [state = shared_from_this(), guard = detail::ScopeExit(std::move(onAbandon))](
+                UA_PublishResponse& response
+            ) mutable {
+                guard.release();
+                state->onPublishResponse(response);
+            }
+        );
+        if (*abandoned) {
+            return;  // not sent, keep the acknowledgements for the next request
+        }
+        acknowledgements.clear();
+    }
+}
+
+void ReliableSubscription::State::onPublishResponse(UA_PublishResponse& response) {
+    --outstandingPublishRequests;
+    if (client == nullptr) {
+        return;
+    }
+    if (StatusCode(response.responseHeader.serviceResult).isBad()) {
+        // e.g. BadTimeout or BadSessionClosed, new requests are sent by the next publish call
+        return;
+    }
+    if (response.subscriptionId != subscriptionId) {
+        return;  // subscription of another component of the same session
+    }
+    processMessage(response.notificationMessage);
+    deliver();
+    publish();
+}
+
+void ReliableSubscription::State::processMessage(UA_NotificationMessage& message) {
+    const uint32_t sequenceNumber = message.sequenceNumber;
+    if (message.notificationDataSize == 0) {
+        // keep-alive message with the sequence number of the next notification message
+        ++statistics.keepAliveMessages;
+        detectGap(sequenceNumber);
+        return;
+    }
+    acknowledgements.push_back(sequenceNumber);
+    republishing.erase(sequenceNumber);
+    lost.erase(sequenceNumber);
+    if (isAfter(expected, sequenceNumber) || buffered.count(sequenceNumber) > 0) {
+        return;  // duplicate
+    }
+    detectGap(sequenceNumber);
+
+    Notifications notifications;
+    for (auto& data : Span(message.notificationData, message.notificationDataSize)) {
+        auto& extensionObject = asWrapper<ExtensionObject>(data);
+        auto* dataChange = extensionObject.decodedData<UA_DataChangeNotification>();
+        if (dataChange == nullptr) {
+            continue;  // only data change notifications are supported
+        }
+        for (auto& item : Span(dataChange->monitoredItems, dataChange->monitoredItemsSize)) {
+            // move the value out of the response instead of copying it
+            notifications.emplace_back(
+                item.clientHandle, std::move(asWrapper<DataValue>(item.value))
+            );
+        }
+    }
+    buffered.emplace(sequenceNumber, std::move(notifications));
+}
+
+void ReliableSubscription::State::detectGap(uint32_t sequenceNumber) {
+    uint32_t first = expected;
+    if (lostBefore.has_value() && isAfter(*lostBefore, first)) {
+        first = *lostBefore;  // already given up
+    }
+    // request at most maxRepublishRequests messages at once, otherwise give up the whole gap
+    const size_t maxRequests = options.maxRepublishRequests;
+    std::vector<uint32_t> missing;
+    uint32_t n = first;
+    for (; isAfter(sequenceNumber, n); n = nextSequence(n)) {
+        if (buffered.count(n) == 0 && republishing.count(n) == 0 && lost.count(n) == 0) {
+            if (republishing.size() + missing.size() >= maxRequests) {
+                break;
+            }
+            missing.push_back(n);
+        }
+    }
+    if (isAfter(sequenceNumber, n)) {
+        // too many missing messages, the retransmission queue of the server is probably exceeded
+        size_t known = 0;
+        auto isInGap = [&](uint32_t k) { return !isAfter(first, k) && isAfter(sequenceNumber, k); };
+        for (const auto& entry : buffered) {
+            known += isInGap(entry.first) ? 1 : 0;
+        }
+        for (const uint32_t k : republishing) {
+            known += isInGap(k) ? 1 : 0;
+        }
+        for (const uint32_t k : lost) {
+            known += isInGap(k) ? 1 : 0;
+        }
+        const size_t gapMissing = sequenceDistance(first, sequenceNumber) - known;
+        if (gapMissing > 0) {
+            ++statistics.gaps;
+            statistics.missingMessages += gapMissing;
+        }
+        lostBefore = sequenceNumber;
+        return;
+    }
+    if (missing.empty()) {
+        return;
+    }
+    ++statistics.gaps;
+    statistics.missingMessages += missing.size();
+    for (const uint32_t k : missing) {
+        republish(k);
+    }
+}
+
+void ReliableSubscription::State::republish(uint32_t sequenceNumber) {
+    UA_RepublishRequest request{};
+    request.subscriptionId = subscriptionId;
+    request.retransmitSequenceNumber = sequenceNumber;
+    if (!client->isConnected()) {
+        lost.insert(sequenceNumber);
+        return;
+    }
+    republishing.insert(sequenceNumber);
+    // the next response (at least a keep-alive message) delivers the messages after the lost one
+    auto onAbandon = [state = shared_from_this(), sequenceNumber]() {
+        if (state->republishing.erase(sequenceNumber) > 0) {
+            state->lost.insert(sequenceNumber);
+        }
+    };
+    services::detail::sendRequestAsync<UA_RepublishRequest, UA_RepublishResponse>(
+        *client,
+        request,
+        [state = shared_from_this(),
+         sequenceNumber,
+         guard = detail::ScopeExit(std::move(onAbandon))](UA_RepublishResponse& response) mutable {
+            guard.release();
+            if (state->client == nullptr || state->republishing.count(sequenceNumber) == 0) {
+                return;  // destroyed or already received
+            }
+            state->republishing.erase(sequenceNumber);
+            const StatusCode status(response.responseHeader.serviceResult);
+            if (status.isGood()) {
+                ++state->statistics.republishedMessages;
+                state->processMessage(response.notificationMessage);
+            } else {
+                // e.g. BadMessageNotAvailable, already removed from the retransmission queue
+                state->lost.insert(sequenceNumber);
+            }
+            state->deliver();
+        }
+    );
+}
+
+void ReliableSubscription::State::deliver() {
+    if (pendingRereads > 0) {
+        return;  // re-read values must be delivered before newer notifications
+    }
+    bool gapClosedWithLoss = false;
+    while (true) {
+        if (lostBefore.has_value() && !isAfter(*lostBefore, expected)) {
+            lostBefore.reset();
+        }
+        if (const auto it = buffered.find(expected); it != buffered.end()) {
+            const auto notifications = std::move(it->second);
+            buffered.erase(it);
+            expected = nextSequence(expected);
+            ++statistics.notificationMessages;
+            for (const auto& [clientHandle, value] : notifications) {
+                notify(clientHandle, value);
+            }
+        } else if (lost.erase(expected) > 0) {
+            ++statistics.lostMessages;
+            expected = nextSequence(expected);
+            gapClosedWithLoss = true;
+        } else if (lostBefore.has_value()) {
+            // skip the given up messages up to the next buffered message
+            uint32_t next = *lostBefore;
+            for (const auto& entry : buffered) {
+                if (isAfter(entry.first, expected) && isAfter(next, entry.first)) {
+                    next = entry.first;
+                }
+            }
+            for (auto it = lost.begin(); it != lost.end();) {
+                const bool skipped = !isAfter(expected, *it) && isAfter(next, *it);
+                it = skipped ? lost.erase(it) : std::next(it);
+            }
+            statistics.lostMessages += sequenceDistance(expected, next);
+            expected = next;
+            gapClosedWithLoss = true;
+        } else {
+            break;
+        }
+        if (client == nullptr) {
+            return;  // destroyed within a callback
+        }
+    }
+    if (!gapClosedWithLoss) {
+        return;
+    }
+    // items with notifications after the gap are up to date once the buffered messages are
+    // delivered, all other items might have missed a value change
+    std::unordered_set<IntegerId> upToDate;
+    for (const auto& [sequenceNumber, notifications] : buffered) {
+        for (const auto& [clientHandle, value] : notifications) {
+            upToDate.insert(clientHandle);
+        }
+    }
+    std::vector<IntegerId> affected;
+    for (const auto& [clientHandle, item] : items) {
+        if (upToDate.count(clientHandle) == 0) {
+            affected.push_back(clientHandle);
+        }
+    }
+    reread(affected);
+}
+
+void ReliableSubscription::State::reread(const std::vector<IntegerId>& handles) {
+    if (handles.empty() || !client->isConnected()) {
+        return;
+    }
+    ++statistics.rereads;
+    const size_t chunkSize = std::max<size_t>(options.maxNodesPerRead, 1);
+    for (size_t first = 0; first < handles.size(); first += chunkSize) {
+        const size_t count = std::min(chunkSize, handles.size() - first);
+        std::vector<IntegerId> chunk(handles.begin() + first, handles.begin() + first + count);
+        std::vector<ReadValueId> nodesToRead;
+        nodesToRead.reserve(count);
+        for (const IntegerId clientHandle : chunk) {
+            nodesToRead.push_back(items.at(clientHandle).readValueId);
+        }
+        // the next response (at least a keep-alive message) resumes the delivery
+        auto onAbandon = [state = shared_from_this()]() { --state->pendingRereads; };
+        ++pendingRereads;
+        services::readAsync(
+            *client,
+            ReadRequest({}, 0.0, TimestampsToReturn::Both, nodesToRead),
+            [state = shared_from_this(),
+             chunk = std::move(chunk),
+             guard = detail::ScopeExit(std::move(onAbandon))](ReadResponse& response) mutable {
+                guard.release();
+                --state->pendingRereads;
+                if (state->client == nullptr) {
+                    return;
+                }
+                if (response.responseHeader().serviceResult().isGood()) {
+                    const auto results = response.results();
+                    for (size_t i = 0; i < results.size() && i < chunk.size(); ++i) {
+                        ++state->statistics.rereadValues;
+                        state->notify(chunk[i], results[i]);
+                        if (state->client == nullptr) {
+                            return;
+                        }
+                    }
+                }
+                state->deliver();
+            }
+        );
+    }
+}
+
+void ReliableSubscription::State::notify(IntegerId clientHandle, const DataValue& value) {
+    const auto it = items.find(clientHandle);
+    if (it == items.end()) {
+        return;  // unsubscribed
+    }
+    const CallbackPtr callback = it->second.callback;  // keep alive during the call
+    if (*callback) {
+        (*callback)(subscriptionId, it->second.monitoredItemId, value);
+    }
+}
+
+ReliableSubscription::ReliableSubscription(Client& client, ReliableSubscriptionOptions options)
+    : state_(std::make_shared<State>()) {
+    state_->client = &client;
+    state_->options = std::move(options);
+    // create the subscription with a raw request, the open62541 client must not publish it
+    const auto request = services::detail::createCreateSubscriptionRequest(
+        state_->options.subscriptionParameters, true
+    );
+    const auto response =
+        services::detail::sendRequest<CreateSubscriptionRequest, CreateSubscriptionResponse>(
+            client, asWrapper<CreateSubscriptionRequest>(request)
+        );
+    response.responseHeader().serviceResult().throwIfBad();
+    state_->subscriptionId = response.subscriptionId();
+}
+
+ReliableSubscription::~ReliableSubscription() {
+    auto& client = *state_->client;
+    state_->client = nullptr;
+    IntegerId subscriptionId = state_->subscriptionId;
+    const auto request = services::detail::createDeleteSubscriptionsRequest(subscriptionId);
+    // ignore errors, e.g. if the session is already closed
+    (void)services::detail::sendRequest<DeleteSubscriptionsRequest, DeleteSubscriptionsResponse>(
+        client, asWrapper<DeleteSubscriptionsRequest>(request)
+    );
+}
+
+IntegerId ReliableSubscription::subscriptionId() const noexcept {
+    return state_->subscriptionId;
+}
+
+IntegerId ReliableSubscription::subscribeDataChange(
+    const NodeId& id,
+    AttributeId attribute,
+    const MonitoringParametersEx& parameters,
+    DataChangeNotificationCallback onDataChange
+) {
+    auto& state = *state_;
+    const IntegerId clientHandle = state.nextClientHandle;
+    MonitoringParameters requestedParameters(
+        parameters.samplingInterval,
+        parameters.filter,
+        parameters.queueSize,
+        parameters.discardOldest
+    );
+    requestedParameters->clientHandle = clientHandle;
+    const MonitoredItemCreateRequest item(
+        ReadValueId(id, attribute), MonitoringMode::Reporting, std::move(requestedParameters)
+    );
+    const auto response =
+        services::detail::sendRequest<CreateMonitoredItemsRequest, CreateMonitoredItemsResponse>(
+            *state.client,
+            CreateMonitoredItemsRequest(
+                {}, state.subscriptionId, parameters.timestamps, {&item, 1}
+            )
+        );
+    response.responseHeader().serviceResult().throwIfBad();
+    if (response.results().size() != 1) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+    const auto& result = response.results()[0];
+    result.statusCode().throwIfBad();
+
+    const IntegerId monitoredItemId = result.monitoredItemId();
+    state.items.emplace(
+        clientHandle,
+        State::Item{
+            ReadValueId(id, attribute),
+            monitoredItemId,
+            std::make_shared<const DataChangeNotificationCallback>(std::move(onDataChange))
+        }
+    );
+    state.clientHandles.emplace(monitoredItemId, clientHandle);
+    ++state.nextClientHandle;
+    return monitoredItemId;
+}
+
+void ReliableSubscription::unsubscribe(IntegerId monitoredItemId) {
+    auto& state = *state_;
+    const auto it = state.clientHandles.find(monitoredItemId);
+    if (it == state.clientHandles.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    state.items.erase(it->second);
+    state.clientHandles.erase(it);
+    const auto response =
+        services::detail::sendRequest<DeleteMonitoredItemsRequest, DeleteMonitoredItemsResponse>(
+            *state.client,
+            DeleteMonitoredItemsRequest({}, state.subscriptionId, {&monitoredItemId, 1})
+        );
+    response.responseHeader().serviceResult().throwIfBad();
+    for (const auto& status : response.results()) {
+        status.throwIfBad();
+    }
+}
+
+void ReliableSubscription::publish() {
+    state_->publish();
+}
+
+void ReliableSubscription::runIterate(uint16_t timeoutMilliseconds) {
+    state_->publish();
+    state_->client->runIterate(timeoutMilliseconds);
+}
+
+uint32_t ReliableSubscription::nextSequenceNumber() const noexcept {
+    return state_->expected;
+}
+
+ReliableSubscriptionStatistics ReliableSubscription::statistics() const noexcept {
+    return state_->statistics;
+}
+
+}  // namespace opcua
+
+#endif
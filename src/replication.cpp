@@ -0,0 +1,314 @@
+#include "open62541pp/replication.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // max, min
+#include <iterator>  // make_move_iterator
+#include <memory>
+#include <mutex>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/scope.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"  // writeValue
+#include "open62541pp/services/monitoreditem.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+namespace opcua {
+
+/* -------------------------------------- ReplicationSender ------------------------------------- */
+
+struct ReplicationSender::State {
+    struct Capture {
+        Clock::time_point time;
+        uint64_t sequence;
+    };
+
+    // put values back to the front of the pending values, values superseded by newer captures
+    // are dropped if requested (must be called with locked mutex)
+    // returns the number of values put back
+    size_t requeue(
+        std::vector<WriteValue>& values,
+        std::vector<Capture>& valueCaptures,
+        bool dropSuperseded,
+        bool coalesce
+    ) {
+        std::vector<WriteValue> requeued;
+        std::vector<Capture> requeuedCaptures;
+        for (size_t i = 0; i < values.size(); ++i) {
+            const auto it = latest.find(values[i].nodeId());
+            const bool superseded = it == latest.end() || it->second != valueCaptures[i].sequence;
+            if (!dropSuperseded || !superseded) {
+                requeued.push_back(std::move(values[i]));
+                requeuedCaptures.push_back(valueCaptures[i]);
+            }
+        }
+        const size_t count = requeued.size();
+        pending.insert(
+            pending.begin(),
+            std::make_move_iterator(requeued.begin()),
+            std::make_move_iterator(requeued.end())
+        );
+        captures.insert(captures.begin(), requeuedCaptures.begin(), requeuedCaptures.end());
+        pendingIndex.clear();
+        if (coalesce) {
+            for (size_t i = 0; i < pending.size(); ++i) {
+                pendingIndex.emplace(pending[i].nodeId(), i);
+            }
+        }
+        return count;
+    }
+
+    // values of a frame in flight, requeued if the frame fails
+    struct Frame {
+        std::vector<WriteValue> values;
+        std::vector<Capture> captures;
+        bool sent{false};
+        bool done{false};
+    };
+
+    mutable std::mutex mutex;
+    std::vector<WriteValue> pending;
+    std::vector<Capture> captures;
+    std::unordered_map<NodeId, size_t> pendingIndex;  // only used to coalesce values
+    std::unordered_map<NodeId, uint64_t> latest;  // sequence number of the latest capture
+    uint64_t nextSequence{0};
+    ReplicationStatistics statistics{};
+};
+
+ReplicationSender::ReplicationSender(Server& primary, Client& standby, ReplicationOptions options)
+    : primary_(primary),
+      standby_(standby),
+      options_(options),
+      subscription_(primary.createSubscription()),
+      state_(std::make_shared<State>()) {}
+
+ReplicationSender::~ReplicationSender() {
+    for (const auto& [id, monitoredItemId] : monitoredItems_) {
+        (void)services::deleteMonitoredItem(
+            primary_, subscription_.subscriptionId(), monitoredItemId
+        );
+    }
+}
+
+void ReplicationSender::addVariable(const NodeId& id) {
+    if (monitoredItems_.count(id) > 0) {
+        return;
+    }
+    MonitoringParametersEx parameters;
+    parameters.samplingInterval = options_.samplingInterval;
+    const auto item = subscription_.subscribeDataChange(
+        id,
+        AttributeId::Value,
+        MonitoringMode::Reporting,
+        parameters,
+        [this, id](IntegerId, IntegerId, const DataValue& value) { capture(id, value); }
+    );
+    monitoredItems_.emplace(id, item.monitoredItemId());
+}
+
+void ReplicationSender::removeVariable(const NodeId& id) {
+    const auto it = monitoredItems_.find(id);
+    if (it == monitoredItems_.end()) {
+        return;
+    }
+    const auto status = services::deleteMonitoredItem(
+        primary_, subscription_.subscriptionId(), it->second
+    );
+    monitoredItems_.erase(it);
+    {
+        // values of failed frames are not requeued anymore
+        const std::lock_guard lock(state_->mutex);
+        state_->latest.erase(id);
+    }
+    status.throwIfBad();
+}
+
+void ReplicationSender::capture(const NodeId& id, const DataValue& value) {
+    // the server timestamp is set by the standby server
+    DataValue captured(value);
+    captured->hasServerTimestamp = false;
+    captured->hasServerPicoseconds = false;
+
+    const auto now = Clock::now();
+    auto& state = *state_;
+    const std::lock_guard lock(state.mutex);
+    ++state.statistics.capturedValues;
+    const uint64_t sequence = state.nextSequence++;
+    state.latest[id] = sequence;
+    if (options_.coalesce) {
+        const auto [it, inserted] = state.pendingIndex.try_emplace(id, state.pending.size());
+        if (!inserted) {
+            // keep the capture time of the replaced value to measure the lag
+            state.pending[it->second].value() = std::move(captured);
+            state.captures[it->second].sequence = sequence;
+            return;
+        }
+    }
+    state.pending.emplace_back(id, AttributeId::Value, "", std::move(captured));
+    state.captures.push_back({now, sequence});
+}
+
+size_t ReplicationSender::flush() {
+    using Frame = State::Frame;
+    const size_t frameSize = std::max<size_t>(options_.maxFrameSize, 1);
+    std::vector<WriteValue> values;
+    std::vector<State::Capture> captures;
+    {
+        auto& state = *state_;
+        const std::lock_guard lock(state.mutex);
+        const size_t maxFrames = std::max<size_t>(options_.maxFramesInFlight, 1);
+        if (state.statistics.framesInFlight >= maxFrames) {
+            return 0;
+        }
+        const size_t count = std::min(
+            state.pending.size(), (maxFrames - state.statistics.framesInFlight) * frameSize
+        );
+        if (count == 0) {
+            return 0;
+        }
+        values.assign(
+            std::make_move_iterator(state.pending.begin()),
+            std::make_move_iterator(state.pending.begin() + count)
+        );
+        captures.assign(state.captures.begin(), state.captures.begin() + count);
+        state.pending.erase(state.pending.begin(), state.pending.begin() + count);
+        state.captures.erase(state.captures.begin(), state.captures.begin() + count);
+        state.pendingIndex.clear();
+        if (options_.coalesce) {
+            for (size_t i = 0; i < state.pending.size(); ++i) {
+                state.pendingIndex.emplace(state.pending[i].nodeId(), i);
+            }
+        }
+        // reserve the frames, released again if they can't be sent
+        state.statistics.framesInFlight += (count + frameSize - 1) / frameSize;
+    }
+
+    size_t sent = 0;
+    while (sent < values.size()) {
+        const size_t count = std::min(frameSize, values.size() - sent);
+        auto frame = std::make_shared<Frame>();
+        frame->values.assign(
+            std::make_move_iterator(values.begin() + sent),
+            std::make_move_iterator(values.begin() + sent + count)
+        );
+        frame->captures.assign(captures.begin() + sent, captures.begin() + sent + count);
+        Clock::time_point oldest = frame->captures.front().time;
+        for (const auto& capture : frame->captures) {
+            oldest = std::min(oldest, capture.time);
+        }
+
+        // failed frames (bad service result or response dropped, e.g. on disconnect) are put
+        // back to the pending values, skipping values superseded by newer captures
+        const bool coalesce = options_.coalesce;
+        auto onFailure = [state = state_, frame, coalesce] {
+            state->statistics.requeuedValues +=
+                state->requeue(frame->values, frame->captures, true, coalesce);
+        };
+        // invoked if the request was not sent or the response was dropped
+        auto onAbandon = [state = state_, frame, onFailure] {
+            const std::lock_guard lock(state->mutex);
+            if (frame->done) {
+                return;
+            }
+            frame->done = true;
+            // frames not sent are requeued by flush
+            if (frame->sent) {
+                --state->statistics.framesInFlight;
+                onFailure();
+            }
+        };
+        auto onResponse = [state = state_, frame, oldest, count, onFailure](
+                              const WriteResponse& response
+                          ) {
+            const auto lag = Clock::now() - oldest;
+            const std::lock_guard lock(state->mutex);
+            frame->done = true;
+            auto& statistics = state->statistics;
+            --statistics.framesInFlight;
+            if (response.responseHeader().serviceResult().isBad()) {
+                onFailure();
+                return;
+            }
+            statistics.lastLag = lag;
+            statistics.maxLag = std::max(statistics.maxLag, lag);
+            size_t applied = 0;
+            for (const auto& result : response.results()) {
+                applied += result.isGood() ? 1 : 0;
+            }
+            statistics.appliedValues += applied;
+            statistics.failedValues += count - std::min(applied, count);
+        };
+        // initiation errors are not thrown but stored in the exception catcher of the client and
+        // the completion handler is destroyed without invocation
+        services::writeAsync(
+            standby_,
+            Span<const WriteValue>(frame->values),
+            [onResponse, guard = detail::ScopeExit(std::move(onAbandon))](
+                WriteResponse& response
+            ) mutable {
+                guard.release();
+                onResponse(response);
+            }
+        );
+
+        auto& state = *state_;
+        const std::lock_guard lock(state.mutex);
+        if (frame->done) {
+            // not sent, put this and the following frames back to the pending values
+            state.statistics.framesInFlight -= (values.size() - sent + frameSize - 1) / frameSize;
+            values.erase(values.begin(), values.begin() + sent + count);
+            captures.erase(captures.begin(), captures.begin() + sent + count);
+            values.insert(
+                values.begin(),
+                std::make_move_iterator(frame->values.begin()),
+                std::make_move_iterator(frame->values.end())
+            );
+            captures.insert(captures.begin(), frame->captures.begin(), frame->captures.end());
+            state.requeue(values, captures, options_.coalesce, options_.coalesce);
+            break;
+        }
+        frame->sent = true;
+        ++state.statistics.sentFrames;
+        state.statistics.sentValues += count;
+        sent += count;
+    }
+    return sent;
+}
+
+ReplicationStatistics ReplicationSender::statistics() const {
+    const std::lock_guard lock(state_->mutex);
+    ReplicationStatistics statistics = state_->statistics;
+    statistics.pendingValues = state_->pending.size();
+    return statistics;
+}
+
+/* ------------------------------------- ReplicationStandby ------------------------------------- */
+
+// see https://reference.opcfoundation.org/Core/Part5/v105/docs/12.5
+constexpr int32_t redundancySupportHot = 3;
+
+ReplicationStandby::ReplicationStandby(Server& standby, uint8_t serviceLevel)
+    : server_(standby) {
+    services::writeValue(
+        server_,
+        VariableId::Server_ServerRedundancy_RedundancySupport,
+        Variant(redundancySupportHot)
+    )
+        .throwIfBad();
+    services::writeValue(server_, VariableId::Server_ServiceLevel, Variant(serviceLevel))
+        .throwIfBad();
+}
+
+void ReplicationStandby::promote(uint8_t serviceLevel) {
+    services::writeValue(server_, VariableId::Server_ServiceLevel, Variant(serviceLevel))
+        .throwIfBad();
+    promoted_ = true;
+}
+
+}  // namespace opcua
+
+#endif
@@ -2,8 +2,11 @@
 
 #include <atomic>
 #include <cassert>
+#include <map>
+#include <memory>
 #include <mutex>
-#include <utility>  // move
+#include <type_traits>  // remove_reference_t
+#include <utility>  // exchange, move
 
 #include "open62541pp/datatype.hpp"
 #include "open62541pp/detail/result_utils.hpp"  // tryInvoke
@@ -12,6 +15,7 @@
 #include "open62541pp/exception.hpp"
 #include "open62541pp/node.hpp"
 #include "open62541pp/plugin/accesscontrol.hpp"
+#include "open62541pp/plugin/certificateverification.hpp"
 #include "open62541pp/plugin/nodestore.hpp"
 #include "open62541pp/services/attribute_highlevel.hpp"
 #include "open62541pp/session.hpp"
@@ -168,6 +172,20 @@ void ServerConfig::setAccessControl(std::unique_ptr<AccessControlBase>&& accessC
     }
 }
 
+CertificateVerificationCache& ServerConfig::enableCertificateVerificationCache(
+    const CertificateVerificationCacheOptions& options
+) {
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    auto& plugin = native().secureChannelPKI;
+#else
+    auto& plugin = native().certificateVerification;
+#endif
+    auto cache = std::make_unique<CertificateVerificationCache>(std::move(plugin), options);
+    auto& ref = *cache;
+    plugin = cache.release()->create(true);
+    return ref;
+}
+
 /* ------------------------------------------- Server ------------------------------------------- */
 
 static UA_StatusCode activateSession(
@@ -180,11 +198,28 @@ static UA_StatusCode activateSession(
     void** sessionContext
 ) {
     auto* context = detail::getContext(server);
-    if (context == nullptr || context->sessionRegistry.activateSessionUser == nullptr) {
+    if (context == nullptr) {
         return UA_STATUSCODE_BADINTERNALERROR;
     }
+    auto& registry = context->sessionRegistry;
+    if (registry.accessControlUser.activateSession == nullptr) {
+        return UA_STATUSCODE_BADINTERNALERROR;
+    }
+    // create the context slots before the user-defined function, which might access them
+    detail::SessionContext* slots = nullptr;
+    bool created = false;
+    if (sessionId != nullptr) {
+        const std::scoped_lock lock(registry.mutex);
+        auto [it, inserted] = registry.sessions.try_emplace(asWrapper<NodeId>(*sessionId));
+        slots = &it->second;
+        created = inserted;
+        // use the session context for the context slots if not used by the access control plugin
+        if (sessionContext != nullptr && *sessionContext == nullptr) {
+            *sessionContext = slots;
+        }
+    }
     // call user-defined function
-    auto status = context->sessionRegistry.activateSessionUser(
+    auto status = registry.accessControlUser.activateSession(
         server,
         ac,
         endpointDescription,
@@ -193,9 +228,20 @@ static UA_StatusCode activateSession(
         userIdentityToken,
         sessionContext
     );
-    if (detail::isGood(status) && sessionId != nullptr) {
-        const std::scoped_lock lock(context->sessionRegistry.mutex);
-        context->sessionRegistry.sessionIds.insert(asWrapper<NodeId>(*sessionId));
+    if (slots == nullptr) {
+        return status;
+    }
+    const std::scoped_lock lock(registry.mutex);
+    if (!detail::isGood(status)) {
+        // remove the slots of rejected new sessions, re-activated sessions keep their slots
+        if (created) {
+            if (sessionContext != nullptr && *sessionContext == slots) {
+                *sessionContext = nullptr;
+            }
+            registry.sessions.erase(asWrapper<NodeId>(*sessionId));
+        }
+    } else if (sessionContext != nullptr && *sessionContext != slots) {
+        registry.userSessionContext = true;
     }
     return status;
 }
@@ -204,31 +250,111 @@ static void closeSession(
     UA_Server* server, UA_AccessControl* ac, const UA_NodeId* sessionId, void* sessionContext
 ) {
     auto* context = detail::getContext(server);
-    if (context == nullptr || context->sessionRegistry.closeSessionUser == nullptr) {
+    if (context == nullptr || context->sessionRegistry.accessControlUser.closeSession == nullptr) {
         return;
     }
+    auto& registry = context->sessionRegistry;
+    if (sessionId != nullptr) {
+        // hide the context slots from the access control plugin
+        const std::scoped_lock lock(registry.mutex);
+        auto it = registry.sessions.find(asWrapper<NodeId>(*sessionId));
+        if (it != registry.sessions.end() && sessionContext == &it->second) {
+            sessionContext = nullptr;
+        }
+    }
     // call user-defined function
-    context->sessionRegistry.closeSessionUser(server, ac, sessionId, sessionContext);
+    registry.accessControlUser.closeSession(server, ac, sessionId, sessionContext);
     if (sessionId != nullptr) {
-        const std::scoped_lock lock(context->sessionRegistry.mutex);
-        context->sessionRegistry.sessionIds.erase(asWrapper<NodeId>(*sessionId));
+        // destroy the context slots after the user-defined function, which might access them
+        const std::scoped_lock lock(registry.mutex);
+        registry.sessions.erase(asWrapper<NodeId>(*sessionId));
+        registry.diagnostics.erase(asWrapper<NodeId>(*sessionId));
     }
 }
 
+static detail::SessionContext* findSessionContext(
+    detail::SessionRegistry& registry, const UA_NodeId* sessionId, void* sessionContext
+) {
+    // lock-free if the session context is not used by the access control plugin
+    if (!registry.userSessionContext) {
+        return static_cast<detail::SessionContext*>(sessionContext);
+    }
+    if (sessionId == nullptr) {
+        return nullptr;
+    }
+    const std::scoped_lock lock(registry.mutex);
+    auto it = registry.sessions.find(asWrapper<NodeId>(*sessionId));
+    return it == registry.sessions.end() ? nullptr : &it->second;
+}
+
+template <typename Callback>
+struct AccessControlCallback;
+
+/// Count the access check in the session statistics and call the user-defined function.
+template <typename R, typename... Args>
+struct AccessControlCallback<
+    R (*)(UA_Server*, UA_AccessControl*, const UA_NodeId*, void*, Args...)> {
+    template <auto Member, detail::SessionAccessCheck Check>
+    static R invoke(
+        UA_Server* server,
+        UA_AccessControl* ac,
+        const UA_NodeId* sessionId,
+        void* sessionContext,
+        Args... args
+    ) {
+        auto* context = detail::getContext(server);
+        if (context == nullptr || context->sessionRegistry.accessControlUser.*Member == nullptr) {
+            return R{};
+        }
+        auto& registry = context->sessionRegistry;
+        if (auto* data = findSessionContext(registry, sessionId, sessionContext)) {
+            data->counters().add(Check, UA_DateTime_now());
+        }
+        return (registry.accessControlUser.*Member)(server, ac, sessionId, sessionContext, args...);
+    }
+};
+
+template <auto Member, auto Wrapper>
+static void wrapAccessControlCallback(UA_AccessControl& ac, UA_AccessControl& user) {
+    if (ac.*Member != nullptr && ac.*Member != Wrapper) {
+        user.*Member = ac.*Member;
+        ac.*Member = Wrapper;
+    }
+}
+
+template <auto Member, detail::SessionAccessCheck Check>
+static void wrapCountingCallback(UA_AccessControl& ac, UA_AccessControl& user) {
+    using Callback = std::remove_reference_t<decltype(ac.*Member)>;
+    wrapAccessControlCallback<
+        Member,
+        &AccessControlCallback<Callback>::template invoke<Member, Check>>(ac, user);
+}
+
 static void applySessionRegistry(UA_ServerConfig& config, detail::ServerContext& context) {
     // Make sure to call this function only once after access control is initialized or changed.
     // The function pointers to activateSession / closeSession might not be unique and the
     // the pointer comparison might fail resulting in stack overflows:
     // - https://github.com/open62541pp/open62541pp/issues/285
     // - https://stackoverflow.com/questions/31209693/static-library-linked-two-times
-    if (config.accessControl.activateSession != &activateSession) {
-        context.sessionRegistry.activateSessionUser = config.accessControl.activateSession;
-        config.accessControl.activateSession = &activateSession;
-    }
-    if (config.accessControl.closeSession != &closeSession) {
-        context.sessionRegistry.closeSessionUser = config.accessControl.closeSession;
-        config.accessControl.closeSession = &closeSession;
-    }
+    using Check = detail::SessionAccessCheck;
+    auto& ac = config.accessControl;
+    auto& user = context.sessionRegistry.accessControlUser;
+    wrapAccessControlCallback<&UA_AccessControl::activateSession, &activateSession>(ac, user);
+    wrapAccessControlCallback<&UA_AccessControl::closeSession, &closeSession>(ac, user);
+    // count access checks for the session statistics
+    wrapCountingCallback<&UA_AccessControl::getUserRightsMask, Check::Attribute>(ac, user);
+    wrapCountingCallback<&UA_AccessControl::getUserAccessLevel, Check::Attribute>(ac, user);
+    wrapCountingCallback<&UA_AccessControl::getUserExecutable, Check::Method>(ac, user);
+    wrapCountingCallback<&UA_AccessControl::getUserExecutableOnObject, Check::Method>(ac, user);
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    wrapCountingCallback<&UA_AccessControl::allowBrowseNode, Check::Browse>(ac, user);
+#endif
+    wrapCountingCallback<&UA_AccessControl::allowAddNode, Check::NodeManagement>(ac, user);
+    wrapCountingCallback<&UA_AccessControl::allowAddReference, Check::NodeManagement>(ac, user);
+    wrapCountingCallback<&UA_AccessControl::allowDeleteNode, Check::NodeManagement>(ac, user);
+    wrapCountingCallback<&UA_AccessControl::allowDeleteReference, Check::NodeManagement>(
+        ac, user
+    );
 }
 
 static void updateLoggerStackPointer([[maybe_unused]] UA_ServerConfig& config) noexcept {
@@ -314,12 +440,21 @@ void Server::setCustomDataTypes(Span<const DataType> dataTypes) {
 std::vector<Session> Server::sessions() {
     std::vector<Session> result;
     const std::scoped_lock lock(context().sessionRegistry.mutex);
-    for (auto&& id : context().sessionRegistry.sessionIds) {
-        result.emplace_back(*this, id);
+    for (auto&& item : context().sessionRegistry.sessions) {
+        result.emplace_back(*this, item.first);
     }
     return result;
 }
 
+void Server::setSessionDiagnosticsEnabled(bool enabled) {
+    auto& registry = context().sessionRegistry;
+    registry.diagnosticsEnabled = enabled;
+    if (!enabled) {
+        const std::scoped_lock lock(registry.mutex);
+        registry.diagnostics.clear();
+    }
+}
+
 std::vector<std::string> Server::namespaceArray() {
     return services::readValue(*this, {0, UA_NS0ID_SERVER_NAMESPACEARRAY})
         .value()
@@ -340,9 +475,9 @@ static void valueCallbackOnRead(
     const UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& cb = static_cast<detail::NodeContext*>(nodeContext)->valueCallback.onBeforeRead;
-    if (cb) {
-        detail::tryInvoke([&] { cb(asWrapper<DataValue>(*value)); });
+    const auto callbacks = static_cast<detail::NodeContext*>(nodeContext)->valueCallback.load();
+    if (callbacks && callbacks->onBeforeRead) {
+        detail::tryInvoke([&] { callbacks->onBeforeRead(asWrapper<DataValue>(*value)); });
     }
 }
 
@@ -352,25 +487,23 @@ static void valueCallbackOnWrite(
     [[maybe_unused]] void* sessionContext,
     [[maybe_unused]] const UA_NodeId* nodeId,
     void* nodeContext,
-    [[maybe_unused]] const UA_NumericRange* range,
+    const UA_NumericRange* range,
     const UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& cb = static_cast<detail::NodeContext*>(nodeContext)->valueCallback.onAfterWrite;
-    if (cb) {
-        detail::tryInvoke([&] { cb(asWrapper<DataValue>(*value)); });
+    auto* context = static_cast<detail::NodeContext*>(nodeContext);
+    // the value is only known if it was entirely written by services::writeDataValueIfChanged
+    const size_t hash = std::exchange(detail::pendingWrittenValueHash, 0);
+    context->writtenValueHash = range == nullptr ? hash : 0;
+    const auto callbacks = context->valueCallback.load();
+    if (callbacks && callbacks->onAfterWrite) {
+        detail::tryInvoke([&] { callbacks->onAfterWrite(asWrapper<DataValue>(*value)); });
     }
 }
 
 void Server::setVariableNodeValueCallback(const NodeId& id, ValueCallback callback) {
-    auto* nodeContext = detail::getContext(*this).nodeContexts[id];
-    nodeContext->valueCallback = std::move(callback);
-    throwIfBad(UA_Server_setNodeContext(handle(), id, nodeContext));
-
-    UA_ValueCallback callbackNative;
-    callbackNative.onRead = valueCallbackOnRead;
-    callbackNative.onWrite = valueCallbackOnWrite;
-    throwIfBad(UA_Server_setVariableNode_valueCallback(handle(), id, callbackNative));
+    auto& nodeContext = detail::installValueCallback(*this, id);
+    nodeContext.valueCallback.store(std::move(callback));
 }
 
 static NumericRange asRange(const UA_NumericRange* range) noexcept {
@@ -388,10 +521,10 @@ static UA_StatusCode valueSourceRead(
     UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& callback = static_cast<detail::NodeContext*>(nodeContext)->dataSource.read;
-    if (callback) {
+    const auto dataSource = static_cast<detail::NodeContext*>(nodeContext)->dataSource.load();
+    if (dataSource && dataSource->read) {
         auto result = detail::tryInvoke(
-            callback, asWrapper<DataValue>(*value), asRange(range), includeSourceTimestamp
+            dataSource->read, asWrapper<DataValue>(*value), asRange(range), includeSourceTimestamp
         );
         return result.code();
     }
@@ -408,9 +541,11 @@ static UA_StatusCode valueSourceWrite(
     const UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& callback = static_cast<detail::NodeContext*>(nodeContext)->dataSource.write;
-    if (callback) {
-        auto result = detail::tryInvoke(callback, asWrapper<DataValue>(*value), asRange(range));
+    const auto dataSource = static_cast<detail::NodeContext*>(nodeContext)->dataSource.load();
+    if (dataSource && dataSource->write) {
+        auto result = detail::tryInvoke(
+            dataSource->write, asWrapper<DataValue>(*value), asRange(range)
+        );
         return result.code();
     }
     return UA_STATUSCODE_BADINTERNALERROR;
@@ -418,7 +553,7 @@ static UA_StatusCode valueSourceWrite(
 
 void Server::setVariableNodeValueBackend(const NodeId& id, ValueBackendDataSource backend) {
     auto* nodeContext = detail::getContext(*this).nodeContexts[id];
-    nodeContext->dataSource = std::move(backend);
+    nodeContext->dataSource.store(std::move(backend));
     throwIfBad(UA_Server_setNodeContext(handle(), id, nodeContext));
 
     UA_DataSource dataSourceNative;
@@ -439,6 +574,137 @@ Event Server::createEvent(const NodeId& eventType) {
 }
 #endif
 
+static void removeTimerCallback(UA_Server* server, uint64_t callbackId) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    UA_Server_removeCallback(server, callbackId);
+#else
+    UA_Server_removeRepeatedCallback(server, callbackId);
+#endif
+}
+
+static void timerCallback(UA_Server* server, void* data) noexcept {
+    auto* context = detail::getContext(server);
+    if (context == nullptr) {
+        return;
+    }
+    context->timers.process(data, context->exceptionCatcher, [server](uint64_t callbackId) {
+        removeTimerCallback(server, callbackId);
+    });
+}
+
+TimerId Server::addTimer(
+    std::chrono::milliseconds interval, bool once, TimerCallback&& callback
+) {
+    auto* server = handle();
+    auto addNative = [server](void* data, double intervalMs, [[maybe_unused]] bool onceOnly) {
+        UA_UInt64 callbackId = 0;
+#if UAPP_OPEN62541_VER_GE(1, 1)
+        if (onceOnly) {
+            const auto date = UA_DateTime_nowMonotonic() +
+                              static_cast<UA_DateTime>(intervalMs * UA_DATETIME_MSEC);
+            throwIfBad(UA_Server_addTimedCallback(server, timerCallback, data, date, &callbackId));
+            return callbackId;
+        }
+#endif
+        throwIfBad(
+            UA_Server_addRepeatedCallback(server, timerCallback, data, intervalMs, &callbackId)
+        );
+        return callbackId;
+    };
+    auto removeNative = [server](uint64_t callbackId) { removeTimerCallback(server, callbackId); };
+    return context().timers.add(
+        static_cast<double>(interval.count()), once, std::move(callback), addNative, removeNative
+    );
+}
+
+bool Server::cancelTimer(TimerId id) {
+    auto* server = handle();
+    return context().timers.remove(id, [server](uint64_t callbackId) {
+        removeTimerCallback(server, callbackId);
+    });
+}
+
+TimerStatistics Server::timerStatistics(TimerId id) const {
+    const auto statistics = context().timers.statistics(id);
+    if (!statistics.has_value()) {
+        throw BadStatus(UA_STATUSCODE_BADNOTFOUND);
+    }
+    return *statistics;
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 3) && defined(UA_ENABLE_DIAGNOSTICS) &&                             \
+    defined(UA_TYPES_SESSIONDIAGNOSTICSDATATYPE)
+static ServiceCounter toServiceCounter(const UA_ServiceCounterDataType& counter) noexcept {
+    return {counter.totalCount, counter.errorCount};
+}
+
+static SessionStatistics toSessionStatistics(const UA_SessionDiagnosticsDataType& diagnostics) {
+    SessionStatistics stats;
+    stats.hasDiagnostics = true;
+    stats.totalRequests = toServiceCounter(diagnostics.totalRequestCount);
+    stats.readRequests = toServiceCounter(diagnostics.readCount);
+    stats.writeRequests = toServiceCounter(diagnostics.writeCount);
+    stats.callRequests = toServiceCounter(diagnostics.callCount);
+    stats.browseRequests = toServiceCounter(diagnostics.browseCount);
+    stats.browseNextRequests = toServiceCounter(diagnostics.browseNextCount);
+    stats.translateBrowsePathsRequests = toServiceCounter(
+        diagnostics.translateBrowsePathsToNodeIdsCount
+    );
+    stats.historyReadRequests = toServiceCounter(diagnostics.historyReadCount);
+    stats.createSubscriptionRequests = toServiceCounter(diagnostics.createSubscriptionCount);
+    stats.deleteSubscriptionsRequests = toServiceCounter(diagnostics.deleteSubscriptionsCount);
+    stats.publishRequests = toServiceCounter(diagnostics.publishCount);
+    stats.republishRequests = toServiceCounter(diagnostics.republishCount);
+    stats.createMonitoredItemsRequests = toServiceCounter(diagnostics.createMonitoredItemsCount);
+    stats.deleteMonitoredItemsRequests = toServiceCounter(diagnostics.deleteMonitoredItemsCount);
+    stats.currentSubscriptions = diagnostics.currentSubscriptionsCount;
+    stats.currentMonitoredItems = diagnostics.currentMonitoredItemsCount;
+    stats.currentPublishRequestsInQueue = diagnostics.currentPublishRequestsInQueue;
+    stats.clientLastContactTime = DateTime(diagnostics.clientLastContactTime);
+    return stats;
+}
+#endif
+
+/// Refresh the server diagnostics of the sessions, called by the server loop if enabled.
+/// The diagnostics array is read once for all sessions, at most once per second.
+static void refreshSessionDiagnostics(
+    [[maybe_unused]] Server& server, [[maybe_unused]] detail::ServerContext& context
+) {
+#if UAPP_OPEN62541_VER_GE(1, 3) && defined(UA_ENABLE_DIAGNOSTICS) &&                             \
+    defined(UA_TYPES_SESSIONDIAGNOSTICSDATATYPE)
+    auto& registry = context.sessionRegistry;
+    if (!registry.diagnosticsEnabled) {
+        return;
+    }
+    const int64_t now = UA_DateTime_nowMonotonic();
+    if (now - registry.diagnosticsRefreshTime < UA_DATETIME_SEC) {
+        return;
+    }
+    registry.diagnosticsRefreshTime = now;
+    const auto result = services::readValue(
+        server,
+        {0, UA_NS0ID_SERVER_SERVERDIAGNOSTICS_SESSIONSDIAGNOSTICSSUMMARY_SESSIONDIAGNOSTICSARRAY}
+    );
+    if (!result || !result->isType(UA_TYPES[UA_TYPES_SESSIONDIAGNOSTICSDATATYPE])) {
+        return;
+    }
+    const Span diagnosticsArray(
+        static_cast<const UA_SessionDiagnosticsDataType*>(result->data()), result->arrayLength()
+    );
+    std::map<NodeId, SessionStatistics> diagnostics;
+    for (const auto& sessionDiagnostics : diagnosticsArray) {
+        diagnostics.emplace(
+            asWrapper<NodeId>(sessionDiagnostics.sessionId),
+            toSessionStatistics(sessionDiagnostics)
+        );
+    }
+    const std::scoped_lock lock(registry.mutex);
+    if (registry.diagnosticsEnabled) {  // not disabled meanwhile
+        registry.diagnostics.swap(diagnostics);
+    }
+#endif
+}
+
 static void runStartup(Server& server, detail::ServerContext& context) {
     applySessionRegistry(server.config(), context);
     throwIfBad(UA_Server_run_startup(server.handle()));
@@ -450,6 +716,7 @@ uint16_t Server::runIterate() {
         runStartup(*this, context());
     }
     auto interval = UA_Server_run_iterate(handle(), false /* don't wait */);
+    refreshSessionDiagnostics(*this, context());
     context().exceptionCatcher.rethrow();
     return interval;
 }
@@ -464,6 +731,7 @@ void Server::run() {
         while (context().running) {
             // https://github.com/open62541/open62541/blob/master/examples/server_mainloop.c
             UA_Server_run_iterate(handle(), true /* wait for messages in the networklayer */);
+            refreshSessionDiagnostics(*this, context());
             context().exceptionCatcher.rethrow();
         }
     } catch (...) {
@@ -584,6 +852,21 @@ UA_Server* getHandle(Server& server) noexcept {
     return server.handle();
 }
 
+NodeContext& installValueCallback(Server& server, const NodeId& id) {
+    auto* nodeContext = getContext(server).nodeContexts[id];
+    if (nodeContext->valueCallbackInstalled) {
+        return *nodeContext;
+    }
+    throwIfBad(UA_Server_setNodeContext(server.handle(), id, nodeContext));
+
+    UA_ValueCallback callbackNative;
+    callbackNative.onRead = valueCallbackOnRead;
+    callbackNative.onWrite = valueCallbackOnWrite;
+    throwIfBad(UA_Server_setVariableNode_valueCallback(server.handle(), id, callbackNative));
+    nodeContext->valueCallbackInstalled = true;
+    return *nodeContext;
+}
+
 }  // namespace detail
 
 }  // namespace opcua
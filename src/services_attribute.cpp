@@ -1,6 +1,12 @@
 #include "open62541pp/services/attribute.hpp"
 
+#include <cstddef>
+#include <utility>  // exchange
+
 #include "open62541pp/client.hpp"
+#include "open62541pp/detail/result_utils.hpp"  // tryInvoke
+#include "open62541pp/detail/server_context.hpp"
+#include "open62541pp/detail/types_handling.hpp"  // hash
 #include "open62541pp/server.hpp"
 
 namespace opcua::services {
@@ -41,6 +47,55 @@ StatusCode writeAttribute<Server>(
     return UA_Server_write(connection.handle(), &item);
 }
 
+static size_t hashValueAndStatus(const DataValue& value) noexcept {
+    // shallow view without timestamps, missing values and status codes hash like empty/good ones
+    UA_DataValue view{};
+    view.value = *value.value().handle();
+    view.hasValue = true;
+    view.status = value.status().get();
+    view.hasStatus = true;
+    const size_t hash = opcua::detail::hash(&view, UA_TYPES[UA_TYPES_DATAVALUE]);
+    return hash == 0 ? 1 : hash;  // 0 is reserved for unknown values
+}
+
+Result<bool> writeDataValueIfChanged(
+    Server& connection, const NodeId& id, const DataValue& value
+) noexcept {
+    // compare with the hash of the current value instead of reading the node, a read would copy
+    // the value and invoke value callbacks and data sources
+    auto nodeContext = opcua::detail::tryInvoke([&] {
+        return &opcua::detail::installValueCallback(connection, id);
+    });
+    if (!nodeContext) {
+        return BadResult(nodeContext.code());
+    }
+    auto& writtenValueHash = (*nodeContext)->writtenValueHash;
+    const size_t hash = hashValueAndStatus(value);
+    if (writtenValueHash == hash) {
+        return false;
+    }
+    // the hash is stored by the onWrite value callback, synchronized with the write
+    opcua::detail::pendingWrittenValueHash = hash;
+    const auto item = detail::createWriteValue(id, AttributeId::Value, value);
+    const StatusCode status = UA_Server_write(connection.handle(), &item);
+    if (std::exchange(opcua::detail::pendingWrittenValueHash, 0) != 0) {
+        // failed or not taken by the value callback (e.g. data sources), current value unknown
+        writtenValueHash = 0;
+    }
+    if (status.isBad()) {
+        return BadResult(status);
+    }
+    return true;
+}
+
+Result<bool> writeValueIfChanged(
+    Server& connection, const NodeId& id, const Variant& value
+) noexcept {
+    return writeDataValueIfChanged(
+        connection, id, detail::AttributeHandler<AttributeId::Value>::toDataValue(value)
+    );
+}
+
 template <>
 StatusCode writeAttribute<Client>(
     Client& connection, const NodeId& id, AttributeId attributeId, const DataValue& value
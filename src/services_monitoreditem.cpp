@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <cstddef>
 
+#include "open62541pp/aggregate.hpp"
 #include "open62541pp/client.hpp"
 #include "open62541pp/detail/client_context.hpp"
 #include "open62541pp/detail/exceptioncatcher.hpp"
@@ -92,6 +93,32 @@ void convertMonitoredItemContexts(
     }
 }
 
+static StatusCode createMonitoredItemAggregate(
+    const AggregateFilter& filter, MonitoredItemContext& context
+) {
+    if (!AggregateCalculator::isSupported(filter.aggregateType())) {
+        return UA_STATUSCODE_BADAGGREGATENOTSUPPORTED;
+    }
+    if (!(filter.processingInterval() > 0.0)) {
+        return UA_STATUSCODE_BADMONITOREDITEMFILTERINVALID;
+    }
+    auto& aggregate = context.aggregate.emplace();
+    aggregate.aggregateType = filter.aggregateType();
+    aggregate.processingInterval = std::max<int64_t>(
+        1, static_cast<int64_t>(filter.processingInterval() * UA_DATETIME_MSEC)
+    );
+    // align a start time in the past to the interval containing now, the elapsed intervals
+    // contain no values and must not be published
+    const int64_t now = DateTime::now().get();
+    int64_t startTime = filter.startTime().get() == 0 ? now : filter.startTime().get();
+    if (startTime < now) {
+        startTime += (now - startTime) / aggregate.processingInterval *
+                     aggregate.processingInterval;
+    }
+    aggregate.calculator.reset(DateTime(startTime));
+    return UA_STATUSCODE_GOOD;
+}
+
 template <typename T>
 static void storeMonitoredItemContext(
     T& connection,
@@ -186,13 +213,43 @@ MonitoredItemCreateResult createMonitoredItemDataChange<Server>(
     auto context = detail::createMonitoredItemContext(
         connection, itemToMonitor, std::move(dataChangeCallback), {}, std::move(deleteCallback)
     );
+    auto request = detail::createMonitoredItemCreateRequest(
+        itemToMonitor, monitoringMode, parameters
+    );
+    // open62541 doesn't support aggregate filters, aggregate samples locally instead
+    // (monitored items of remote clients with aggregate filters are still rejected by open62541)
+    const auto* aggregateFilter = parameters.filter.decodedData<AggregateFilter>();
+    if (aggregateFilter != nullptr) {
+        const auto status = detail::createMonitoredItemAggregate(*aggregateFilter, *context);
+        if (status.isBad()) {
+            MonitoredItemCreateResult result;
+            result->statusCode = status;
+            return result;
+        }
+        request.requestedParameters.filter = {};
+    }
     MonitoredItemCreateResult result = UA_Server_createDataChangeMonitoredItem(
         connection.handle(),
         static_cast<UA_TimestampsToReturn>(parameters.timestamps),
-        detail::createMonitoredItemCreateRequest(itemToMonitor, monitoringMode, parameters),
+        request,
         context.get(),
         detail::MonitoredItemContext::dataChangeCallbackNativeServer
     );
+    if (context->aggregate.has_value() && result.statusCode().isGood()) {
+        context->aggregate->monitoredItemId = result.monitoredItemId();
+        const StatusCode status = UA_Server_addRepeatedCallback(
+            connection.handle(),
+            detail::MonitoredItemContext::aggregateCallbackNativeServer,
+            context.get(),
+            aggregateFilter->processingInterval(),
+            &context->aggregate->callbackId
+        );
+        if (status.isBad()) {
+            UA_Server_deleteMonitoredItem(connection.handle(), result.monitoredItemId());
+            result->statusCode = status;
+            return result;
+        }
+    }
     detail::storeMonitoredItemContext(connection, 0U, result, context);
     return result;
 }
@@ -286,8 +343,13 @@ template <>
 StatusCode deleteMonitoredItem<Server>(
     Server& connection, [[maybe_unused]] IntegerId subscriptionId, IntegerId monitoredItemId
 ) {
+    auto& monitoredItems = opcua::detail::getContext(connection).monitoredItems;
+    const auto* context = monitoredItems.find({0U, monitoredItemId});
+    if (context != nullptr && context->aggregate.has_value()) {
+        UA_Server_removeRepeatedCallback(connection.handle(), context->aggregate->callbackId);
+    }
     const auto status = UA_Server_deleteMonitoredItem(connection.handle(), monitoredItemId);
-    opcua::detail::getContext(connection).monitoredItems.erase({0U, monitoredItemId});
+    monitoredItems.erase({0U, monitoredItemId});
     return status;
 }
 
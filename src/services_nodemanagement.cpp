@@ -86,7 +86,7 @@ Result<NodeId> addNode<Client>(
 
 static UA_StatusCode methodCallback(
     [[maybe_unused]] UA_Server* server,
-    [[maybe_unused]] const UA_NodeId* sessionId,
+    const UA_NodeId* sessionId,
     [[maybe_unused]] void* sessionContext,
     [[maybe_unused]] const UA_NodeId* methodId,
     void* methodContext,
@@ -99,10 +99,20 @@ static UA_StatusCode methodCallback(
 ) noexcept {
     assert(methodContext != nullptr);
     const auto* nodeContext = static_cast<opcua::detail::NodeContext*>(methodContext);
-    const auto& callback = nodeContext->methodCallback;
-    if (callback) {
+    if (const auto callback = nodeContext->sessionMethodCallback.load();
+        callback && *callback && sessionId != nullptr) {
         return opcua::detail::tryInvoke(
-                   callback,
+                   *callback,
+                   asWrapper<NodeId>(*sessionId),
+                   Span<const Variant>{asWrapper<Variant>(input), inputSize},
+                   Span<Variant>{asWrapper<Variant>(output), outputSize}
+        )
+            .code();
+    }
+    const auto callback = nodeContext->methodCallback.load();
+    if (callback && *callback) {
+        return opcua::detail::tryInvoke(
+                   *callback,
                    Span<const Variant>{asWrapper<Variant>(input), inputSize},
                    Span<Variant>{asWrapper<Variant>(output), outputSize}
         )
@@ -125,7 +135,7 @@ Result<NodeId> addMethod(
 ) noexcept {
     return opcua::detail::tryInvoke([&] {
         auto* nodeContext = opcua::detail::getContext(connection).nodeContexts[id];
-        nodeContext->methodCallback = std::move(callback);
+        nodeContext->methodCallback.store(std::move(callback));
         NodeId outputNodeId;
         throwIfBad(UA_Server_addMethodNode(
             connection.handle(),
@@ -207,6 +217,11 @@ template <>
 StatusCode deleteNode<Server>(
     Server& connection, const NodeId& id, bool deleteReferences
 ) noexcept {
+    if (auto* nodeContext = opcua::detail::getContext(connection).nodeContexts.find(id)) {
+        // a node added later with the same id gets new native callbacks and an unknown value
+        nodeContext->valueCallbackInstalled = false;
+        nodeContext->writtenValueHash = 0;
+    }
     return UA_Server_deleteNode(connection.handle(), id, deleteReferences);
 }
 
@@ -1,9 +1,11 @@
 #include "open62541pp/session.hpp"
 
+#include <mutex>
 #include <string>
 
 #include "open62541pp/config.hpp"
 #include "open62541pp/detail/open62541/server.h"
+#include "open62541pp/detail/server_context.hpp"
 #include "open62541pp/exception.hpp"
 #include "open62541pp/server.hpp"
 #include "open62541pp/types.hpp"
@@ -51,6 +53,42 @@ void Session::deleteSessionAttribute([[maybe_unused]] const QualifiedName& key)
 #endif
 }
 
+std::unique_lock<std::mutex> Session::lockSessionContext(detail::SessionContext*& context) {
+    if (context_ != nullptr) {
+        context = context_;
+        return {};
+    }
+    auto& registry = detail::getContext(connection()).sessionRegistry;
+    std::unique_lock lock(registry.mutex);
+    auto it = registry.sessions.find(id());
+    if (it == registry.sessions.end()) {
+        throw BadStatus(UA_STATUSCODE_BADSESSIONIDINVALID);
+    }
+    context = &it->second;
+    return lock;
+}
+
+SessionStatistics Session::statistics() {
+    auto& registry = detail::getContext(connection()).sessionRegistry;
+    const std::scoped_lock lock(registry.mutex);
+    auto it = registry.sessions.find(id());
+    if (it == registry.sessions.end()) {
+        throw BadStatus(UA_STATUSCODE_BADSESSIONIDINVALID);
+    }
+    SessionStatistics stats;
+    if (auto diagnostics = registry.diagnostics.find(id());
+        diagnostics != registry.diagnostics.end()) {
+        stats = diagnostics->second;
+    }
+    const auto& counters = it->second.counters();
+    stats.attributeAccessChecks = counters.get(detail::SessionAccessCheck::Attribute);
+    stats.methodAccessChecks = counters.get(detail::SessionAccessCheck::Method);
+    stats.browseAccessChecks = counters.get(detail::SessionAccessCheck::Browse);
+    stats.nodeManagementAccessChecks = counters.get(detail::SessionAccessCheck::NodeManagement);
+    stats.lastAccessCheck = DateTime(counters.lastAccessCheck.load(std::memory_order_relaxed));
+    return stats;
+}
+
 void Session::close() {
 #if UAPP_OPEN62541_VER_GE(1, 3)
     throwIfBad(UA_Server_closeSession(connection().handle(), id().handle()));
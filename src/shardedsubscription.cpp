@@ -0,0 +1,170 @@
+#include "open62541pp/shardedsubscription.hpp"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <algorithm>  // all_of, any_of, find_if, max
+#include <utility>  // move
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/exception.hpp"
+
+namespace opcua {
+
+ShardedSubscription::ShardedSubscription(Client& client, ShardedSubscriptionOptions options)
+    : sessions_{&client},
+      options_(std::move(options)),
+      sessionsFull_(1, false) {}
+
+ShardedSubscription::ShardedSubscription(
+    Span<Client* const> sessions, ShardedSubscriptionOptions options
+)
+    : sessions_(sessions.begin(), sessions.end()),
+      options_(std::move(options)),
+      sessionsFull_(sessions.size(), false) {
+    if (sessions_.empty() ||
+        std::any_of(sessions_.begin(), sessions_.end(), [](auto* s) { return s == nullptr; })) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+}
+
+ShardedSubscription::~ShardedSubscription() {
+    for (const auto& shard : shards_) {
+        // ignore errors, e.g. if the session is already closed
+        (void)services::deleteSubscription(*shard.session, shard.subscriptionId);
+    }
+}
+
+void ShardedSubscription::setNotificationCallback(NotificationCallback callback) {
+    callback_ = std::move(callback);
+}
+
+IntegerId ShardedSubscription::subscribeDataChange(
+    const NodeId& id, AttributeId attribute, const MonitoringParametersEx& parameters
+) {
+    const size_t cls = rateClass(parameters.samplingInterval);
+    const size_t slots = sessions_.size() * std::max<size_t>(options_.shardsPerSession, 1);
+    const size_t start = id.hash() % slots;
+    const IntegerId handle = nextHandle_;
+
+    // probe the regular slots starting with the hashed one, then the existing overflow slots
+    // and append new overflow slots
+    for (size_t i = 0;; ++i) {
+        const bool allSessionsFull = std::all_of(
+            sessionsFull_.begin(), sessionsFull_.end(), [](bool full) { return full; }
+        );
+        if (i >= slots && allSessionsFull) {
+            const auto next = slots_.lower_bound({cls, i});
+            if (next == slots_.end() || next->first.first != cls) {
+                throw BadStatus(UA_STATUSCODE_BADTOOMANYSUBSCRIPTIONS);
+            }
+            i = next->first.second;  // skip gaps of overflow slots that were never created
+        }
+        const size_t slot = i < slots ? (start + i) % slots : i;
+        const auto index = getOrCreateShard(cls, slot);
+        if (!index.has_value()) {
+            continue;
+        }
+        auto& shard = shards_[*index];
+        const size_t limit = options_.maxItemsPerSubscription;
+        if (shard.full || (limit > 0 && shard.itemCount >= limit)) {
+            continue;
+        }
+        const auto result = services::createMonitoredItemDataChange(
+            *shard.session,
+            shard.subscriptionId,
+            ReadValueId(id, attribute),
+            MonitoringMode::Reporting,
+            parameters,
+            [this, handle](IntegerId, IntegerId, const DataValue& value) {
+                if (callback_) {
+                    callback_(handle, value);
+                }
+            },
+            {}
+        );
+        if (result.statusCode() == UA_STATUSCODE_BADTOOMANYMONITOREDITEMS &&
+            shard.itemCount > 0) {
+            // rebalance to the next shard
+            shard.full = true;
+            continue;
+        }
+        result.statusCode().throwIfBad();
+        ++shard.itemCount;
+        items_.emplace(handle, Item{*index, result.monitoredItemId()});
+        ++nextHandle_;
+        return handle;
+    }
+}
+
+void ShardedSubscription::unsubscribe(IntegerId handle) {
+    const auto it = items_.find(handle);
+    if (it == items_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    auto& shard = shards_[it->second.shard];
+    const auto status = services::deleteMonitoredItem(
+        *shard.session, shard.subscriptionId, it->second.monitoredItemId
+    );
+    --shard.itemCount;
+    shard.full = false;
+    items_.erase(it);
+    status.throwIfBad();
+}
+
+const ShardedSubscription::Shard& ShardedSubscription::shard(IntegerId handle) const {
+    const auto it = items_.find(handle);
+    if (it == items_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    return shards_[it->second.shard];
+}
+
+IntegerId ShardedSubscription::monitoredItemId(IntegerId handle) const {
+    const auto it = items_.find(handle);
+    if (it == items_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    return it->second.monitoredItemId;
+}
+
+size_t ShardedSubscription::rateClass(double samplingInterval) const noexcept {
+    if (options_.strategy != ShardingStrategy::RateClass) {
+        return 0;
+    }
+    const auto& bounds = options_.rateClasses;
+    const auto it = std::find_if(bounds.begin(), bounds.end(), [&](double bound) {
+        return samplingInterval <= bound;
+    });
+    return static_cast<size_t>(it - bounds.begin());
+}
+
+std::optional<size_t> ShardedSubscription::getOrCreateShard(size_t rateClass, size_t slot) {
+    if (const auto it = slots_.find({rateClass, slot}); it != slots_.end()) {
+        return it->second;
+    }
+    const size_t session = slot % sessions_.size();
+    if (sessionsFull_[session]) {
+        return std::nullopt;
+    }
+    SubscriptionParameters parameters = options_.subscriptionParameters;
+    if (options_.strategy == ShardingStrategy::RateClass &&
+        rateClass < options_.rateClasses.size()) {
+        parameters.publishingInterval = options_.rateClasses[rateClass];
+    }
+    const auto response = services::createSubscription(
+        *sessions_[session], parameters, true, {}, {}
+    );
+    const StatusCode status = response.responseHeader().serviceResult();
+    if (status == UA_STATUSCODE_BADTOOMANYSUBSCRIPTIONS) {
+        sessionsFull_[session] = true;
+        return std::nullopt;
+    }
+    status.throwIfBad();
+    shards_.push_back({sessions_[session], response.subscriptionId(), rateClass, 0, false});
+    slots_.emplace(std::make_pair(rateClass, slot), shards_.size() - 1);
+    return shards_.size() - 1;
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,165 @@
+#include "open62541pp/detail/timer_registry.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>  // uintptr_t
+#include <utility>  // move
+
+#include "open62541pp/detail/open62541/common.h"
+#include "open62541pp/exception.hpp"
+
+namespace opcua::detail {
+
+static void* toData(uint64_t slotId) noexcept {
+    return reinterpret_cast<void*>(static_cast<uintptr_t>(slotId));  // NOLINT
+}
+
+static uint64_t fromData(void* data) noexcept {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(data));  // NOLINT
+}
+
+TimerId TimerRegistry::add(
+    double interval,
+    bool once,
+    TimerCallback&& callback,
+    const AddNative& addNative,
+    const RemoveNative& removeNative
+) {
+    if (!once && interval <= 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    std::unique_lock lock(mutex_);
+    const TimerId id = nextTimerId_++;
+    auto sharedCallback = std::make_shared<TimerCallback>(std::move(callback));
+    if (!once) {
+        if (const auto it = groups_.find(interval); it != groups_.end()) {
+            slots_.at(it->second).timers.push_back(id);
+            timers_.emplace(id, Timer{std::move(sharedCallback), it->second});
+            return id;
+        }
+    }
+    const SlotId slotId = nextSlotId_++;
+    slots_.emplace(slotId, Slot{interval, once, std::nullopt, {id}});
+    if (!once) {
+        groups_.emplace(interval, slotId);
+    }
+    timers_.emplace(id, Timer{std::move(sharedCallback), slotId});
+    lock.unlock();
+
+    // the native callback might fire and the slot might be removed concurrently
+    NativeId nativeId = 0;
+    try {
+        nativeId = addNative(toData(slotId), interval, once);
+    } catch (...) {
+        lock.lock();
+        eraseSlot(slotId);
+        throw;
+    }
+    lock.lock();
+    if (const auto it = slots_.find(slotId); it != slots_.end()) {
+        it->second.nativeId = nativeId;
+        return id;
+    }
+    lock.unlock();
+    removeNative(nativeId);  // all timers of the slot were removed in the meantime
+    return id;
+}
+
+bool TimerRegistry::remove(TimerId id, const RemoveNative& removeNative) {
+    std::optional<NativeId> nativeId;
+    {
+        const std::lock_guard lock(mutex_);
+        const auto it = timers_.find(id);
+        if (it == timers_.end()) {
+            return false;
+        }
+        const SlotId slotId = it->second.slot;
+        timers_.erase(it);
+        auto& timers = slots_.at(slotId).timers;
+        timers.erase(std::remove(timers.begin(), timers.end(), id), timers.end());
+        if (!timers.empty()) {
+            return true;
+        }
+        // empty if the native callback is not added yet, it is removed by add afterwards
+        nativeId = slots_.at(slotId).nativeId;
+        eraseSlot(slotId);
+    }
+    if (nativeId.has_value()) {
+        removeNative(*nativeId);
+    }
+    return true;
+}
+
+std::optional<TimerStatistics> TimerRegistry::statistics(TimerId id) const {
+    const std::lock_guard lock(mutex_);
+    const auto it = timers_.find(id);
+    if (it == timers_.end()) {
+        return std::nullopt;
+    }
+    return it->second.statistics;
+}
+
+void TimerRegistry::process(
+    void* data, ExceptionCatcher& catcher, const RemoveNative& removeNative
+) {
+    // callbacks might add or remove timers, including the slot itself -> work on copies
+    std::vector<TimerId> ids;
+    bool once = false;
+    std::chrono::duration<double, std::milli> interval{};
+    {
+        const std::lock_guard lock(mutex_);
+        const auto it = slots_.find(fromData(data));
+        if (it == slots_.end()) {
+            return;  // removed concurrently
+        }
+        ids = it->second.timers;
+        once = it->second.once;
+        interval = std::chrono::duration<double, std::milli>(it->second.interval);
+    }
+    for (const TimerId id : ids) {
+        std::shared_ptr<TimerCallback> callback;
+        {
+            const std::lock_guard lock(mutex_);
+            const auto it = timers_.find(id);
+            if (it == timers_.end()) {
+                continue;  // removed by a previous callback
+            }
+            callback = it->second.callback;
+        }
+        const auto start = std::chrono::steady_clock::now();
+        catcher.invoke(*callback);
+        const auto duration = std::chrono::steady_clock::now() - start;
+
+        const std::lock_guard lock(mutex_);
+        const auto it = timers_.find(id);
+        if (it == timers_.end()) {
+            continue;  // removed by itself
+        }
+        auto& statistics = it->second.statistics;
+        ++statistics.invocations;
+        statistics.lastDuration = duration;
+        statistics.maxDuration = std::max(statistics.maxDuration, duration);
+        if (!once && duration > interval) {
+            ++statistics.overruns;
+        }
+    }
+    if (once && !ids.empty()) {
+        remove(ids.front(), removeNative);
+    }
+}
+
+void TimerRegistry::eraseSlot(SlotId slotId) {
+    const auto it = slots_.find(slotId);
+    if (it == slots_.end()) {
+        return;
+    }
+    for (const TimerId id : it->second.timers) {
+        timers_.erase(id);
+    }
+    if (!it->second.once) {
+        groups_.erase(it->second.interval);
+    }
+    slots_.erase(it);
+}
+
+}  // namespace opcua::detail
@@ -0,0 +1,559 @@
+#include "open62541pp/detail/types_handling.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>  // memcmp, memcpy
+
+#include "open62541pp/config.hpp"
+
+namespace opcua::detail {
+
+/* ------------------------------------------- Helper ------------------------------------------- */
+
+static const UA_DataType& getMemberType(
+    [[maybe_unused]] const UA_DataType& type, const UA_DataTypeMember& member
+) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    return *member.memberType;
+#else
+    // member types are either builtin types or types of the same array (custom types)
+    const UA_DataType* typeArray = member.namespaceZero ? UA_TYPES : &type - type.typeIndex;
+    return typeArray[member.memberTypeIndex];
+#endif
+}
+
+static constexpr bool isOptional([[maybe_unused]] const UA_DataTypeMember& member) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    return member.isOptional;
+#else
+    return false;
+#endif
+}
+
+/// Check if the memory representation of values is unique (pointer-free without padding bytes).
+/// Values of these types can be compared and hashed bytewise.
+static bool isPackedImpl(const UA_DataType& type) noexcept {
+    if (!type.pointerFree) {
+        return false;
+    }
+    if (type.typeKind != UA_DATATYPEKIND_STRUCTURE) {
+        return true;
+    }
+    size_t size = 0;
+    for (size_t i = 0; i < type.membersSize; ++i) {
+        const auto& member = type.members[i];  // NOLINT
+        const auto& memberType = getMemberType(type, member);
+        if (member.padding != 0 || !isPackedImpl(memberType)) {
+            return false;
+        }
+        size += memberType.memSize;
+    }
+    return size == type.memSize;
+}
+
+/// Cached result of isPackedImpl for pointer-free structures, the only types that require a walk
+/// over the members.
+/// The small direct-mapped cache per thread avoids locks, the type size is stored along with the
+/// result to detect reused addresses of custom types.
+static bool isPacked(const UA_DataType& type) noexcept {
+    if (!type.pointerFree) {
+        return false;
+    }
+    if (type.typeKind != UA_DATATYPEKIND_STRUCTURE) {
+        return true;
+    }
+    struct Entry {
+        const UA_DataType* type;
+        size_t memSize;
+        size_t membersSize;
+        bool packed;
+    };
+    static thread_local std::array<Entry, 64> cache{};
+    const auto address = reinterpret_cast<uintptr_t>(&type);  // NOLINT
+    auto& entry = cache[(address / sizeof(UA_DataType)) % cache.size()];
+    if (entry.type != &type || entry.memSize != type.memSize ||
+        entry.membersSize != type.membersSize) {
+        entry = {&type, type.memSize, type.membersSize, isPackedImpl(type)};
+    }
+    return entry.packed;
+}
+
+static bool isScalar(const UA_Variant& var) noexcept {
+    return var.arrayLength == 0 && var.data > UA_EMPTY_ARRAY_SENTINEL;  // NOLINT
+}
+
+static bool isSameType(const UA_DataType* lhs, const UA_DataType* rhs) noexcept {
+    return (lhs == rhs) ||
+        (lhs != nullptr && rhs != nullptr && UA_NodeId_equal(&lhs->typeId, &rhs->typeId));
+}
+
+template <typename T>
+static const T& memberAt(uintptr_t ptr) noexcept {
+    return *reinterpret_cast<const T*>(ptr);  // NOLINT
+}
+
+/* -------------------------------------------- Equal ------------------------------------------- */
+
+static bool isEqualString(const UA_String& lhs, const UA_String& rhs) noexcept {
+    return (lhs.length == rhs.length) &&
+        (lhs.length == 0 || std::memcmp(lhs.data, rhs.data, lhs.length) == 0);
+}
+
+static bool isEqualVariant(const UA_Variant& lhs, const UA_Variant& rhs) noexcept {
+    if (!isSameType(lhs.type, rhs.type)) {
+        return false;
+    }
+    if (lhs.type == nullptr) {
+        return true;
+    }
+    const bool scalar = isScalar(lhs);
+    if (scalar != isScalar(rhs)) {
+        return false;
+    }
+    if (scalar) {
+        return isEqual(lhs.data, rhs.data, *lhs.type);
+    }
+    return (lhs.arrayLength == rhs.arrayLength) &&
+        (lhs.arrayDimensionsSize == rhs.arrayDimensionsSize) &&
+        isEqualArray(
+            lhs.arrayDimensions,
+            rhs.arrayDimensions,
+            lhs.arrayDimensionsSize,
+            UA_TYPES[UA_TYPES_UINT32]
+        ) &&
+        isEqualArray(lhs.data, rhs.data, lhs.arrayLength, *lhs.type);
+}
+
+static bool isEqualDataValue(const UA_DataValue& lhs, const UA_DataValue& rhs) noexcept {
+    return (lhs.hasValue == rhs.hasValue) && (lhs.hasStatus == rhs.hasStatus) &&
+        (lhs.hasSourceTimestamp == rhs.hasSourceTimestamp) &&
+        (lhs.hasServerTimestamp == rhs.hasServerTimestamp) &&
+        (lhs.hasSourcePicoseconds == rhs.hasSourcePicoseconds) &&
+        (lhs.hasServerPicoseconds == rhs.hasServerPicoseconds) &&
+        (!lhs.hasStatus || lhs.status == rhs.status) &&
+        (!lhs.hasSourceTimestamp || lhs.sourceTimestamp == rhs.sourceTimestamp) &&
+        (!lhs.hasServerTimestamp || lhs.serverTimestamp == rhs.serverTimestamp) &&
+        (!lhs.hasSourcePicoseconds || lhs.sourcePicoseconds == rhs.sourcePicoseconds) &&
+        (!lhs.hasServerPicoseconds || lhs.serverPicoseconds == rhs.serverPicoseconds) &&
+        (!lhs.hasValue || isEqualVariant(lhs.value, rhs.value));
+}
+
+static bool isEqualExtensionObject(
+    const UA_ExtensionObject& lhs, const UA_ExtensionObject& rhs
+) noexcept {
+    if (lhs.encoding != rhs.encoding) {
+        return false;
+    }
+    if (lhs.encoding >= UA_EXTENSIONOBJECT_DECODED) {
+        const auto& lhsDecoded = lhs.content.decoded;  // NOLINT
+        const auto& rhsDecoded = rhs.content.decoded;  // NOLINT
+        if (!isSameType(lhsDecoded.type, rhsDecoded.type)) {
+            return false;
+        }
+        if (lhsDecoded.type == nullptr || lhsDecoded.data == nullptr ||
+            rhsDecoded.data == nullptr) {
+            return lhsDecoded.data == rhsDecoded.data;
+        }
+        return isEqual(lhsDecoded.data, rhsDecoded.data, *lhsDecoded.type);
+    }
+    const auto& lhsEncoded = lhs.content.encoded;  // NOLINT
+    const auto& rhsEncoded = rhs.content.encoded;  // NOLINT
+    return UA_NodeId_equal(&lhsEncoded.typeId, &rhsEncoded.typeId) &&
+        isEqualString(lhsEncoded.body, rhsEncoded.body);
+}
+
+static bool isEqualDiagnosticInfo(
+    const UA_DiagnosticInfo& lhs, const UA_DiagnosticInfo& rhs
+) noexcept {
+    if ((lhs.hasSymbolicId != rhs.hasSymbolicId) ||
+        (lhs.hasNamespaceUri != rhs.hasNamespaceUri) ||
+        (lhs.hasLocalizedText != rhs.hasLocalizedText) || (lhs.hasLocale != rhs.hasLocale) ||
+        (lhs.hasAdditionalInfo != rhs.hasAdditionalInfo) ||
+        (lhs.hasInnerStatusCode != rhs.hasInnerStatusCode) ||
+        (lhs.hasInnerDiagnosticInfo != rhs.hasInnerDiagnosticInfo)) {
+        return false;
+    }
+    if (lhs.hasInnerDiagnosticInfo &&
+        (lhs.innerDiagnosticInfo == nullptr || rhs.innerDiagnosticInfo == nullptr)) {
+        return lhs.innerDiagnosticInfo == rhs.innerDiagnosticInfo;
+    }
+    return (!lhs.hasSymbolicId || lhs.symbolicId == rhs.symbolicId) &&
+        (!lhs.hasNamespaceUri || lhs.namespaceUri == rhs.namespaceUri) &&
+        (!lhs.hasLocalizedText || lhs.localizedText == rhs.localizedText) &&
+        (!lhs.hasLocale || lhs.locale == rhs.locale) &&
+        (!lhs.hasAdditionalInfo || isEqualString(lhs.additionalInfo, rhs.additionalInfo)) &&
+        (!lhs.hasInnerStatusCode || lhs.innerStatusCode == rhs.innerStatusCode) &&
+        (!lhs.hasInnerDiagnosticInfo ||
+         isEqualDiagnosticInfo(*lhs.innerDiagnosticInfo, *rhs.innerDiagnosticInfo));
+}
+
+static bool isEqualMember(
+    uintptr_t& lhs, uintptr_t& rhs, const UA_DataTypeMember& member, const UA_DataType& memberType
+) noexcept {
+    if (member.isArray) {
+        const auto lhsSize = memberAt<size_t>(lhs);
+        const auto rhsSize = memberAt<size_t>(rhs);
+        lhs += sizeof(size_t);
+        rhs += sizeof(size_t);
+        const bool equal = (lhsSize == rhsSize) &&
+            isEqualArray(memberAt<void*>(lhs), memberAt<void*>(rhs), lhsSize, memberType);
+        lhs += sizeof(void*);
+        rhs += sizeof(void*);
+        return equal;
+    }
+    if (isOptional(member)) {
+        const auto* lhsMember = memberAt<void*>(lhs);
+        const auto* rhsMember = memberAt<void*>(rhs);
+        lhs += sizeof(void*);
+        rhs += sizeof(void*);
+        if (lhsMember == nullptr || rhsMember == nullptr) {
+            return lhsMember == rhsMember;
+        }
+        return isEqual(lhsMember, rhsMember, memberType);
+    }
+    const bool equal = isEqual(
+        reinterpret_cast<const void*>(lhs),  // NOLINT
+        reinterpret_cast<const void*>(rhs),  // NOLINT
+        memberType
+    );
+    lhs += memberType.memSize;
+    rhs += memberType.memSize;
+    return equal;
+}
+
+static bool isEqualStructure(const void* lhs, const void* rhs, const UA_DataType& type) noexcept {
+    auto lhsPtr = reinterpret_cast<uintptr_t>(lhs);  // NOLINT
+    auto rhsPtr = reinterpret_cast<uintptr_t>(rhs);  // NOLINT
+    for (size_t i = 0; i < type.membersSize; ++i) {
+        const auto& member = type.members[i];  // NOLINT
+        lhsPtr += member.padding;
+        rhsPtr += member.padding;
+        if (!isEqualMember(lhsPtr, rhsPtr, member, getMemberType(type, member))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 1)
+static bool isEqualUnion(const void* lhs, const void* rhs, const UA_DataType& type) noexcept {
+    const auto selection = *static_cast<const UA_UInt32*>(lhs);
+    if (selection != *static_cast<const UA_UInt32*>(rhs)) {
+        return false;
+    }
+    if (selection == 0 || selection > type.membersSize) {
+        return true;
+    }
+    // padding of union members is the offset from the start of the union
+    const auto& member = type.members[selection - 1];  // NOLINT
+    auto lhsPtr = reinterpret_cast<uintptr_t>(lhs) + member.padding;  // NOLINT
+    auto rhsPtr = reinterpret_cast<uintptr_t>(rhs) + member.padding;  // NOLINT
+    return isEqualMember(lhsPtr, rhsPtr, member, getMemberType(type, member));
+}
+#endif
+
+bool isEqual(const void* lhs, const void* rhs, const UA_DataType& type) noexcept {
+    if (lhs == rhs) {
+        return true;
+    }
+    if (isPacked(type)) {
+        return std::memcmp(lhs, rhs, type.memSize) == 0;
+    }
+    switch (type.typeKind) {
+    case UA_DATATYPEKIND_STRING:
+    case UA_DATATYPEKIND_BYTESTRING:
+    case UA_DATATYPEKIND_XMLELEMENT:
+        return isEqualString(
+            *static_cast<const UA_String*>(lhs), *static_cast<const UA_String*>(rhs)
+        );
+    case UA_DATATYPEKIND_NODEID:
+        return UA_NodeId_equal(
+            static_cast<const UA_NodeId*>(lhs), static_cast<const UA_NodeId*>(rhs)
+        );
+    case UA_DATATYPEKIND_EXPANDEDNODEID:
+        return UA_ExpandedNodeId_equal(
+            static_cast<const UA_ExpandedNodeId*>(lhs), static_cast<const UA_ExpandedNodeId*>(rhs)
+        );
+    case UA_DATATYPEKIND_QUALIFIEDNAME: {
+        const auto& lhsName = *static_cast<const UA_QualifiedName*>(lhs);
+        const auto& rhsName = *static_cast<const UA_QualifiedName*>(rhs);
+        return (lhsName.namespaceIndex == rhsName.namespaceIndex) &&
+            isEqualString(lhsName.name, rhsName.name);
+    }
+    case UA_DATATYPEKIND_LOCALIZEDTEXT: {
+        const auto& lhsText = *static_cast<const UA_LocalizedText*>(lhs);
+        const auto& rhsText = *static_cast<const UA_LocalizedText*>(rhs);
+        return isEqualString(lhsText.locale, rhsText.locale) &&
+            isEqualString(lhsText.text, rhsText.text);
+    }
+    case UA_DATATYPEKIND_EXTENSIONOBJECT:
+        return isEqualExtensionObject(
+            *static_cast<const UA_ExtensionObject*>(lhs),
+            *static_cast<const UA_ExtensionObject*>(rhs)
+        );
+    case UA_DATATYPEKIND_DATAVALUE:
+        return isEqualDataValue(
+            *static_cast<const UA_DataValue*>(lhs), *static_cast<const UA_DataValue*>(rhs)
+        );
+    case UA_DATATYPEKIND_VARIANT:
+        return isEqualVariant(
+            *static_cast<const UA_Variant*>(lhs), *static_cast<const UA_Variant*>(rhs)
+        );
+    case UA_DATATYPEKIND_DIAGNOSTICINFO:
+        return isEqualDiagnosticInfo(
+            *static_cast<const UA_DiagnosticInfo*>(lhs), *static_cast<const UA_DiagnosticInfo*>(rhs)
+        );
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    case UA_DATATYPEKIND_UNION:
+        return isEqualUnion(lhs, rhs, type);
+#endif
+    default:
+        return isEqualStructure(lhs, rhs, type);
+    }
+}
+
+bool isEqualArray(const void* lhs, const void* rhs, size_t size, const UA_DataType& type) noexcept {
+    if (size == 0 || lhs == rhs) {
+        return true;
+    }
+    if (isPacked(type)) {
+        return std::memcmp(lhs, rhs, size * type.memSize) == 0;
+    }
+    auto lhsPtr = reinterpret_cast<uintptr_t>(lhs);  // NOLINT
+    auto rhsPtr = reinterpret_cast<uintptr_t>(rhs);  // NOLINT
+    for (size_t i = 0; i < size; ++i) {
+        if (!isEqual(
+                reinterpret_cast<const void*>(lhsPtr),  // NOLINT
+                reinterpret_cast<const void*>(rhsPtr),  // NOLINT
+                type
+            )) {
+            return false;
+        }
+        lhsPtr += type.memSize;
+        rhsPtr += type.memSize;
+    }
+    return true;
+}
+
+/* -------------------------------------------- Hash -------------------------------------------- */
+
+// FNV-1a, processing 8-byte words at once
+constexpr uint64_t fnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t fnvPrime = 1099511628211ULL;
+
+static constexpr uint64_t hashWord(uint64_t hash, uint64_t word) noexcept {
+    return (hash ^ word) * fnvPrime;
+}
+
+static uint64_t hashBytes(uint64_t hash, const void* data, size_t size) noexcept {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (; size >= sizeof(uint64_t); size -= sizeof(uint64_t), bytes += sizeof(uint64_t)) {
+        uint64_t word{};
+        std::memcpy(&word, bytes, sizeof(uint64_t));
+        hash = hashWord(hash, word);
+    }
+    for (; size > 0; --size, ++bytes) {
+        hash = hashWord(hash, *bytes);
+    }
+    return hash;
+}
+
+static uint64_t hashImpl(uint64_t hash, const void* data, const UA_DataType& type) noexcept;
+static uint64_t hashArrayImpl(
+    uint64_t hash, const void* data, size_t size, const UA_DataType& type
+) noexcept;
+
+static uint64_t hashString(uint64_t hash, const UA_String& str) noexcept {
+    hash = hashWord(hash, str.length);
+    return str.length == 0 ? hash : hashBytes(hash, str.data, str.length);
+}
+
+static uint64_t hashVariant(uint64_t hash, const UA_Variant& var) noexcept {
+    if (var.type == nullptr) {
+        return hashWord(hash, 0);
+    }
+    hash = hashWord(hash, UA_NodeId_hash(&var.type->typeId));
+    if (isScalar(var)) {
+        return hashImpl(hash, var.data, *var.type);
+    }
+    hash = hashWord(hash, var.arrayLength);
+    hash = hashArrayImpl(
+        hash, var.arrayDimensions, var.arrayDimensionsSize, UA_TYPES[UA_TYPES_UINT32]
+    );
+    return hashArrayImpl(hash, var.data, var.arrayLength, *var.type);
+}
+
+static uint64_t hashDataValue(uint64_t hash, const UA_DataValue& dv) noexcept {
+    const uint64_t mask = (dv.hasValue ? 1U : 0U) | (dv.hasStatus ? 2U : 0U) |
+        (dv.hasSourceTimestamp ? 4U : 0U) | (dv.hasServerTimestamp ? 8U : 0U) |
+        (dv.hasSourcePicoseconds ? 16U : 0U) | (dv.hasServerPicoseconds ? 32U : 0U);
+    hash = hashWord(hash, mask);
+    if (dv.hasStatus) {
+        hash = hashWord(hash, dv.status);
+    }
+    if (dv.hasSourceTimestamp) {
+        hash = hashWord(hash, static_cast<uint64_t>(dv.sourceTimestamp));
+    }
+    if (dv.hasServerTimestamp) {
+        hash = hashWord(hash, static_cast<uint64_t>(dv.serverTimestamp));
+    }
+    if (dv.hasSourcePicoseconds) {
+        hash = hashWord(hash, dv.sourcePicoseconds);
+    }
+    if (dv.hasServerPicoseconds) {
+        hash = hashWord(hash, dv.serverPicoseconds);
+    }
+    return dv.hasValue ? hashVariant(hash, dv.value) : hash;
+}
+
+static uint64_t hashExtensionObject(uint64_t hash, const UA_ExtensionObject& eo) noexcept {
+    hash = hashWord(hash, eo.encoding);
+    if (eo.encoding >= UA_EXTENSIONOBJECT_DECODED) {
+        const auto& decoded = eo.content.decoded;  // NOLINT
+        if (decoded.type == nullptr || decoded.data == nullptr) {
+            return hash;
+        }
+        hash = hashWord(hash, UA_NodeId_hash(&decoded.type->typeId));
+        return hashImpl(hash, decoded.data, *decoded.type);
+    }
+    const auto& encoded = eo.content.encoded;  // NOLINT
+    hash = hashWord(hash, UA_NodeId_hash(&encoded.typeId));
+    return hashString(hash, encoded.body);
+}
+
+static uint64_t hashDiagnosticInfo(uint64_t hash, const UA_DiagnosticInfo& info) noexcept {
+    if (info.hasSymbolicId) {
+        hash = hashWord(hash, static_cast<uint64_t>(info.symbolicId));
+    }
+    if (info.hasNamespaceUri) {
+        hash = hashWord(hash, static_cast<uint64_t>(info.namespaceUri));
+    }
+    if (info.hasLocalizedText) {
+        hash = hashWord(hash, static_cast<uint64_t>(info.localizedText));
+    }
+    if (info.hasLocale) {
+        hash = hashWord(hash, static_cast<uint64_t>(info.locale));
+    }
+    if (info.hasAdditionalInfo) {
+        hash = hashString(hash, info.additionalInfo);
+    }
+    if (info.hasInnerStatusCode) {
+        hash = hashWord(hash, info.innerStatusCode);
+    }
+    if (info.hasInnerDiagnosticInfo && info.innerDiagnosticInfo != nullptr) {
+        hash = hashDiagnosticInfo(hash, *info.innerDiagnosticInfo);
+    }
+    return hash;
+}
+
+static uint64_t hashMember(
+    uint64_t hash, uintptr_t& ptr, const UA_DataTypeMember& member, const UA_DataType& memberType
+) noexcept {
+    if (member.isArray) {
+        const auto size = memberAt<size_t>(ptr);
+        ptr += sizeof(size_t);
+        hash = hashWord(hash, size);
+        hash = hashArrayImpl(hash, memberAt<void*>(ptr), size, memberType);
+        ptr += sizeof(void*);
+        return hash;
+    }
+    if (isOptional(member)) {
+        const auto* value = memberAt<void*>(ptr);
+        ptr += sizeof(void*);
+        hash = hashWord(hash, value == nullptr ? 0 : 1);
+        return value == nullptr ? hash : hashImpl(hash, value, memberType);
+    }
+    hash = hashImpl(hash, reinterpret_cast<const void*>(ptr), memberType);  // NOLINT
+    ptr += memberType.memSize;
+    return hash;
+}
+
+static uint64_t hashStructure(uint64_t hash, const void* data, const UA_DataType& type) noexcept {
+    auto ptr = reinterpret_cast<uintptr_t>(data);  // NOLINT
+    for (size_t i = 0; i < type.membersSize; ++i) {
+        const auto& member = type.members[i];  // NOLINT
+        ptr += member.padding;
+        hash = hashMember(hash, ptr, member, getMemberType(type, member));
+    }
+    return hash;
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 1)
+static uint64_t hashUnion(uint64_t hash, const void* data, const UA_DataType& type) noexcept {
+    const auto selection = *static_cast<const UA_UInt32*>(data);
+    hash = hashWord(hash, selection);
+    if (selection == 0 || selection > type.membersSize) {
+        return hash;
+    }
+    const auto& member = type.members[selection - 1];  // NOLINT
+    auto ptr = reinterpret_cast<uintptr_t>(data) + member.padding;  // NOLINT
+    return hashMember(hash, ptr, member, getMemberType(type, member));
+}
+#endif
+
+static uint64_t hashImpl(uint64_t hash, const void* data, const UA_DataType& type) noexcept {
+    if (isPacked(type)) {
+        return hashBytes(hash, data, type.memSize);
+    }
+    switch (type.typeKind) {
+    case UA_DATATYPEKIND_STRING:
+    case UA_DATATYPEKIND_BYTESTRING:
+    case UA_DATATYPEKIND_XMLELEMENT:
+        return hashString(hash, *static_cast<const UA_String*>(data));
+    case UA_DATATYPEKIND_NODEID:
+        return hashWord(hash, UA_NodeId_hash(static_cast<const UA_NodeId*>(data)));
+    case UA_DATATYPEKIND_EXPANDEDNODEID:
+        return hashWord(
+            hash, UA_ExpandedNodeId_hash(static_cast<const UA_ExpandedNodeId*>(data))
+        );
+    case UA_DATATYPEKIND_QUALIFIEDNAME: {
+        const auto& qn = *static_cast<const UA_QualifiedName*>(data);
+        return hashString(hashWord(hash, qn.namespaceIndex), qn.name);
+    }
+    case UA_DATATYPEKIND_LOCALIZEDTEXT: {
+        const auto& lt = *static_cast<const UA_LocalizedText*>(data);
+        return hashString(hashString(hash, lt.locale), lt.text);
+    }
+    case UA_DATATYPEKIND_EXTENSIONOBJECT:
+        return hashExtensionObject(hash, *static_cast<const UA_ExtensionObject*>(data));
+    case UA_DATATYPEKIND_DATAVALUE:
+        return hashDataValue(hash, *static_cast<const UA_DataValue*>(data));
+    case UA_DATATYPEKIND_VARIANT:
+        return hashVariant(hash, *static_cast<const UA_Variant*>(data));
+    case UA_DATATYPEKIND_DIAGNOSTICINFO:
+        return hashDiagnosticInfo(hash, *static_cast<const UA_DiagnosticInfo*>(data));
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    case UA_DATATYPEKIND_UNION:
+        return hashUnion(hash, data, type);
+#endif
+    default:
+        return hashStructure(hash, data, type);
+    }
+}
+
+static uint64_t hashArrayImpl(
+    uint64_t hash, const void* data, size_t size, const UA_DataType& type
+) noexcept {
+    if (size == 0) {
+        return hash;
+    }
+    if (isPacked(type)) {
+        return hashBytes(hash, data, size * type.memSize);
+    }
+    auto ptr = reinterpret_cast<uintptr_t>(data);  // NOLINT
+    for (size_t i = 0; i < size; ++i) {
+        hash = hashImpl(hash, reinterpret_cast<const void*>(ptr), type);  // NOLINT
+        ptr += type.memSize;
+    }
+    return hash;
+}
+
+size_t hash(const void* data, const UA_DataType& type) noexcept {
+    return static_cast<size_t>(hashImpl(fnvOffsetBasis, data, type));
+}
+
+size_t hashArray(const void* data, size_t size, const UA_DataType& type) noexcept {
+    return static_cast<size_t>(hashArrayImpl(fnvOffsetBasis, data, size, type));
+}
+
+}  // namespace opcua::detail
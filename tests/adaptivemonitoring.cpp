@@ -0,0 +1,138 @@
+#include <chrono>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/adaptivemonitoring.hpp"
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("AdaptiveMonitoringController") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    SubscriptionParameters subscriptionParameters{};
+    subscriptionParameters.publishingInterval = 100.0;
+    auto sub = client.createSubscription(subscriptionParameters);
+
+    AdaptiveMonitoringOptions options;
+    options.evaluationInterval = 1000.0;
+    options.maxQueueSize = 8;
+    options.maxSamplingInterval = 1000.0;
+    AdaptiveMonitoringController controller(sub, 100.0, options);
+
+    MonitoringParametersEx parameters;
+    parameters.samplingInterval = 100.0;
+    parameters.queueSize = 1;
+    const auto item = controller.subscribeDataChange(
+        VariableId::Server_ServerStatus_BuildInfo_ProductName, AttributeId::Value, parameters, {}
+    );
+    const auto id = item.monitoredItemId();
+    REQUIRE(controller.parameters(id) != nullptr);
+    CHECK(controller.parameters(id)->queueSize == 1);
+
+    // static node, the notifications are injected manually
+    DataValue overflow;
+    overflow->hasStatus = true;
+    overflow->status = UA_STATUSCODE_GOOD | 0x00000400 | 0x00000080;  // DataValue, Overflow
+    auto now = AdaptiveMonitoringController::Clock::now();
+
+    SUBCASE("No evaluation before the interval elapsed") {
+        controller.notify(id, overflow);
+        CHECK(controller.update(now).empty());
+        CHECK(controller.metrics().overflows == 1);
+        CHECK(controller.metrics().evaluations == 0);
+    }
+
+    SUBCASE("No decision without overflows") {
+        controller.notify(id, DataValue{});
+        CHECK(controller.update(now + std::chrono::seconds(2)).empty());
+        CHECK(controller.metrics().evaluations == 1);
+        CHECK(controller.metrics().requests == 0);
+    }
+
+    SUBCASE("Grow queue, then relax sampling interval") {
+        for (int i = 0; i < 20; ++i) {
+            controller.notify(id, overflow);
+        }
+        now += std::chrono::seconds(2);
+        auto decisions = controller.update(now);
+        REQUIRE(decisions.size() == 1);
+        CHECK(decisions[0].monitoredItemId == id);
+        CHECK(decisions[0].overflows == 20);
+        CHECK(decisions[0].notificationRate >= 10.0);
+        CHECK(decisions[0].queueSize == 1);
+        CHECK(decisions[0].statusCode.isGood());
+        CHECK(decisions[0].revisedQueueSize == 2);
+        CHECK(controller.parameters(id)->queueSize == 2);
+        CHECK(controller.metrics().requests == 1);
+        CHECK(controller.metrics().modifiedItems == 1);
+
+        // queue size bound
+        for (int round = 0; round < 2; ++round) {
+            controller.notify(id, overflow);
+            now += std::chrono::seconds(2);
+            controller.update(now);
+        }
+        CHECK(controller.parameters(id)->queueSize == 8);
+
+        controller.notify(id, overflow);
+        now += std::chrono::seconds(2);
+        decisions = controller.update(now);
+        REQUIRE(decisions.size() == 1);
+        CHECK(decisions[0].revisedQueueSize == 8);
+        CHECK(decisions[0].revisedSamplingInterval == doctest::Approx(200.0));
+
+        // sampling interval bound
+        for (int round = 0; round < 3; ++round) {
+            controller.notify(id, overflow);
+            now += std::chrono::seconds(2);
+            controller.update(now);
+        }
+        CHECK(controller.parameters(id)->samplingInterval == doctest::Approx(1000.0));
+        controller.notify(id, overflow);
+        now += std::chrono::seconds(2);
+        CHECK(controller.update(now).empty());
+        CHECK(controller.metrics().saturatedItems == 1);
+    }
+
+    SUBCASE("Chunk requests") {
+        AdaptiveMonitoringOptions chunkOptions = options;
+        chunkOptions.maxItemsPerCall = 2;
+        AdaptiveMonitoringController chunked(sub, 100.0, chunkOptions);
+        for (int i = 0; i < 5; ++i) {
+            const auto monId = chunked
+                                   .subscribeDataChange(
+                                       VariableId::Server_ServerStatus_BuildInfo_ProductName,
+                                       AttributeId::Value,
+                                       parameters,
+                                       {}
+                                   )
+                                   .monitoredItemId();
+            chunked.notify(monId, overflow);
+        }
+        const auto decisions = chunked.update(now + std::chrono::seconds(2));
+        CHECK(decisions.size() == 5);
+        CHECK(chunked.metrics().requests == 3);
+        CHECK(chunked.metrics().modifiedItems == 5);
+    }
+
+    SUBCASE("Callback") {
+        int calls = 0;
+        auto callback = controller.callback([&](IntegerId, IntegerId, const DataValue&) {
+            ++calls;
+        });
+        callback(sub.subscriptionId(), id, overflow);
+        CHECK(calls == 1);
+        CHECK(controller.metrics().notifications >= 1);
+        CHECK(controller.metrics().overflows == 1);
+    }
+}
+#endif
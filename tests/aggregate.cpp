@@ -0,0 +1,226 @@
+#include <cmath>  // isnan
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/aggregate.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+using namespace opcua;
+
+TEST_CASE("AggregateCalculator") {
+    const DateTime start(UA_DATETIME_UNIX_EPOCH);
+    const auto at = [&](int64_t msec) { return DateTime(start.get() + msec * UA_DATETIME_MSEC); };
+
+    SUBCASE("isSupported") {
+        CHECK(AggregateCalculator::isSupported(ObjectId::AggregateFunction_Average));
+        CHECK(AggregateCalculator::isSupported(ObjectId::AggregateFunction_TimeAverage));
+        CHECK(AggregateCalculator::isSupported(ObjectId::AggregateFunction_Count));
+        CHECK_FALSE(AggregateCalculator::isSupported(ObjectId::AggregateFunction_Interpolative));
+        CHECK_FALSE(AggregateCalculator::isSupported(NodeId(1, 2342)));
+    }
+
+    SUBCASE("Empty interval") {
+        AggregateCalculator calc(start);
+        CHECK(calc.count() == 0);
+        const auto count = calc.result(ObjectId::AggregateFunction_Count, at(1000));
+        CHECK(count.status().isGood());
+        CHECK(count.value().to<uint32_t>() == 0);
+        const auto average = calc.result(ObjectId::AggregateFunction_Average, at(1000));
+        CHECK(average.status() == UA_STATUSCODE_BADNODATA);
+        CHECK(average.sourceTimestamp().get() == start.get());
+    }
+
+    SUBCASE("Statistics") {
+        AggregateCalculator calc(start);
+        for (double value : {2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0}) {
+            calc.add(value, start);
+        }
+        CHECK(calc.count() == 8);
+        CHECK(calc.sum() == 40.0);
+        CHECK(calc.minimum() == 2.0);
+        CHECK(calc.maximum() == 9.0);
+        CHECK(calc.average() == 5.0);
+        CHECK(calc.variancePopulation() == doctest::Approx(4.0));
+        CHECK(calc.standardDeviationPopulation() == doctest::Approx(2.0));
+        CHECK(calc.varianceSample() == doctest::Approx(32.0 / 7.0));
+
+        const auto result = calc.result(ObjectId::AggregateFunction_Maximum, at(1000));
+        CHECK(result.status().isGood());
+        CHECK(result.value().to<double>() == 9.0);
+    }
+
+    SUBCASE("Add DataValue") {
+        AggregateCalculator calc(start);
+        CHECK(calc.add(DataValue(Variant(1), at(0), {}, {}, {}, UA_STATUSCODE_GOOD)));
+        CHECK(calc.add(DataValue(Variant(2.5F), at(10), {}, {}, {}, UA_STATUSCODE_UNCERTAIN)));
+        CHECK_FALSE(calc.add(DataValue(Variant(3), at(20), {}, {}, {}, UA_STATUSCODE_BAD)));
+        CHECK_FALSE(calc.add(DataValue(Variant("text"))));
+        CHECK_FALSE(calc.add(DataValue()));
+        CHECK(calc.count() == 2);
+        CHECK(calc.sum() == 3.5);
+    }
+
+    SUBCASE("TimeAverage") {
+        AggregateCalculator calc(start);
+        CHECK_FALSE(calc.timeAverage(at(1000)).has_value());
+        calc.add(0.0, at(0));
+        calc.add(10.0, at(250));
+        // 0.0 for 250 ms, 10.0 for 750 ms
+        CHECK(calc.timeAverage(at(1000)).value() == doctest::Approx(7.5));
+
+        // last value is carried into the next interval
+        calc.reset(at(1000));
+        CHECK(calc.count() == 0);
+        calc.add(20.0, at(1500));
+        CHECK(calc.timeAverage(at(2000)).value() == doctest::Approx(15.0));
+    }
+
+    SUBCASE("Reset") {
+        AggregateCalculator calc(start);
+        calc.add(1.0, at(0));
+        calc.reset(at(1000));
+        CHECK(calc.startTime().get() == at(1000).get());
+        CHECK(calc.count() == 0);
+        CHECK(calc.sum() == 0.0);
+        calc.add(-1.0, at(1000));
+        CHECK(calc.minimum() == -1.0);
+        CHECK(calc.maximum() == -1.0);
+    }
+}
+
+TEST_CASE("DataChangeAggregator") {
+    const DateTime start(UA_DATETIME_UNIX_EPOCH);
+    const auto at = [&](int64_t msec) { return DateTime(start.get() + msec * UA_DATETIME_MSEC); };
+
+    struct Row {
+        IntegerId id;
+        uint32_t count;
+        double minimum;
+        double maximum;
+        double mean;
+        double last;
+        double downsampled;
+    };
+
+    std::vector<std::vector<Row>> batches;
+    DataChangeAggregator aggregator(
+        1000.0,
+        [&](const DataChangeAggregator& batch) {
+            CHECK(batch.endTime().get() - batch.startTime().get() == 1000 * UA_DATETIME_MSEC);
+            auto& rows = batches.emplace_back();
+            for (size_t i = 0; i < batch.size(); ++i) {
+                rows.push_back(
+                    {batch.monitoredItemIds()[i],
+                     batch.counts()[i],
+                     batch.minimums()[i],
+                     batch.maximums()[i],
+                     batch.means()[i],
+                     batch.lastValues()[i],
+                     batch.downsampledValues()[i]}
+                );
+            }
+        },
+        start
+    );
+
+    SUBCASE("No batch before interval elapsed") {
+        aggregator.add(1, 1, 1.0, at(0));
+        aggregator.advance(at(999));
+        CHECK(batches.empty());
+        CHECK(aggregator.size() == 1);
+    }
+
+    SUBCASE("Statistics") {
+        aggregator.add(1, 1, 1.0, at(0));
+        aggregator.add(1, 1, 5.0, at(100));
+        aggregator.add(1, 1, 3.0, at(200));
+        aggregator.add(1, 2, -1.0, at(300));
+        aggregator.advance(at(1000));
+        REQUIRE(batches.size() == 1);
+        REQUIRE(batches[0].size() == 2);
+        CHECK(batches[0][0].id == 1);
+        CHECK(batches[0][0].count == 3);
+        CHECK(batches[0][0].minimum == 1.0);
+        CHECK(batches[0][0].maximum == 5.0);
+        CHECK(batches[0][0].mean == 3.0);
+        CHECK(batches[0][0].last == 3.0);
+        CHECK(batches[0][1].id == 2);
+        CHECK(batches[0][1].count == 1);
+        CHECK(batches[0][1].mean == -1.0);
+        CHECK(aggregator.startTime().get() == at(1000).get());
+    }
+
+    SUBCASE("Empty intervals") {
+        aggregator.add(1, 1, 2.0, at(0));
+        aggregator.advance(at(3000));
+        REQUIRE(batches.size() == 2);  // third interval is skipped (idle)
+        CHECK(batches[1][0].count == 0);
+        CHECK(std::isnan(batches[1][0].mean));
+        CHECK(std::isnan(batches[1][0].minimum));
+        CHECK(batches[1][0].last == 2.0);  // carried over
+    }
+
+    SUBCASE("LTTB downsampling") {
+        // first interval: first point is selected
+        aggregator.add(1, 1, 0.0, at(0));
+        aggregator.add(1, 1, 1.0, at(500));
+        aggregator.advance(at(1000));
+        // second interval: the peak is selected
+        aggregator.add(1, 1, 0.0, at(1100));
+        aggregator.add(1, 1, 10.0, at(1500));
+        aggregator.add(1, 1, 0.0, at(1900));
+        aggregator.advance(at(2000));
+        aggregator.add(1, 1, 0.0, at(2500));
+        aggregator.advance(at(3000));
+        REQUIRE(batches.size() == 3);
+        CHECK(std::isnan(batches[0][0].downsampled));  // lags one interval
+        CHECK(batches[1][0].downsampled == 0.0);
+        CHECK(batches[2][0].downsampled == 10.0);
+    }
+
+    SUBCASE("Add DataValue") {
+        CHECK(aggregator.add(1, 1, DataValue(Variant(1), at(0), {}, {}, {}, UA_STATUSCODE_GOOD)));
+        CHECK_FALSE(
+            aggregator.add(1, 1, DataValue(Variant(2), at(0), {}, {}, {}, UA_STATUSCODE_BAD))
+        );
+        CHECK_FALSE(aggregator.add(1, 2, DataValue(Variant("text"))));
+        // idle intervals until the current time are skipped
+        CHECK(aggregator.startTime().get() > at(1000).get());
+    }
+
+    SUBCASE("Callback") {
+        auto callback = aggregator.callback();
+        callback(3, 7, DataValue(Variant(1.0)));
+        CHECK(aggregator.size() == 1);
+        CHECK(aggregator.subscriptionIds()[0] == 3);
+        CHECK(aggregator.monitoredItemIds()[0] == 7);
+    }
+
+    SUBCASE("Same monitored item id in different subscriptions") {
+        aggregator.add(1, 1, 1.0, at(0));
+        aggregator.add(2, 1, 2.0, at(0));
+        aggregator.removeItem(1, 1);
+        REQUIRE(aggregator.size() == 1);
+        CHECK(aggregator.subscriptionIds()[0] == 2);
+        CHECK(aggregator.monitoredItemIds()[0] == 1);
+        CHECK(aggregator.lastValues()[0] == 2.0);
+    }
+
+    SUBCASE("Remove item") {
+        aggregator.addItem(1, 1);
+        aggregator.addItem(1, 2);
+        aggregator.addItem(1, 3);
+        aggregator.removeItem(1, 1);
+        aggregator.removeItem(1, 4);
+        REQUIRE(aggregator.size() == 2);
+        aggregator.add(1, 2, 2.0, at(0));
+        aggregator.add(1, 3, 3.0, at(0));
+        aggregator.advance(at(1000));
+        REQUIRE(batches.size() == 1);
+        for (const auto& row : batches[0]) {
+            CHECK(row.mean == static_cast<double>(row.id));
+        }
+    }
+}
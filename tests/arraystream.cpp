@@ -0,0 +1,181 @@
+#include <algorithm>  // equal
+#include <cstdint>
+#include <numeric>  // iota
+#include <string>
+#include <utility>  // pair
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/arraystream.hpp"
+#include "open62541pp/client.hpp"
+#include "open62541pp/node.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+TEST_CASE("ArrayStream") {
+    constexpr size_t size = 5000;
+    std::vector<double> values(size);
+    std::iota(values.begin(), values.end(), 0.0);
+    std::vector<std::string> strings;
+    for (size_t i = 0; i < 300; ++i) {
+        strings.push_back("value-" + std::to_string(i));
+    }
+
+    Server server;
+    const NodeId knownId(1, "Known");  // with array dimensions
+    const NodeId unknownId(1, "Unknown");
+    const NodeId stringsId(1, "Strings");
+    const auto readWrite = AccessLevel::CurrentRead | AccessLevel::CurrentWrite;
+    auto objects = Node(server, ObjectId::ObjectsFolder);
+    objects.addVariable(
+        knownId,
+        "Known",
+        VariableAttributes{}
+            .setAccessLevel(readWrite)
+            .setDataType<double>()
+            .setValueRank(ValueRank::OneDimension)
+            .setArrayDimensions({static_cast<uint32_t>(size)})
+            .setValueArray(values)
+    );
+    objects.addVariable(
+        unknownId,
+        "Unknown",
+        VariableAttributes{}
+            .setAccessLevel(readWrite)
+            .setDataType<double>()
+            .setValueRank(ValueRank::OneDimension)
+            .setValueArray(values)
+    );
+    objects.addVariable(
+        stringsId,
+        "Strings",
+        VariableAttributes{}
+            .setAccessLevel(readWrite)
+            .setDataType<String>()
+            .setValueRank(ValueRank::OneDimension)
+            .setValueArray(strings)
+    );
+
+    ServerRunner runner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    ArrayStreamOptions options;
+    options.maxSliceBytes = 1024;
+    options.iterateTimeout = 10;
+    std::vector<std::pair<size_t, size_t>> progress;
+    options.onProgress = [&](size_t transferred, size_t total) {
+        progress.emplace_back(transferred, total);
+    };
+
+    SUBCASE("Size") {
+        CHECK(ArrayStream(client, knownId).size() == size);
+        CHECK(ArrayStream(client, unknownId).size() == 0);
+    }
+
+    SUBCASE("Read into buffer") {
+        ArrayStream stream(client, knownId, options);
+        std::vector<double> buffer(size);
+        const auto result = stream.readInto(Span<double>(buffer));
+        CHECK(result.status.isGood());
+        CHECK(result.end == size);
+        CHECK(buffer == values);
+        CHECK(progress.size() > 1);  // multiple slices
+        CHECK(progress.back() == std::pair<size_t, size_t>(size, size));
+    }
+
+    SUBCASE("Read into buffer of different type") {
+        ArrayStream stream(client, knownId, options);
+        std::vector<int32_t> buffer(size);
+        const auto result = stream.readInto(Span<int32_t>(buffer));
+        CHECK(result.status == UA_STATUSCODE_BADTYPEMISMATCH);
+        CHECK(result.end == 0);
+    }
+
+    SUBCASE("Read chunks in sequence with unknown size") {
+        ArrayStream stream(client, unknownId, options);
+        std::vector<double> collected;
+        const auto result = stream.read([&](size_t offset, Variant& chunk) {
+            CHECK(offset == collected.size());
+            const auto elements = chunk.to<std::vector<double>>();
+            collected.insert(collected.end(), elements.begin(), elements.end());
+        });
+        CHECK(result.status.isGood());
+        CHECK(result.end == size);
+        CHECK(collected == values);
+        CHECK(progress.back() == std::pair<size_t, size_t>(size, 0));
+    }
+
+    SUBCASE("Read variable-size elements") {
+        ArrayStream stream(client, stringsId, options);
+        std::vector<std::string> collected;
+        const auto result = stream.read([&](size_t, Variant& chunk) {
+            const auto elements = chunk.to<std::vector<std::string>>();
+            collected.insert(collected.end(), elements.begin(), elements.end());
+        });
+        CHECK(result.status.isGood());
+        CHECK(collected == strings);
+        CHECK(progress.size() > 1);
+    }
+
+    SUBCASE("Resume read from offset") {
+        ArrayStream stream(client, knownId, options);
+        std::vector<double> buffer(size);
+        const auto result = stream.readInto(Span<double>(buffer), 1000);
+        CHECK(result.status.isGood());
+        CHECK(result.end == size);
+        CHECK(buffer[999] == 0.0);
+        CHECK(std::equal(buffer.begin() + 1000, buffer.end(), values.begin() + 1000));
+    }
+
+    SUBCASE("Resume read after connection loss") {
+        bool disconnected = false;
+        options.onProgress = [&](size_t transferred, size_t) {
+            if (transferred >= 1000 && !disconnected) {
+                disconnected = true;
+                client.disconnect();
+            }
+        };
+        ArrayStream stream(client, knownId, options);
+        std::vector<double> buffer(size);
+        auto result = stream.readInto(Span<double>(buffer));
+        CHECK(result.status.isBad());
+        CHECK(result.end >= 1000);
+        CHECK(result.end < size);
+
+        client.connect("opc.tcp://localhost:4840");
+        result = stream.readInto(Span<double>(buffer), result.end);
+        CHECK(result.status.isGood());
+        CHECK(result.end == size);
+        CHECK(buffer == values);
+    }
+
+    SUBCASE("Write") {
+        ArrayStream stream(client, knownId, options);
+        std::vector<double> data(values.rbegin(), values.rend());
+        const auto result = stream.write(Span<const double>(data));
+        CHECK(result.status.isGood());
+        CHECK(result.end == size);
+        CHECK(progress.size() > 1);
+        CHECK(services::readValue(client, knownId).value().to<std::vector<double>>() == data);
+    }
+
+    SUBCASE("Write variable-size elements") {
+        ArrayStream stream(client, stringsId, options);
+        std::vector<String> data;
+        for (size_t i = 0; i < strings.size(); ++i) {
+            data.emplace_back("written-" + std::to_string(i));
+        }
+        const auto result = stream.write(Span<const String>(data));
+        CHECK(result.status.isGood());
+        CHECK(result.end == strings.size());
+        CHECK(progress.size() > 1);
+        CHECK(services::readValue(client, stringsId).value().to<std::vector<String>>() == data);
+    }
+}
@@ -0,0 +1,115 @@
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/discovery.hpp"
+#include "open62541pp/server.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+TEST_CASE("Discovery of many servers") {
+    Server server1(4841);
+    Server server2(4842);
+    ServerRunner serverRunner1(server1);
+    ServerRunner serverRunner2(server2);
+
+    const std::vector<std::string> serverUrls{
+        "opc.tcp://localhost:4841",
+        "opc.tcp://localhost:4842",
+        "opc.tcp://localhost:4849",  // no server
+    };
+
+    DiscoveryOptions options;
+    options.maxConcurrency = 2;
+    options.timeout = 1000;
+
+    auto checkResults = [&](const std::vector<DiscoveryResult>& results) {
+        REQUIRE(results.size() == 3);
+        for (size_t i = 0; i < results.size(); ++i) {
+            CHECK(results[i].serverUrl == serverUrls[i]);
+        }
+        CHECK(results[0].status.isGood());
+        CHECK(results[0].servers.size() == 1);
+        CHECK(results[0].endpoints.size() == 1);
+        CHECK(results[1].status.isGood());
+        CHECK(results[1].servers.size() == 1);
+        CHECK(results[2].status.isBad());
+        CHECK(results[2].servers.empty());
+        CHECK(results[2].endpoints.empty());
+    };
+
+    SUBCASE("discover") {
+        checkResults(discover(serverUrls, options));
+    }
+
+    SUBCASE("discover without FindServers") {
+        options.findServers = false;
+        const auto results = discover(serverUrls, options);
+        CHECK(results[0].servers.empty());
+        CHECK(results[0].endpoints.size() == 1);
+    }
+
+    SUBCASE("discoverAsync") {
+        auto future = discoverAsync(serverUrls, options);
+        checkResults(future.get());
+    }
+
+    SUBCASE("Empty") {
+        CHECK(discover({}).empty());
+    }
+}
+
+TEST_CASE("Connect many clients") {
+    Server server;
+    ServerRunner serverRunner(server);
+
+    constexpr size_t count = 10;
+    std::vector<std::unique_ptr<Client>> clients;
+    std::vector<Client*> clientPtrs;
+    for (size_t i = 0; i < count; ++i) {
+        clientPtrs.push_back(clients.emplace_back(std::make_unique<Client>()).get());
+    }
+
+    ConnectOptions options;
+    options.maxConcurrency = 4;
+    options.timeout = std::chrono::milliseconds(1000);
+    options.initialBackoff = std::chrono::milliseconds(1);
+
+    SUBCASE("Single endpoint URL") {
+        const auto results = connectClients(
+            clientPtrs, std::vector<std::string>{"opc.tcp://localhost:4840"}, options
+        );
+        REQUIRE(results.size() == count);
+        for (size_t i = 0; i < count; ++i) {
+            CHECK(results[i].isGood());
+            CHECK(clients[i]->isConnected());
+        }
+    }
+
+    SUBCASE("Unreachable endpoints are retried until max attempts") {
+        options.maxAttempts = 3;
+        const std::vector<Client*> subset(clientPtrs.begin(), clientPtrs.begin() + 2);
+        const std::vector<std::string> endpointUrls{
+            "opc.tcp://localhost:4840", "opc.tcp://localhost:4849"
+        };
+        const auto results = connectClients(subset, endpointUrls, options);
+        REQUIRE(results.size() == 2);
+        CHECK(results[0].isGood());
+        CHECK(results[1].isBad());
+        CHECK_FALSE(clients[1]->isConnected());
+    }
+
+    SUBCASE("Invalid number of endpoint URLs") {
+        CHECK_THROWS_AS(
+            connectClients(clientPtrs, std::vector<std::string>{"a", "b"}, options),
+            std::invalid_argument
+        );
+    }
+}
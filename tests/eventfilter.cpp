@@ -0,0 +1,239 @@
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/eventfilter.hpp"
+#include "open62541pp/types.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+#include "open62541pp/ua/types.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+static SimpleAttributeOperand field(std::string_view name) {
+    return {ObjectTypeId::BaseEventType, {{0, name}}, AttributeId::Value};
+}
+
+template <typename T>
+static ContentFilterElement condition(
+    FilterOperator filterOperator, std::string_view name, const T& literal
+) {
+    return {filterOperator, {field(name), LiteralOperand(literal)}};
+}
+
+TEST_CASE("EventFilterEvaluator") {
+    const std::vector<SimpleAttributeOperand> selectClauses{
+        field("Severity"), field("Message"), field("EventType")
+    };
+    const std::vector<Variant> fields{
+        Variant(uint16_t{500}),
+        Variant(LocalizedText("", "Temperature high")),
+        Variant(NodeId(ObjectTypeId::SystemEventType)),
+    };
+    auto evaluate = [&](const ContentFilter& whereClause) {
+        return EventFilterEvaluator(EventFilter(selectClauses, whereClause)).evaluate(fields);
+    };
+
+    SUBCASE("Empty where clause") {
+        CHECK(EventFilterEvaluator().evaluate(fields));
+        CHECK(evaluate(ContentFilter{}));
+    }
+
+    SUBCASE("Comparison") {
+        // numeric values are compared independent of the data type
+        CHECK(evaluate({condition(FilterOperator::Equals, "Severity", 500)}));
+        CHECK(evaluate({condition(FilterOperator::Equals, "Severity", 500.0)}));
+        CHECK_FALSE(evaluate({condition(FilterOperator::Equals, "Severity", 499)}));
+        CHECK(evaluate({condition(FilterOperator::GreaterThan, "Severity", 200)}));
+        CHECK_FALSE(evaluate({condition(FilterOperator::GreaterThan, "Severity", 500)}));
+        CHECK(evaluate({condition(FilterOperator::GreaterThanOrEqual, "Severity", 500)}));
+        CHECK(evaluate({condition(FilterOperator::LessThan, "Severity", 1000)}));
+        CHECK(evaluate({condition(FilterOperator::LessThanOrEqual, "Severity", 500)}));
+        // strings
+        CHECK(evaluate({condition(FilterOperator::Equals, "Message", "Temperature high")}));
+        // not comparable
+        CHECK_FALSE(evaluate({condition(FilterOperator::Equals, "Message", 500)}));
+        CHECK_FALSE(evaluate({condition(FilterOperator::LessThan, "Message", 500)}));
+    }
+
+    SUBCASE("Between") {
+        const ContentFilter whereClause{
+            {FilterOperator::Between, {field("Severity"), LiteralOperand(100), LiteralOperand(500)}}
+        };
+        CHECK(evaluate(whereClause));
+        const ContentFilter whereClauseOutside{
+            {FilterOperator::Between, {field("Severity"), LiteralOperand(600), LiteralOperand(900)}}
+        };
+        CHECK_FALSE(evaluate(whereClauseOutside));
+    }
+
+    SUBCASE("InList") {
+        const ContentFilter whereClause{
+            {FilterOperator::InList,
+             {field("Severity"), LiteralOperand(100), LiteralOperand(500), LiteralOperand(900)}}
+        };
+        CHECK(evaluate(whereClause));
+        const ContentFilter whereClauseMissing{
+            {FilterOperator::InList, {field("Severity"), LiteralOperand(100)}}
+        };
+        CHECK_FALSE(evaluate(whereClauseMissing));
+    }
+
+    SUBCASE("Like") {
+        CHECK(evaluate({condition(FilterOperator::Like, "Message", "Temperature%")}));
+        CHECK(evaluate({condition(FilterOperator::Like, "Message", "%high")}));
+        CHECK(evaluate({condition(FilterOperator::Like, "Message", "%ture%")}));
+        CHECK(evaluate({condition(FilterOperator::Like, "Message", "_emperature high")}));
+        CHECK(evaluate({condition(FilterOperator::Like, "Message", "[A-Z]emperature%")}));
+        CHECK(evaluate({condition(FilterOperator::Like, "Message", "[^a-z]emperature%")}));
+        CHECK_FALSE(evaluate({condition(FilterOperator::Like, "Message", "[^A-Z]emperature%")}));
+        CHECK_FALSE(evaluate({condition(FilterOperator::Like, "Message", "Temperature")}));
+        CHECK_FALSE(evaluate({condition(FilterOperator::Like, "Message", "%low")}));
+        CHECK_FALSE(evaluate({condition(FilterOperator::Like, "Severity", "%")}));
+    }
+
+    SUBCASE("Logical operators") {
+        const auto severityHigh = condition(FilterOperator::GreaterThan, "Severity", 200);
+        const auto severityLow = condition(FilterOperator::LessThan, "Severity", 100);
+        CHECK(evaluate(!severityLow));
+        CHECK_FALSE(evaluate(!severityHigh));
+        CHECK(evaluate(severityHigh && !severityLow));
+        CHECK_FALSE(evaluate(severityHigh && severityLow));
+        CHECK(evaluate(severityLow || severityHigh));
+        CHECK_FALSE(evaluate(severityLow || !severityHigh));
+    }
+
+    SUBCASE("IsNull") {
+        CHECK_FALSE(evaluate({{FilterOperator::IsNull, {field("Severity")}}}));
+        // missing event fields are null
+        const EventFilterEvaluator evaluator(
+            EventFilter(selectClauses, {{FilterOperator::IsNull, {field("Severity")}}})
+        );
+        CHECK(evaluator.evaluate({}));
+    }
+
+    SUBCASE("OfType") {
+        auto ofType = [](const NodeId& eventType) {
+            return ContentFilter{{FilterOperator::OfType, {LiteralOperand(eventType)}}};
+        };
+        CHECK(evaluate(ofType(ObjectTypeId::BaseEventType)));
+        CHECK(evaluate(ofType(ObjectTypeId::SystemEventType)));
+        CHECK_FALSE(evaluate(ofType(ObjectTypeId::AuditEventType)));
+    }
+
+    SUBCASE("Append missing select clauses") {
+        const EventFilterEvaluator evaluator(
+            EventFilter({field("Message")}, {condition(FilterOperator::Equals, "Severity", 500)})
+        );
+        REQUIRE(evaluator.filter().selectClauses().size() == 2);
+        CHECK(
+            evaluator.filter().selectClauses()[1].browsePath()[0] == QualifiedName(0, "Severity")
+        );
+        CHECK(evaluator.evaluate(std::vector<Variant>{Variant("Message"), Variant(500)}));
+        CHECK_FALSE(evaluator.evaluate(std::vector<Variant>{Variant("Message"), Variant(100)}));
+    }
+
+    SUBCASE("Invalid filters") {
+        auto compile = [&](const ContentFilter& whereClause) {
+            EventFilterEvaluator evaluator(EventFilter(selectClauses, whereClause));
+        };
+        CHECK_THROWS_WITH_AS(
+            compile({{FilterOperator::Cast, {field("Severity"), LiteralOperand(1)}}}),
+            "BadFilterOperatorUnsupported",
+            BadStatus
+        );
+        CHECK_THROWS_WITH_AS(
+            compile({{FilterOperator::Equals, {field("Severity")}}}),
+            "BadFilterOperandCountMismatch",
+            BadStatus
+        );
+        // backward reference
+        CHECK_THROWS_WITH_AS(
+            compile({{FilterOperator::Not, {ElementOperand(0)}}}),
+            "BadFilterOperandInvalid",
+            BadStatus
+        );
+    }
+}
+
+TEST_CASE("EventFilterBuilder") {
+    struct MyEvent {
+        DateTime time;
+        uint16_t severity{};
+        std::string_view message;
+        std::optional<double> value;
+    };
+
+    const auto decoder = EventFilterBuilder<MyEvent>()
+                             .select({0, "Time"}, &MyEvent::time)
+                             .select({0, "Severity"}, &MyEvent::severity)
+                             .select({0, "Message"}, &MyEvent::message)
+                             .select({1, "Value"}, &MyEvent::value)
+                             .where({condition(FilterOperator::GreaterThan, "Severity", 200)})
+                             .build();
+
+    CHECK(decoder.filter().selectClauses().size() == 4);
+    CHECK(decoder.filter().whereClause().elements().size() == 1);
+
+    const DateTime time = DateTime::now();
+    std::vector<Variant> fields{
+        Variant(time),
+        Variant(uint16_t{500}),
+        Variant(LocalizedText("", "Message")),
+        Variant(11.1),
+    };
+
+    SUBCASE("Decode") {
+        MyEvent event{};
+        CHECK(decoder.decode(fields, event));
+        CHECK(event.time.get() == time.get());
+        CHECK(event.severity == 500);
+        CHECK(event.message == "Message");
+        // zero-copy
+        const auto* text = static_cast<const LocalizedText*>(fields[2].data());
+        CHECK(event.message.data() == text->text().data());
+        CHECK(event.value == 11.1);
+    }
+
+    SUBCASE("Decode empty optional") {
+        fields[3] = Variant();
+        MyEvent event{};
+        event.value = 1.0;
+        CHECK(decoder.decode(fields, event));
+        CHECK_FALSE(event.value.has_value());
+    }
+
+    SUBCASE("Decode with mismatching type") {
+        fields[1] = Variant("500");
+        MyEvent event{};
+        CHECK_FALSE(decoder.decode(fields, event));
+    }
+
+    SUBCASE("Decode with missing fields") {
+        MyEvent event{};
+        CHECK_FALSE(decoder.decode(Span<const Variant>(fields).subview(0, 2), event));
+    }
+
+    SUBCASE("Callback") {
+        std::vector<uint16_t> severities;
+        auto callback = decoder.callback(
+            [&](IntegerId, IntegerId, const MyEvent& event) {
+                severities.push_back(event.severity);
+            },
+            true
+        );
+        callback(1, 1, fields);
+        fields[1] = Variant(uint16_t{100});  // dropped by where clause
+        callback(1, 1, fields);
+        fields[1] = Variant(500);  // dropped by mismatching type (Int32)
+        callback(1, 1, fields);
+        REQUIRE(severities.size() == 1);
+        CHECK(severities[0] == 500);
+    }
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include <exception>
 #include <stdexcept>
+#include <thread>
 
 #include <doctest/doctest.h>
 
@@ -43,4 +44,11 @@ TEST_CASE("ExceptionCatcher") {
         CHECK(catcher.hasException());
         CHECK_THROWS_WITH_AS(catcher.rethrow(), "Error", std::runtime_error);
     }
+
+    SUBCASE("Exceptions of other threads are rethrown by the main loop") {
+        std::thread([&] { catcher.invoke([] { throw std::runtime_error("Thread"); }); }).join();
+        CHECK(catcher.hasException());
+        CHECK_THROWS_WITH_AS(catcher.rethrow(), "Thread", std::runtime_error);
+        CHECK_FALSE(catcher.hasException());
+    }
 }
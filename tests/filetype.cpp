@@ -0,0 +1,192 @@
+#include <cstdint>
+#include <cstdio>  // remove
+#include <fstream>
+#include <iterator>  // istreambuf_iterator
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/filetype.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/method.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_METHODCALLS
+static std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+TEST_CASE("FileType") {
+    const std::string path = "open62541pp_filetype.bin";
+    std::vector<uint8_t> content(100000);
+    for (size_t i = 0; i < content.size(); ++i) {
+        content[i] = static_cast<uint8_t>((i * 7) % 251);
+    }
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(content.data()), content.size());  // NOLINT
+    }
+
+    Server server;
+    const NodeId fileId(1, "File");
+    const NodeId readOnlyId(1, "ReadOnly");
+    addFileObject(server, ObjectId::ObjectsFolder, fileId, "File", path);
+    addFileObject(server, ObjectId::ObjectsFolder, readOnlyId, "ReadOnly", path, false);
+
+    ServerRunner runner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    FileTypeClientOptions options;
+    options.chunkSize = 4096;
+    options.iterateTimeout = 10;
+
+    SUBCASE("Size") {
+        FileTypeClient file(client, fileId, options);
+        CHECK(file.size() == content.size());
+    }
+
+    SUBCASE("Read pipelined") {
+        for (const size_t maxPendingRequests : {1, 4, 16}) {
+            options.maxPendingRequests = maxPendingRequests;
+            FileTypeClient file(client, fileId, options);
+            file.open(OpenFileMode::Read);
+            std::vector<uint8_t> received;
+            const auto bytes = file.read([&](Span<const uint8_t> data) {
+                received.insert(received.end(), data.begin(), data.end());
+            });
+            CHECK(bytes == content.size());
+            CHECK(received == content);
+            CHECK(file.position() == content.size());
+            file.close();
+        }
+    }
+
+    SUBCASE("Read into stream") {
+        FileTypeClient file(client, fileId, options);
+        file.open(OpenFileMode::Read);
+        std::ostringstream stream;
+        CHECK(file.read(stream) == content.size());
+        CHECK(stream.str() == readFile(path));
+    }
+
+    SUBCASE("Position") {
+        FileTypeClient file(client, fileId, options);
+        file.open(OpenFileMode::Read);
+        CHECK(file.position() == 0);
+        file.setPosition(1000);
+        CHECK(file.position() == 1000);
+        std::vector<uint8_t> received;
+        file.read([&](Span<const uint8_t> data) {
+            received.insert(received.end(), data.begin(), data.end());
+        });
+        CHECK(received == std::vector<uint8_t>(content.begin() + 1000, content.end()));
+        file.setPosition(content.size() + 10);
+        CHECK(file.position() == content.size());  // clamped to the end of the file
+    }
+
+    SUBCASE("Write") {
+        std::vector<uint8_t> data(content.rbegin(), content.rend());
+        FileTypeClient file(client, fileId, options);
+        file.open(OpenFileMode::Write | OpenFileMode::EraseExisting);
+        CHECK(file.write(Span<const uint8_t>(data)) == data.size());
+        CHECK(file.position() == data.size());
+        file.close();
+        CHECK(file.size() == data.size());
+        CHECK(readFile(path) == std::string(data.begin(), data.end()));
+    }
+
+    SUBCASE("Write from stream and read back") {
+        FileTypeClient file(client, fileId, options);
+        file.open(OpenFileMode::Read | OpenFileMode::Write | OpenFileMode::EraseExisting);
+        std::istringstream input("Hello FileType");
+        CHECK(file.write(input) == 14);
+        file.setPosition(6);
+        std::ostringstream output;
+        CHECK(file.read(output) == 8);
+        CHECK(output.str() == "FileType");
+    }
+
+    SUBCASE("Append") {
+        FileTypeClient file(client, fileId, options);
+        file.open(OpenFileMode::Write | OpenFileMode::Append);
+        CHECK(file.position() == content.size());
+        file.write(Span<const uint8_t>(content.data(), 10));
+        file.close();
+        CHECK(file.size() == content.size() + 10);
+    }
+
+    SUBCASE("Multiple readers, exclusive writer") {
+        FileTypeClient reader1(client, fileId, options);
+        FileTypeClient reader2(client, fileId, options);
+        FileTypeClient writer(client, fileId, options);
+        reader1.open(OpenFileMode::Read);
+        reader2.open(OpenFileMode::Read);
+        CHECK_THROWS_WITH_AS(writer.open(OpenFileMode::Write), "BadInvalidState", BadStatus);
+        reader1.close();
+        reader2.close();
+        writer.open(OpenFileMode::Write);
+        CHECK_THROWS_WITH_AS(reader1.open(OpenFileMode::Read), "BadInvalidState", BadStatus);
+    }
+
+    SUBCASE("Invalid usage") {
+        FileTypeClient file(client, fileId, options);
+        CHECK_FALSE(file.isOpen());
+        CHECK_THROWS_WITH_AS(file.position(), "BadInvalidState", BadStatus);
+        CHECK_THROWS_WITH_AS(file.open(OpenFileMode::Append), "BadInvalidArgument", BadStatus);
+        file.open(OpenFileMode::Read);
+        CHECK(file.isOpen());
+        CHECK_THROWS_WITH_AS(file.open(OpenFileMode::Read), "BadInvalidState", BadStatus);
+        CHECK_THROWS_WITH_AS(
+            file.write(Span<const uint8_t>(content)), "BadInvalidState", BadStatus
+        );
+    }
+
+    SUBCASE("Not writable") {
+        FileTypeClient file(client, readOnlyId, options);
+        CHECK_THROWS_WITH_AS(file.open(OpenFileMode::Write), "BadNotWritable", BadStatus);
+        file.open(OpenFileMode::Read);
+        std::ostringstream stream;
+        CHECK(file.read(stream) == content.size());
+    }
+
+    SUBCASE("Handles are bound to the session") {
+        Client other;
+        other.connect("opc.tcp://localhost:4840");
+        const NodeId openId(1, "ns=1;s=File/Open");
+        const NodeId getPositionId(1, "ns=1;s=File/GetPosition");
+        const auto opened = services::call(
+            other, fileId, openId, Span<const Variant>{Variant(uint8_t{2})}  // Write
+        );
+        REQUIRE(opened.statusCode().isGood());
+        const Variant handle = opened.outputArguments().at(0);
+
+        FileTypeClient file(client, fileId, options);
+        CHECK(file.size() == content.size());
+        const auto position = services::call(
+            client, fileId, getPositionId, Span<const Variant>{handle}
+        );
+        CHECK(position.statusCode() == UA_STATUSCODE_BADINVALIDARGUMENT);
+
+        // the handle with exclusive write access is released with the session
+        other.disconnect();
+        file.open(OpenFileMode::Read);
+        CHECK(file.isOpen());
+    }
+
+    SUBCASE("Missing FileType methods") {
+        CHECK_THROWS_AS(FileTypeClient(client, ObjectId::ObjectsFolder), BadStatus);
+    }
+
+    std::remove(path.c_str());
+}
+#endif
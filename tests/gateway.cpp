@@ -0,0 +1,213 @@
+#include <chrono>
+#include <future>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/gateway.hpp"
+#include "open62541pp/node.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/services/method.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("GatewayMount") {
+    Server downstream(4841);
+    Server gateway(4842);
+
+    // downstream address space:
+    // Device
+    // ├── Temperature
+    // ├── Status (read-only)
+    // ├── Add (method)
+    // └── Sub
+    //     └── Deep
+    const NodeId deviceId(1, "Device");
+    const NodeId temperatureId(1, "Temperature");
+    const NodeId statusId(1, "Status");
+    const NodeId addId(1, "Add");
+    const NodeId subId(1, "Sub");
+    const NodeId deepId(1, "Deep");
+    const auto readWrite = AccessLevel::CurrentRead | AccessLevel::CurrentWrite;
+    auto device = Node(downstream, ObjectId::ObjectsFolder).addObject(deviceId, "Device");
+    device.addVariable(
+        temperatureId,
+        "Temperature",
+        VariableAttributes{}
+            .setAccessLevel(readWrite)
+            .setDataType<double>()
+            .setValueScalar(20.5)
+    );
+    device.addMethod(
+        addId,
+        "Add",
+        [](Span<const Variant> inputs, Span<Variant> outputs) {
+            outputs.at(0) = inputs.at(0).scalar<int32_t>() + inputs.at(1).scalar<int32_t>();
+        },
+        {
+            Argument("a", {"en-US", "first number"}, DataTypeId::Int32, ValueRank::Scalar),
+            Argument("b", {"en-US", "second number"}, DataTypeId::Int32, ValueRank::Scalar),
+        },
+        {
+            Argument("sum", {"en-US", "sum of both numbers"}, DataTypeId::Int32, ValueRank::Scalar),
+        }
+    );
+    device.addVariable(
+        statusId,
+        "Status",
+        VariableAttributes{}
+            .setAccessLevel(AccessLevel::CurrentRead)
+            .setDataType<int32_t>()
+            .setValueScalar(int32_t{1})
+    );
+    device.addObject(subId, "Sub")
+        .addVariable(
+            deepId,
+            "Deep",
+            VariableAttributes{}
+                .setAccessLevel(readWrite)
+                .setDataType<int32_t>()
+                .setValueScalar(int32_t{11})
+        );
+
+    ServerRunner downstreamRunner(downstream);
+    Client client;
+    client.connect("opc.tcp://localhost:4841");
+
+    GatewayOptions options;
+    options.samplingInterval = 10.0;
+    options.subscriptionParameters.publishingInterval = 10.0;
+    GatewayMount mount(gateway, client, "PLC1", deviceId, ObjectId::ObjectsFolder, options);
+
+    auto runUntil = [&](auto&& predicate) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+            mount.runIterate(10);
+        }
+        return predicate();
+    };
+
+    auto runUntilDispatched = [&](auto&& predicate) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+            mount.dispatch();
+        }
+        return predicate();
+    };
+
+    auto readGateway = [&](const NodeId& remoteId) {
+        return services::readValue(gateway, mount.localId(remoteId));
+    };
+
+    SUBCASE("Mount") {
+        CHECK(mount.mountId() == mount.localId(deviceId));
+        CHECK(mount.remoteId(mount.mountId()) == deviceId);
+        CHECK(mount.remoteId(mount.localId(temperatureId)) == temperatureId);
+        CHECK(mount.remoteId(mount.localId(addId)) == addId);
+        CHECK(mount.remoteId(mount.localId(subId)) == subId);
+        CHECK_FALSE(mount.remoteId(mount.localId(deepId)).has_value());  // maxDepth = 1
+        CHECK(mount.statistics().mountedNodes == 4);
+        CHECK(Node(gateway, mount.localId(addId)).readNodeClass() == NodeClass::Method);
+    }
+
+    SUBCASE("Mirror variable attributes") {
+        Node temperature(gateway, mount.localId(temperatureId));
+        CHECK(temperature.readDataType() == NodeId(DataTypeId::Double));
+        CHECK(temperature.readValueRank() == ValueRank::Scalar);
+        CHECK(temperature.readAccessLevel() == readWrite);
+        Node status(gateway, mount.localId(statusId));
+        CHECK(status.readDataType() == NodeId(DataTypeId::Int32));
+        CHECK(status.readAccessLevel() == AccessLevel::CurrentRead);
+    }
+
+    SUBCASE("Expand") {
+        CHECK_THROWS_AS(mount.expand(NodeId(1, "Unknown")), BadStatus);
+        CHECK(mount.expand(mount.localId(subId)) == 1);
+        CHECK(mount.expand(mount.localId(subId)) == 0);  // already expanded
+        CHECK(mount.remoteId(mount.localId(deepId)) == deepId);
+        CHECK(mount.statistics().mountedNodes == 5);
+        REQUIRE(runUntil([&] {
+            const auto value = readGateway(deepId);
+            return value && value->scalar<int32_t>() == 11;
+        }));
+    }
+
+    SUBCASE("Read from cache") {
+        REQUIRE(runUntil([&] { return mount.statistics().notifications > 0; }));
+        const auto value = readGateway(temperatureId);
+        REQUIRE(value);
+        CHECK(value->scalar<double>() == 20.5);
+
+        REQUIRE(services::writeValue(downstream, temperatureId, Variant(21.0)).isGood());
+        CHECK(runUntil([&] {
+            const auto result = readGateway(temperatureId);
+            return result && result->scalar<double>() == 21.0;
+        }));
+        CHECK(mount.statistics().reads > 0);
+    }
+
+    SUBCASE("Forward writes") {
+        auto future = std::async(std::launch::async, [&] {
+            return services::writeValue(gateway, mount.localId(temperatureId), Variant(42.0));
+        });
+        REQUIRE(runUntil([&] {
+            return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }));
+        CHECK(future.get().isGood());  // result of the downstream server
+        CHECK(mount.statistics().forwardedWrites == 1);
+        const auto result = services::readValue(client, temperatureId);
+        CHECK(result->scalar<double>() == 42.0);
+        CHECK(mount.statistics().failedWrites == 0);
+    }
+
+    SUBCASE("Forward method calls") {
+        auto future = std::async(std::launch::async, [&] {
+            return services::call(
+                gateway,
+                mount.mountId(),
+                mount.localId(addId),
+                Span<const Variant>{Variant(int32_t{1}), Variant(int32_t{2})}
+            );
+        });
+        REQUIRE(runUntil([&] {
+            return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }));
+        const auto result = future.get();
+        CHECK(result.statusCode().isGood());
+        REQUIRE(result.outputArguments().size() == 1);
+        CHECK(result.outputArguments().at(0).scalar<int32_t>() == 3);
+        CHECK(mount.statistics().forwardedCalls == 1);
+        CHECK(mount.statistics().failedCalls == 0);
+    }
+
+    SUBCASE("Fail forwarded requests if the downstream client is disconnected") {
+        client.disconnect();
+        auto write = std::async(std::launch::async, [&] {
+            return services::writeValue(gateway, mount.localId(temperatureId), Variant(42.0));
+        });
+        auto future = std::async(std::launch::async, [&] {
+            return services::call(
+                gateway,
+                mount.mountId(),
+                mount.localId(addId),
+                Span<const Variant>{Variant(int32_t{1}), Variant(int32_t{2})}
+            );
+        });
+        // answered on dispatch instead of waiting for the call timeout
+        REQUIRE(runUntilDispatched([&] {
+            return write.wait_for(std::chrono::seconds(0)) == std::future_status::ready &&
+                future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }));
+        CHECK(write.get() == UA_STATUSCODE_BADCOMMUNICATIONERROR);
+        CHECK(future.get().statusCode().isBad());
+        CHECK(mount.statistics().failedWrites == 1);
+        CHECK(mount.statistics().failedCalls == 1);
+    }
+}
+#endif
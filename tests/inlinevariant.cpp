@@ -0,0 +1,100 @@
+#include <string>
+#include <utility>  // move
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/inlinevariant.hpp"
+
+using namespace opcua;
+
+TEST_CASE("InlineVariant") {
+    SUBCASE("Empty") {
+        InlineVariant var;
+        CHECK(var.empty());
+        CHECK_FALSE(var.isInline());
+        CHECK(var.variant().empty());
+    }
+
+    SUBCASE("Pointer-free scalar is stored inline") {
+        InlineVariant var(11.11);
+        CHECK(var.isInline());
+        CHECK(var.variant().isScalar());
+        CHECK(var.variant()->storageType == UA_VARIANT_DATA_NODELETE);
+        CHECK(var.to<double>() == 11.11);
+
+        var = int32_t{5};
+        CHECK(var.isInline());
+        CHECK(var.variant().isType<int32_t>());
+        CHECK(var.to<int32_t>() == 5);
+
+        var = Guid::random();
+        CHECK(var.isInline());
+    }
+
+    SUBCASE("Other values are stored on the heap") {
+        InlineVariant var(std::string("test"));
+        CHECK_FALSE(var.isInline());
+        CHECK(var.to<std::string>() == "test");
+
+        var = std::vector<int>{1, 2, 3};
+        CHECK_FALSE(var.isInline());
+        CHECK(var.to<std::vector<int>>() == std::vector<int>{1, 2, 3});
+
+        var = 1.0;
+        CHECK(var.isInline());
+    }
+
+    SUBCASE("Assign Variant") {
+        InlineVariant var;
+        var.assign(Variant(1.0F));
+        CHECK(var.isInline());
+        CHECK(var.to<float>() == 1.0F);
+        var.assign(Variant("text"));
+        CHECK_FALSE(var.isInline());
+        var.assign(var.variant());  // self-assignment
+        CHECK(var.to<std::string>() == "text");
+    }
+
+    SUBCASE("Copy") {
+        InlineVariant var(5);
+        InlineVariant copy(var);
+        CHECK(copy.isInline());
+        CHECK(copy.variant().data() != var.variant().data());
+        CHECK(copy.to<int>() == 5);
+    }
+
+    SUBCASE("Move") {
+        InlineVariant var(5);
+        InlineVariant moved(std::move(var));
+        CHECK(moved.isInline());
+        CHECK(moved.to<int>() == 5);
+        CHECK(var.empty());  // NOLINT(bugprone-use-after-move)
+
+        InlineVariant heap(std::string("test"));
+        const void* data = heap.variant().data();
+        moved = std::move(heap);
+        CHECK(moved.variant().data() == data);
+        CHECK(moved.to<std::string>() == "test");
+    }
+
+    SUBCASE("Vector") {
+        std::vector<InlineVariant> values;
+        for (int i = 0; i < 100; ++i) {
+            values.emplace_back(i);  // reallocation moves the elements
+        }
+        for (int i = 0; i < 100; ++i) {
+            CHECK(values[i].isInline());
+            CHECK(values[i].to<int>() == i);
+        }
+    }
+
+    SUBCASE("Owning copy") {
+        InlineVariant var(5);
+        const Variant copy = var.toVariant();
+        CHECK(copy->storageType == UA_VARIANT_DATA);
+        CHECK(copy.to<int>() == 5);
+        const Variant& view = var;
+        CHECK(view.data() == var.variant().data());
+    }
+}
@@ -0,0 +1,131 @@
+#include <cmath>  // NAN
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/config.hpp"
+#include "open62541pp/limitalarm.hpp"
+#include "open62541pp/server.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+TEST_CASE("LimitAlarmEngine") {
+    Server server;
+    LimitAlarmEngine engine(server);
+
+    using Transition = std::tuple<size_t, LimitState, LimitState>;
+    std::vector<Transition> transitions;
+    engine.setTransitionCallback([&](size_t alarm, LimitState from, LimitState to, double) {
+        transitions.emplace_back(alarm, from, to);
+    });
+
+    LimitAlarmLimits limits;
+    limits.highHigh = 100.0;
+    limits.high = 80.0;
+    limits.low = 20.0;
+    limits.lowLow = 0.0;
+    limits.deadband = 5.0;
+
+    const size_t alarm = engine.add({1, 1000}, "Temperature", limits);
+    CHECK(engine.size() == 1);
+    CHECK(engine.state(alarm) == LimitState::Normal);
+
+    SUBCASE("State transitions") {
+        engine.update(alarm, 50.0);
+        CHECK(transitions.empty());
+        engine.update(alarm, 85.0);
+        CHECK(engine.state(alarm) == LimitState::High);
+        engine.update(alarm, 120.0);
+        CHECK(engine.state(alarm) == LimitState::HighHigh);
+        engine.update(alarm, 10.0);
+        CHECK(engine.state(alarm) == LimitState::Low);
+        engine.update(alarm, -10.0);
+        CHECK(engine.state(alarm) == LimitState::LowLow);
+        engine.update(alarm, 50.0);
+        CHECK(engine.state(alarm) == LimitState::Normal);
+        CHECK(
+            transitions == std::vector<Transition>{
+                               {alarm, LimitState::Normal, LimitState::High},
+                               {alarm, LimitState::High, LimitState::HighHigh},
+                               {alarm, LimitState::HighHigh, LimitState::Low},
+                               {alarm, LimitState::Low, LimitState::LowLow},
+                               {alarm, LimitState::LowLow, LimitState::Normal},
+                           }
+        );
+    }
+
+    SUBCASE("Deadband") {
+        engine.update(alarm, 80.0);
+        CHECK(engine.state(alarm) == LimitState::High);
+        engine.update(alarm, 76.0);  // within deadband
+        CHECK(engine.state(alarm) == LimitState::High);
+        engine.update(alarm, 75.0);
+        CHECK(engine.state(alarm) == LimitState::Normal);
+        engine.update(alarm, -1.0);
+        CHECK(engine.state(alarm) == LimitState::LowLow);
+        engine.update(alarm, 4.0);  // within deadband
+        CHECK(engine.state(alarm) == LimitState::LowLow);
+        engine.update(alarm, 6.0);
+        CHECK(engine.state(alarm) == LimitState::Low);
+        CHECK(transitions.size() == 4);
+    }
+
+    SUBCASE("NaN keeps state") {
+        engine.update(alarm, 90.0);
+        engine.update(alarm, NAN);
+        CHECK(engine.state(alarm) == LimitState::High);
+        CHECK(transitions.size() == 1);
+    }
+
+    SUBCASE("Batch update") {
+        LimitAlarmLimits highOnly;
+        highOnly.high = 1.0;
+        const size_t alarm2 = engine.add({1, 1001}, "Pressure", highOnly);
+        const size_t alarm3 = engine.add({1, 1002}, "Level", highOnly);
+
+        const std::vector<size_t> alarms{alarm3, alarm};
+        engine.update(alarms, std::vector<double>{2.0, 50.0});
+        CHECK(engine.state(alarm) == LimitState::Normal);
+        CHECK(engine.state(alarm2) == LimitState::Normal);
+        CHECK(engine.state(alarm3) == LimitState::High);
+
+        engine.updateAll(std::vector<double>{150.0, 2.0, 0.0});
+        CHECK(engine.state(alarm) == LimitState::HighHigh);
+        CHECK(engine.state(alarm2) == LimitState::High);
+        CHECK(engine.state(alarm3) == LimitState::Normal);
+        CHECK(transitions.size() == 4);
+
+        CHECK_THROWS_AS(engine.update(alarms, std::vector<double>{1.0}), std::invalid_argument);
+        CHECK_THROWS_AS(
+            engine.update(std::vector<size_t>{3}, std::vector<double>{1.0}), std::out_of_range
+        );
+        CHECK_THROWS_AS(engine.updateAll(std::vector<double>{1.0}), std::invalid_argument);
+    }
+
+    SUBCASE("Set limits") {
+        engine.update(alarm, 50.0);
+        limits.high = 40.0;
+        engine.setLimits(alarm, limits);
+        CHECK(engine.state(alarm) == LimitState::Normal);
+        engine.update(alarm, 50.0);
+        CHECK(engine.state(alarm) == LimitState::High);
+        CHECK_THROWS_AS(engine.setLimits(1, limits), std::out_of_range);
+    }
+
+    SUBCASE("Severity") {
+        engine.setSeverity(LimitState::High, 700);
+        CHECK_NOTHROW(engine.update(alarm, 90.0));
+    }
+}
+
+TEST_CASE("getLimitStateName") {
+    CHECK(getLimitStateName(LimitState::LowLow) == "LowLow");
+    CHECK(getLimitStateName(LimitState::Normal) == "Normal");
+    CHECK(getLimitStateName(LimitState::HighHigh) == "HighHigh");
+}
+
+#endif
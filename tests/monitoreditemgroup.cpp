@@ -0,0 +1,88 @@
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/monitoreditemgroup.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("MonitoredItemGroup") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+    auto sub = client.createSubscription();
+
+    std::vector<IntegerId> ids;
+    for (int i = 0; i < 50; ++i) {
+        const auto item = sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            [](IntegerId, IntegerId, const DataValue&) {}
+        );
+        ids.push_back(item.monitoredItemId());
+    }
+
+    SUBCASE("Operation limit of server") {
+        MonitoredItemGroup group(sub, ids);
+        const auto results = group.setMonitoringMode(MonitoringMode::Sampling);
+        CHECK(results.size() == 50);
+    }
+
+    {
+        MonitoredItemGroup group(sub, {}, 16);  // 4 chunks
+
+        SUBCASE("Add & remove") {
+            CHECK(group.empty());
+            group.add(ids);
+            group.add(ids.front());  // ignore duplicates
+            CHECK(group.size() == 50);
+            group.remove(ids.front());
+            CHECK(group.size() == 49);
+            group.add(MonitoredItem(client, sub.subscriptionId(), ids.front()));
+            CHECK(group.size() == 50);
+            CHECK(group.monitoredItemIds().back() == ids.front());
+        }
+
+        SUBCASE("Set monitoring mode") {
+            group.add(ids);
+            const auto results = group.setMonitoringMode(MonitoringMode::Disabled);
+            REQUIRE(results.size() == 50);
+            for (const auto& result : results) {
+                CHECK(result.isGood());
+            }
+            CHECK(group.setMonitoringMode(MonitoringMode::Reporting).size() == 50);
+        }
+
+        SUBCASE("Modify") {
+            group.add(ids);
+            MonitoringParametersEx parameters;
+            parameters.samplingInterval = 500.0;
+            parameters.queueSize = 5;
+            const auto results = group.modify(parameters);
+            REQUIRE(results.size() == 50);
+            for (const auto& result : results) {
+                CHECK(result.statusCode().isGood());
+                CHECK(result.revisedQueueSize() == 5);
+            }
+        }
+
+        SUBCASE("Delete") {
+            group.add(ids);
+            group.add(9999U);  // invalid id
+            const auto results = group.deleteMonitoredItems();
+            REQUIRE(results.size() == 51);
+            CHECK(results.front().isGood());
+            CHECK(results.back() == UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+            CHECK(group.empty());
+            CHECK(sub.monitoredItems().empty());
+        }
+    }
+}
+#endif
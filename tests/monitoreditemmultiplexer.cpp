@@ -0,0 +1,119 @@
+#include <chrono>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/monitoreditemmultiplexer.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("MonitoredItemMultiplexer") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    SubscriptionParameters subscriptionParameters{};
+    subscriptionParameters.publishingInterval = 10.0;
+    MonitoredItemMultiplexer mux(client, subscriptionParameters);
+
+    const NodeId id = VariableId::Server_ServerStatus_CurrentTime;
+    MonitoringParametersEx parameters;
+    parameters.samplingInterval = 10.0;
+
+    auto runUntil = [&](auto&& predicate) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+            client.runIterate(10);
+        }
+        return predicate();
+    };
+
+    size_t countA = 0;
+    size_t countB = 0;
+    const auto a = mux.subscribeDataChange(
+        id,
+        AttributeId::Value,
+        parameters,
+        [&](IntegerId, IntegerId, const DataValue&) { ++countA; }
+    );
+    const auto b = mux.subscribeDataChange(
+        id,
+        AttributeId::Value,
+        parameters,
+        [&](IntegerId, IntegerId, const DataValue&) { ++countB; }
+    );
+
+    SUBCASE("Share identical requests") {
+        CHECK(a != b);
+        CHECK(mux.size() == 2);
+        CHECK(mux.monitoredItemCount() == 1);
+        CHECK(mux.monitoredItemId(a) == mux.monitoredItemId(b));
+        CHECK(mux.subscriberCount(a) == 2);
+    }
+
+    SUBCASE("Separate different requests") {
+        auto other = parameters;
+        other.samplingInterval = 100.0;
+        const auto c = mux.subscribeDataChange(id, AttributeId::Value, other, {});
+        const auto d = mux.subscribeDataChange(id, AttributeId::BrowseName, parameters, {});
+        CHECK(mux.monitoredItemCount() == 3);
+        CHECK(mux.monitoredItemId(c) != mux.monitoredItemId(a));
+        CHECK(mux.monitoredItemId(d) != mux.monitoredItemId(a));
+        CHECK(mux.subscriberCount(c) == 1);
+    }
+
+    SUBCASE("Fan out notifications") {
+        CHECK(runUntil([&] { return countA >= 2 && countB >= 2; }));
+    }
+
+    SUBCASE("Replay last value to late subscribers") {
+        REQUIRE(runUntil([&] { return countA > 0; }));
+        size_t countC = 0;
+        mux.subscribeDataChange(
+            id, AttributeId::Value, parameters, [&](IntegerId, IntegerId, const DataValue& dv) {
+                CHECK(dv.hasValue());
+                ++countC;
+            }
+        );
+        CHECK(countC == 1);  // without iteration of the client
+        CHECK(mux.monitoredItemCount() == 1);
+    }
+
+    SUBCASE("Delete monitored item with last subscriber") {
+        const auto monitoredItemId = mux.monitoredItemId(a);
+        mux.unsubscribe(a);
+        CHECK(mux.size() == 1);
+        CHECK(mux.monitoredItemCount() == 1);
+        CHECK(mux.subscriberCount(b) == 1);
+        CHECK_THROWS_AS(mux.unsubscribe(a), BadStatus);
+
+        mux.unsubscribe(b);
+        CHECK(mux.size() == 0);
+        CHECK(mux.monitoredItemCount() == 0);
+        // already deleted on the server
+        CHECK(services::deleteMonitoredItem(client, mux.subscriptionId(), monitoredItemId) ==
+              UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+
+        const size_t count = countA;
+        client.runIterate(50);
+        CHECK(countA == count);
+    }
+
+    SUBCASE("Unsubscribe within callback") {
+        IntegerId c = 0;
+        c = mux.subscribeDataChange(
+            id, AttributeId::Value, parameters, [&](IntegerId, IntegerId, const DataValue&) {
+                mux.unsubscribe(c);
+            }
+        );
+        CHECK(runUntil([&] { return mux.size() == 2; }));
+        CHECK(runUntil([&] { return countB >= 2; }));
+    }
+}
+#endif
@@ -0,0 +1,164 @@
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/plugin/certificateverification.hpp"
+#include "open62541pp/plugin/create_certificate.hpp"
+#include "open62541pp/server.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+namespace {
+struct FakeVerification {
+    int calls = 0;
+    bool cleared = false;
+
+    static UA_StatusCode verify(FakeVerification& self, const UA_ByteString* certificate) {
+        ++self.calls;
+        const auto& cert = asWrapper<ByteString>(*certificate);
+        return static_cast<std::string_view>(cert) == "trusted"
+            ? UA_STATUSCODE_GOOD
+            : UA_STATUSCODE_BADCERTIFICATEUNTRUSTED;
+    }
+
+    NativeCertificateVerification create() {
+        NativeCertificateVerification native{};
+        native.context = this;
+#if UAPP_OPEN62541_VER_GE(1, 4)
+        native.verifyCertificate = [](UA_CertificateGroup* group, const UA_ByteString* cert) {
+            return verify(*static_cast<FakeVerification*>(group->context), cert);
+        };
+#else
+        native.verifyCertificate = [](void* context, const UA_ByteString* cert) {
+            return verify(*static_cast<FakeVerification*>(context), cert);
+        };
+#endif
+#if UAPP_OPEN62541_VER_GE(1, 1)
+        native.clear = [](NativeCertificateVerification* plugin) {
+#else
+        native.deleteMembers = [](NativeCertificateVerification* plugin) {
+#endif
+            static_cast<FakeVerification*>(plugin->context)->cleared = true;
+        };
+        return native;
+    }
+};
+
+UA_StatusCode verifyNative(NativeCertificateVerification& native, const ByteString& certificate) {
+#if UAPP_OPEN62541_VER_GE(1, 4)
+    return native.verifyCertificate(&native, certificate.handle());
+#else
+    return native.verifyCertificate(native.context, certificate.handle());
+#endif
+}
+}  // namespace
+
+TEST_CASE("CertificateVerificationCache") {
+    FakeVerification fake;
+    const ByteString trusted("trusted");
+    const ByteString untrusted("untrusted");
+
+    SUBCASE("Cache results") {
+        CertificateVerificationCache cache(fake.create());
+        CHECK(cache.verifyCertificate(trusted).isGood());
+        CHECK(cache.verifyCertificate(trusted).isGood());
+        CHECK(fake.calls == 1);
+        CHECK(cache.verifyCertificate(untrusted) == UA_STATUSCODE_BADCERTIFICATEUNTRUSTED);
+        CHECK(cache.verifyCertificate(untrusted) == UA_STATUSCODE_BADCERTIFICATEUNTRUSTED);
+        CHECK(fake.calls == 2);
+        CHECK(cache.size() == 2);
+        CHECK(cache.statistics().hits == 2);
+        CHECK(cache.statistics().misses == 2);
+
+        cache.invalidate();
+        CHECK(cache.size() == 0);
+        CHECK(cache.verifyCertificate(trusted).isGood());
+        CHECK(fake.calls == 3);
+    }
+
+    SUBCASE("Expire results") {
+        CertificateVerificationCacheOptions options;
+        options.ttl = std::chrono::milliseconds(0);
+        CertificateVerificationCache cache(fake.create(), options);
+        CHECK(cache.verifyCertificate(trusted).isGood());
+        CHECK(cache.verifyCertificate(trusted).isGood());
+        CHECK(fake.calls == 2);
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Bounded size") {
+        CertificateVerificationCacheOptions options;
+        options.maxEntries = 1;
+        CertificateVerificationCache cache(fake.create(), options);
+        cache.verifyCertificate(trusted);
+        cache.verifyCertificate(untrusted);
+        CHECK(cache.size() == 1);
+    }
+
+    SUBCASE("Prevalidate") {
+        std::vector<ByteString> certificates;
+        for (int i = 0; i < 20; ++i) {
+            certificates.emplace_back("cert" + std::to_string(i));
+        }
+        CertificateVerificationCache cache(fake.create());
+        cache.prevalidate(certificates, 4);
+        CHECK(fake.calls == 20);
+        CHECK(cache.size() == 20);
+        cache.prevalidate(certificates, 4);
+        CHECK(fake.calls == 20);
+    }
+
+    SUBCASE("Native plugin") {
+        auto* cache = new CertificateVerificationCache(fake.create());  // NOLINT
+        auto native = cache->create(true);
+        CHECK(verifyNative(native, trusted) == UA_STATUSCODE_GOOD);
+        CHECK(verifyNative(native, trusted) == UA_STATUSCODE_GOOD);
+        CHECK(fake.calls == 1);
+        detail::clear(native);  // deletes the adapter and clears the decorated plugin
+        CHECK(fake.cleared);
+    }
+}
+
+#if UAPP_HAS_CREATE_CERTIFICATE
+TEST_CASE("CertificateVerificationCache with encrypted connections") {
+    const auto certServer = createCertificate(
+        {String{"C=DE"}, String{"O=open62541pp"}, String{"CN=open62541ppServer@localhost"}},
+        {String{"DNS:localhost"}, String{"URI:urn:localhost:server"}}
+    );
+    const auto certClient = createCertificate(
+        {String{"C=DE"}, String{"O=open62541pp"}, String{"CN=open62541ppClient@localhost"}},
+        {String{"DNS:localhost"}, String{"URI:urn:localhost:client"}}
+    );
+
+    ServerConfig serverConfig(
+        4840, certServer.certificate, certServer.privateKey, {certClient.certificate}, {}, {}
+    );
+    serverConfig.setApplicationUri("urn:localhost:server");
+    auto& cache = serverConfig.enableCertificateVerificationCache();
+    Server server(std::move(serverConfig));
+    ServerRunner serverRunner(server);
+
+    // connection storm: the client certificate is only verified once
+    for (int i = 0; i < 3; ++i) {
+        ClientConfig clientConfig(
+            certClient.certificate, certClient.privateKey, {certServer.certificate}, {}
+        );
+        clientConfig.setSecurityMode(MessageSecurityMode::SignAndEncrypt);
+        asWrapper<String>(clientConfig->clientDescription.applicationUri) =
+            String("urn:localhost:client");
+        Client client(std::move(clientConfig));
+        CHECK_NOTHROW(client.connect("opc.tcp://localhost:4840"));
+        client.disconnect();
+    }
+    CHECK(cache.size() == 1);
+    CHECK(cache.statistics().misses == 1);
+    CHECK(cache.statistics().hits >= 2);
+}
+#endif
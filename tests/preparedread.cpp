@@ -0,0 +1,68 @@
+#include <string>
+#include <utility>  // move
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/preparedread.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+using namespace opcua;
+
+TEST_CASE("PreparedRead") {
+    ServerClientSetup setup;
+    auto& client = setup.client;
+    client.connect(setup.endpointUrl);
+
+    const std::vector<ReadValueId> nodesToRead{
+        {VariableId::Server_NamespaceArray, AttributeId::Value},
+        {VariableId::Server_ServerStatus_State, AttributeId::Value},
+        {VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value},
+    };
+    PreparedRead prepared(client, nodesToRead);
+    CHECK(prepared.size() == 3);
+    CHECK(prepared.request().nodesToRead().size() == 3);
+
+    SUBCASE("Read into preallocated storage") {
+        std::vector<DataValue> values(prepared.size());
+        const auto* storage = values.data();
+        for (int cycle = 0; cycle < 3; ++cycle) {
+            CHECK(prepared.readInto(values) == UA_STATUSCODE_GOOD);
+            CHECK(values.data() == storage);
+            const auto namespaces = values[0].value().to<std::vector<std::string>>();
+            CHECK(namespaces.at(0) == "http://opcfoundation.org/UA/");
+            CHECK(values[1].hasValue());
+            CHECK(values[2].hasValue());
+        }
+        // prepared request is unchanged after sending
+        CHECK(prepared.request().nodesToRead().size() == 3);
+        CHECK(
+            prepared.request().nodesToRead()[2].nodeId() ==
+            NodeId(VariableId::Server_ServerStatus_CurrentTime)
+        );
+    }
+
+    SUBCASE("Read into storage of wrong size") {
+        std::vector<DataValue> values(2);
+        CHECK(prepared.readInto(values) == UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+
+    SUBCASE("Read async with pending requests") {
+        std::vector<ReadResponse> responses;
+        auto handler = [&](ReadResponse& response) { responses.push_back(std::move(response)); };
+        prepared.readAsync(handler);
+        prepared.readAsync(handler);
+        while (responses.size() < 2) {
+            client.runIterate();
+        }
+        std::vector<DataValue> values(prepared.size());
+        CHECK(PreparedRead::takeResults(responses[0], values) == UA_STATUSCODE_GOOD);
+        CHECK(values[2].hasValue());
+        CHECK_FALSE(responses[0].results()[2].hasValue());  // moved out of the response
+        CHECK(PreparedRead::takeResults(responses[1], values) == UA_STATUSCODE_GOOD);
+        CHECK(values[2].hasValue());
+    }
+}
@@ -0,0 +1,120 @@
+#include <chrono>
+#include <memory>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/redundantclient.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("RedundantClient") {
+    auto server1 = std::make_unique<Server>(4841);
+    auto server2 = std::make_unique<Server>(4842);
+    auto serverRunner1 = std::make_unique<ServerRunner>(*server1);
+    ServerRunner serverRunner2(*server2);
+
+    Client primary;
+    Client backup;
+    primary.connect("opc.tcp://localhost:4841");
+    backup.connect("opc.tcp://localhost:4842");
+
+    RedundantClientOptions options;
+    options.subscriptionParameters.publishingInterval = 50.0;
+    RedundantClient client(primary, backup, options);
+    CHECK(&client.active() == &primary);
+    CHECK(&client.standby() == &backup);
+    CHECK(client.isStandbyAvailable());
+    CHECK(primary.subscriptions().size() == 1);
+    CHECK(backup.subscriptions().size() == 1);
+
+    size_t notifications = 0;
+    MonitoringParametersEx parameters;
+    parameters.samplingInterval = 50.0;
+    parameters.queueSize = 100;
+    const auto handle = client.subscribeDataChange(
+        VariableId::Server_ServerStatus_CurrentTime,
+        AttributeId::Value,
+        parameters,
+        [&](IntegerId, IntegerId, const DataValue&) { ++notifications; }
+    );
+
+    auto runUntil = [&](auto&& predicate) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+            client.runIterate(50);
+        }
+        return predicate();
+    };
+
+    // notifications of the active server only
+    REQUIRE(runUntil([&] { return notifications > 0; }));
+
+    size_t failoverIndex = 0;
+    client.onFailover([&](size_t active) { failoverIndex = active; });
+
+    SUBCASE("Manual failover") {
+        client.failover();
+        CHECK(client.activeIndex() == 1);
+        CHECK(failoverIndex == 1);
+        CHECK(client.failoverCount() == 1);
+        CHECK(client.isStandbyAvailable());  // previous server demoted to standby
+
+        notifications = 0;
+        CHECK(runUntil([&] { return notifications > 0; }));
+
+        client.failover();
+        CHECK(client.activeIndex() == 0);
+        CHECK(client.failoverCount() == 2);
+    }
+
+    SUBCASE("Failover on server failure") {
+        serverRunner1.reset();
+        server1.reset();
+
+        CHECK(runUntil([&] { return client.failoverCount() == 1; }));
+        CHECK(client.activeIndex() == 1);
+        CHECK(failoverIndex == 1);
+        CHECK_FALSE(client.isStandbyAvailable());
+        CHECK(client.lastFailoverDuration() < std::chrono::seconds(1));
+
+        notifications = 0;
+        CHECK(runUntil([&] { return notifications > 0; }));
+        CHECK_THROWS_AS(client.failover(), BadStatus);
+    }
+
+    SUBCASE("Exceptions of callbacks are rethrown without failover") {
+        client.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            parameters,
+            [](IntegerId, IntegerId, const DataValue&) {
+                throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+            }
+        );
+        bool thrown = false;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!thrown && std::chrono::steady_clock::now() < deadline) {
+            try {
+                client.runIterate(50);
+            } catch (const BadStatus& e) {
+                thrown = e.code() == UA_STATUSCODE_BADUNEXPECTEDERROR;
+            }
+        }
+        CHECK(thrown);
+        CHECK(client.activeIndex() == 0);
+        CHECK(client.failoverCount() == 0);
+    }
+
+    SUBCASE("Unsubscribe") {
+        client.unsubscribe(handle);
+        CHECK_THROWS_AS(client.unsubscribe(handle), BadStatus);
+    }
+}
+#endif
@@ -0,0 +1,130 @@
+#include <chrono>
+#include <optional>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/reliablesubscription.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/detail/client_service.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("ReliableSubscription") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    ReliableSubscriptionOptions options;
+    options.subscriptionParameters.publishingInterval = 10.0;
+    options.subscriptionParameters.maxKeepAliveCount = 10;
+    options.publishRequests = 1;
+    ReliableSubscription sub(client, options);
+
+    MonitoringParametersEx parameters;
+    parameters.samplingInterval = 10.0;
+
+    // changes every publishing cycle, each notification message contains a notification
+    std::vector<DateTime> times;
+    sub.subscribeDataChange(
+        VariableId::Server_ServerStatus_CurrentTime,
+        AttributeId::Value,
+        parameters,
+        [&](IntegerId, IntegerId, const DataValue& dv) {
+            times.push_back(dv.value().scalar<DateTime>());
+        }
+    );
+    // static value, only the initial notification
+    size_t staticCount = 0;
+    const auto staticId = sub.subscribeDataChange(
+        VariableId::Server_ServerStatus_BuildInfo_ProductName,
+        AttributeId::Value,
+        parameters,
+        [&](IntegerId, IntegerId, const DataValue& dv) {
+            CHECK(dv.hasValue());
+            ++staticCount;
+        }
+    );
+
+    auto runUntil = [&](auto&& predicate) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+            sub.runIterate(10);
+        }
+        return predicate();
+    };
+
+    auto isOrdered = [&] {
+        for (size_t i = 1; i < times.size(); ++i) {
+            if (times[i].get() < times[i - 1].get()) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // simulate a lost PublishResponse, the notification message is consumed by another request
+    auto steal = [&](std::optional<uint32_t> acknowledge) {
+        UA_SubscriptionAcknowledgement ack{sub.subscriptionId(), acknowledge.value_or(0)};
+        UA_PublishRequest request{};
+        if (acknowledge.has_value()) {
+            request.subscriptionAcknowledgementsSize = 1;
+            request.subscriptionAcknowledgements = &ack;
+        }
+        auto response = services::detail::sendRequest<UA_PublishRequest, UA_PublishResponse>(
+            client, request
+        );
+        const uint32_t sequenceNumber = response.notificationMessage.sequenceNumber;
+        UA_clear(&response, &UA_TYPES[UA_TYPES_PUBLISHRESPONSE]);
+        return sequenceNumber;
+    };
+
+    REQUIRE(runUntil([&] { return times.size() >= 3 && staticCount == 1; }));
+
+    SUBCASE("Deliver in sequence") {
+        const auto statistics = sub.statistics();
+        CHECK(statistics.notificationMessages >= 3);
+        CHECK(statistics.gaps == 0);
+        CHECK(statistics.missingMessages == 0);
+        CHECK(sub.nextSequenceNumber() == statistics.notificationMessages + 1);
+        CHECK(isOrdered());
+    }
+
+    SUBCASE("Recover with Republish") {
+        const uint32_t stolen = steal(std::nullopt);
+        CHECK(runUntil([&] { return sub.statistics().republishedMessages >= 1; }));
+        CHECK(runUntil([&] { return sub.nextSequenceNumber() > stolen; }));
+        const auto statistics = sub.statistics();
+        CHECK(statistics.gaps >= 1);
+        CHECK(statistics.missingMessages >= 1);
+        CHECK(statistics.lostMessages == 0);
+        CHECK(statistics.rereads == 0);
+        CHECK(staticCount == 1);
+        CHECK(isOrdered());
+    }
+
+    SUBCASE("Re-read affected items if republish fails") {
+        // acknowledge the stolen message, it is removed from the retransmission queue
+        const uint32_t stolen = steal(std::nullopt);
+        steal(stolen);
+        CHECK(runUntil([&] { return sub.statistics().lostMessages >= 1; }));
+        CHECK(runUntil([&] { return staticCount >= 2; }));
+        const auto statistics = sub.statistics();
+        CHECK(statistics.rereads >= 1);
+        CHECK(statistics.rereadValues >= 1);
+        CHECK(sub.nextSequenceNumber() > stolen);
+        CHECK(isOrdered());
+    }
+
+    SUBCASE("Unsubscribe") {
+        sub.unsubscribe(staticId);
+        CHECK_THROWS_AS(sub.unsubscribe(staticId), BadStatus);
+    }
+}
+#endif
@@ -0,0 +1,169 @@
+#include <chrono>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/node.hpp"
+#include "open62541pp/replication.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("Replication") {
+    Server primary(4841);
+    Server standby(4842);
+
+    // same address space on both servers
+    std::vector<NodeId> ids;
+    for (uint32_t i = 0; i < 10; ++i) {
+        const NodeId id(1, 1000 + i);
+        for (auto* server : {&primary, &standby}) {
+            Node(*server, ObjectId::ObjectsFolder)
+                .addVariable(
+                    id,
+                    "Variable",
+                    VariableAttributes{}
+                        .setAccessLevel(AccessLevel::CurrentRead | AccessLevel::CurrentWrite)
+                        .setDataType<int32_t>()
+                        .setValueScalar(int32_t{0})
+                );
+        }
+        ids.push_back(id);
+    }
+
+    ReplicationStandby standbyRole(standby, 100);
+    CHECK_FALSE(standbyRole.isPromoted());
+    CHECK(services::readValue(standby, VariableId::Server_ServiceLevel)->scalar<uint8_t>() == 100);
+
+    ServerRunner standbyRunner(standby);
+    Client client;
+    client.connect("opc.tcp://localhost:4842");
+
+    ReplicationOptions options;
+    options.samplingInterval = 10.0;
+    options.maxFrameSize = 4;  // 3 frames
+    ReplicationSender sender(primary, client, options);
+    for (const auto& id : ids) {
+        sender.addVariable(id);
+    }
+
+    auto runUntil = [&](auto&& predicate) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+            primary.runIterate();
+            sender.flush();
+            client.runIterate(10);
+        }
+        return predicate();
+    };
+
+    auto replicated = [&](int32_t value) {
+        for (const auto& id : ids) {
+            const auto result = services::readValue(client, id);
+            if (!result || result->scalar<int32_t>() != value) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    // replicate initial values
+    REQUIRE(runUntil([&] {
+        const auto statistics = sender.statistics();
+        return statistics.pendingValues == 0 && statistics.framesInFlight == 0;
+    }));
+
+    SUBCASE("Replicate values") {
+        for (const auto& id : ids) {
+            services::writeValue(primary, id, Variant(int32_t{42})).throwIfBad();
+        }
+        CHECK(runUntil([&] { return replicated(42); }));
+
+        const auto statistics = sender.statistics();
+        CHECK(statistics.capturedValues >= ids.size());
+        CHECK(statistics.sentValues >= ids.size());
+        CHECK(statistics.appliedValues >= ids.size());
+        CHECK(statistics.failedValues == 0);
+        CHECK(statistics.sentFrames >= 3);
+        CHECK(statistics.maxLag > std::chrono::steady_clock::duration::zero());
+        CHECK(statistics.maxLag >= statistics.lastLag);
+        MESSAGE(
+            "Replication lag: ",
+            std::chrono::duration_cast<std::chrono::microseconds>(statistics.maxLag).count(),
+            " us"
+        );
+    }
+
+    SUBCASE("Coalesce pending values") {
+        sender.capture(ids[0], DataValue(Variant(int32_t{1})));
+        sender.capture(ids[0], DataValue(Variant(int32_t{2})));
+        CHECK(sender.statistics().pendingValues == 1);
+        CHECK(sender.flush() == 1);
+        CHECK(sender.statistics().pendingValues == 0);
+    }
+
+    SUBCASE("Keep values pending if the standby is disconnected") {
+        client.disconnect();
+        sender.capture(ids[0], DataValue(Variant(int32_t{1})));
+        sender.capture(ids[1], DataValue(Variant(int32_t{2})));
+        CHECK(sender.flush() == 0);
+        const auto statistics = sender.statistics();
+        CHECK(statistics.pendingValues == 2);
+        CHECK(statistics.framesInFlight == 0);
+        CHECK(statistics.failedValues == 0);
+
+        client.connect("opc.tcp://localhost:4842");
+        CHECK_THROWS_AS(client.runIterate(0), BadStatus);  // error of the unsent frame
+        CHECK(runUntil([&] {
+            return services::readValue(client, ids[1])->scalar<int32_t>() == 2;
+        }));
+    }
+
+    SUBCASE("Requeue values of failed frames") {
+        sender.capture(ids[0], DataValue(Variant(int32_t{5})));
+        sender.capture(ids[1], DataValue(Variant(int32_t{6})));
+        CHECK(sender.flush() == 2);
+        sender.capture(ids[1], DataValue(Variant(int32_t{7})));  // supersedes the value in flight
+        client.disconnect();  // drop the response of the frame in flight
+        auto statistics = sender.statistics();
+        CHECK(statistics.framesInFlight == 0);
+        CHECK(statistics.pendingValues == 2);
+        CHECK(statistics.requeuedValues == 1);
+
+        client.connect("opc.tcp://localhost:4842");
+        CHECK(runUntil([&] {
+            return services::readValue(client, ids[0])->scalar<int32_t>() == 5 &&
+                services::readValue(client, ids[1])->scalar<int32_t>() == 7;
+        }));
+    }
+
+    SUBCASE("Remove variable") {
+        sender.removeVariable(ids[0]);
+        services::writeValue(primary, ids[0], Variant(int32_t{7})).throwIfBad();
+        services::writeValue(primary, ids[1], Variant(int32_t{7})).throwIfBad();
+        CHECK(runUntil([&] {
+            return services::readValue(client, ids[1])->scalar<int32_t>() == 7;
+        }));
+        CHECK(services::readValue(client, ids[0])->scalar<int32_t>() == 0);
+    }
+
+    SUBCASE("Promote standby with warm values") {
+        for (const auto& id : ids) {
+            services::writeValue(primary, id, Variant(int32_t{3})).throwIfBad();
+        }
+        REQUIRE(runUntil([&] { return replicated(3); }));
+        standbyRole.promote();
+        CHECK(standbyRole.isPromoted());
+        const auto serviceLevel = services::readValue(client, VariableId::Server_ServiceLevel);
+        CHECK(serviceLevel->scalar<uint8_t>() == 255);
+        CHECK(replicated(3));
+    }
+}
+#endif
@@ -0,0 +1,120 @@
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
+#include "open62541pp/services/method.hpp"
+#include "open62541pp/services/nodemanagement.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_runner.hpp"
+
+using namespace opcua;
+using namespace std::chrono_literals;
+
+// Stress test of the concurrent server mode, run with ThreadSanitizer enabled
+// (UAPP_ENABLE_SANITIZER_THREAD) to detect data races.
+#if UAPP_HAS_CONCURRENT_SERVER
+TEST_CASE("Server concurrent services") {
+    constexpr size_t threadCount = 8;
+    constexpr int iterations = 100;
+
+    Server server;
+    ServerRunner runner(server);
+
+    std::atomic<size_t> failures{0};
+    std::atomic<size_t> callbacks{0};
+    auto check = [&](bool condition) {
+        if (!condition) {
+            ++failures;
+        }
+    };
+
+    auto worker = [&](size_t index) {
+        const std::string variableName = "Variable." + std::to_string(index);
+        const std::string methodName = "Method." + std::to_string(index);
+        const NodeId variableId(1, variableName);
+        const NodeId methodId(1, methodName);
+        const auto readWrite = AccessLevel::CurrentRead | AccessLevel::CurrentWrite;
+        check(services::addVariable(
+                  server,
+                  ObjectId::ObjectsFolder,
+                  variableId,
+                  variableName,
+                  VariableAttributes{}.setAccessLevel(readWrite).setDataType<int32_t>(),
+                  VariableTypeId::BaseDataVariableType,
+                  ReferenceTypeId::HasComponent
+        )
+                  .hasValue());
+        check(services::addMethod(
+                  server,
+                  ObjectId::ObjectsFolder,
+                  methodId,
+                  methodName,
+                  [&](Span<const Variant> input, Span<Variant> output) {
+                      output[0] = input[0].to<int32_t>() + 1;
+                  },
+                  {{"Input", {}, DataTypeId::Int32, ValueRank::Scalar}},
+                  {{"Output", {}, DataTypeId::Int32, ValueRank::Scalar}},
+                  MethodAttributes{},
+                  ReferenceTypeId::HasComponent
+        )
+                  .hasValue());
+
+        for (int i = 0; i < iterations; ++i) {
+            // replace the callbacks while the other threads and the main loop are running
+            ValueCallback valueCallback;
+            valueCallback.onBeforeRead = [&](const DataValue&) { ++callbacks; };
+            server.setVariableNodeValueCallback(variableId, valueCallback);
+
+            check(services::writeValue(server, variableId, Variant(i)).isGood());
+            const auto value = services::readValue(server, variableId);
+            check(value.hasValue() && value.value().to<int32_t>() == i);
+
+            const std::vector<Variant> input{Variant(i)};
+            auto result = services::call(server, ObjectId::ObjectsFolder, methodId, input);
+            check(
+                result.statusCode().isGood() && result.outputArguments().size() == 1 &&
+                result.outputArguments()[0].to<int32_t>() == i + 1
+            );
+
+            const auto timerId = server.schedule(1ms, [&] { ++callbacks; });
+            server.cancelTimer(timerId);
+        }
+        check(services::deleteNode(server, methodId, true).isGood());
+        check(services::deleteNode(server, variableId, true).isGood());
+    };
+
+    std::atomic<bool> clientDone{false};
+    std::thread clientThread([&] {
+        Client client;
+        client.connect("opc.tcp://localhost:4840");
+        while (!clientDone) {
+            check(services::readValue(client, VariableId::Server_ServerStatus_CurrentTime)
+                      .hasValue());
+        }
+        client.disconnect();
+    });
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back(worker, i);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    clientDone = true;
+    clientThread.join();
+
+    CHECK(failures == 0);
+    CHECK(callbacks >= threadCount * iterations);
+    CHECK(server.isRunning());
+}
+#endif
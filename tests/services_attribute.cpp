@@ -4,6 +4,7 @@
 
 #include "open62541pp/config.hpp"
 #include "open62541pp/services/attribute.hpp"
+#include "open62541pp/plugin/nodestore.hpp"  // ValueCallback, ValueBackendDataSource
 #include "open62541pp/services/attribute_highlevel.hpp"
 #include "open62541pp/services/nodemanagement.hpp"  // add*
 #include "open62541pp/ua/nodeids.hpp"
@@ -260,6 +261,85 @@ TEST_CASE("Attribute service set (highlevel)") {
         CHECK(valueRead->sourcePicoseconds == valueWrite->sourcePicoseconds);
     }
 
+    SUBCASE("Write value if changed") {
+        const NodeId id{1, "TestValueIfChanged"};
+        REQUIRE(services::addVariable(
+            server,
+            objectsId,
+            id,
+            "TestValueIfChanged",
+            {},
+            VariableTypeId::BaseDataVariableType,
+            ReferenceTypeId::HasComponent
+        ));
+
+        CHECK(services::writeValueIfChanged(server, id, Variant(11)).value());
+        CHECK_FALSE(services::writeValueIfChanged(server, id, Variant(11)).value());
+        CHECK(services::writeValueIfChanged(server, id, Variant(12)).value());
+        CHECK(services::readValue(server, id).value().scalar<int>() == 12);
+
+        // unchanged value and status, the new source timestamp is not written
+        const DataValue valueWrite(Variant(12), DateTime{1}, {}, {}, {}, {});
+        CHECK_FALSE(services::writeDataValueIfChanged(server, id, valueWrite).value());
+        CHECK(services::readDataValue(server, id).value().sourceTimestamp() != DateTime{1});
+
+        // changed status
+        const DataValue valueUncertain(
+            Variant(12), {}, {}, {}, {}, UA_STATUSCODE_UNCERTAINLASTUSABLEVALUE
+        );
+        CHECK(services::writeDataValueIfChanged(server, id, valueUncertain).value());
+
+        // writes through other services invalidate the last written value
+        CHECK(services::writeValueIfChanged(server, id, Variant(13)).value());
+        CHECK(services::writeValue(server, id, Variant(14)).isGood());
+        CHECK(services::writeValueIfChanged(server, id, Variant(13)).value());
+        CHECK(services::readValue(server, id).value().scalar<int>() == 13);
+
+        // writes through the native API are detected as well
+        Variant value14(14);
+        CHECK(UA_Server_writeValue(server.handle(), id, *value14.handle()) == UA_STATUSCODE_GOOD);
+        CHECK(services::writeValueIfChanged(server, id, Variant(13)).value());
+        CHECK(services::readValue(server, id).value().scalar<int>() == 13);
+
+        // value callbacks are still invoked
+        int writes = 0;
+        ValueCallback valueCallback;
+        valueCallback.onAfterWrite = [&](const DataValue&) { ++writes; };
+        server.setVariableNodeValueCallback(id, valueCallback);
+        CHECK_FALSE(services::writeValueIfChanged(server, id, Variant(13)).value());
+        CHECK(services::writeValueIfChanged(server, id, Variant(15)).value());
+        CHECK(writes == 1);
+
+        // data sources are always written
+        const NodeId dataSourceId{1, "TestValueIfChangedDataSource"};
+        REQUIRE(services::addVariable(
+            server,
+            objectsId,
+            dataSourceId,
+            "TestValueIfChangedDataSource",
+            {},
+            VariableTypeId::BaseDataVariableType,
+            ReferenceTypeId::HasComponent
+        ));
+        int data = 0;
+        ValueBackendDataSource dataSource;
+        dataSource.write = [&](const DataValue& dv, const NumericRange&) {
+            data = dv.value().scalar<int>();
+            return UA_STATUSCODE_GOOD;
+        };
+        server.setVariableNodeValueBackend(dataSourceId, dataSource);
+        CHECK(services::writeValueIfChanged(server, dataSourceId, Variant(1)).value());
+        data = 0;
+        CHECK(services::writeValueIfChanged(server, dataSourceId, Variant(1)).value());
+        CHECK(data == 1);
+
+        // unknown node
+        CHECK(
+            services::writeValueIfChanged(server, {1, "Unknown"}, Variant(1)).code() ==
+            UA_STATUSCODE_BADNODEIDUNKNOWN
+        );
+    }
+
 #ifdef UA_ENABLE_TYPEDESCRIPTION
 
     SUBCASE("Data type definition (read)") {
@@ -1,5 +1,6 @@
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include <doctest/doctest.h>
 
@@ -350,6 +351,76 @@ TEST_CASE("MonitoredItem service set (server)") {
         CHECK(notificationCount > 0);
     }
 
+    SUBCASE("createMonitoredItemDataChange with AggregateFilter") {
+        monitoringParameters.filter = ExtensionObject(AggregateFilter(
+            DateTime::now(), NodeId(ObjectId::AggregateFunction_Maximum), 50.0, {}
+        ));
+        std::vector<DataValue> notifications;
+        const auto result = services::createMonitoredItemDataChange(
+            server,
+            0U,
+            {id, AttributeId::Value},
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](IntegerId, IntegerId, const DataValue& dv) { notifications.push_back(dv); },
+            {}
+        );
+        REQUIRE(result.statusCode().isGood());
+        for (double value : {1.0, 3.0, 2.0}) {
+            services::writeValue(server, id, Variant(value)).throwIfBad();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            server.runIterate();
+        }
+        CHECK(notifications.empty());  // raw samples are not forwarded
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+        server.runIterate();
+        REQUIRE(notifications.size() >= 1);
+        CHECK(notifications.at(0).status().isGood());
+        CHECK(notifications.at(0).value().to<double>() == 3.0);
+        CHECK(services::deleteMonitoredItem(server, 0U, result.monitoredItemId()).isGood());
+    }
+
+    SUBCASE("createMonitoredItemDataChange with AggregateFilter and past start time") {
+        // start time 1000 intervals in the past, elapsed intervals must not be published
+        monitoringParameters.filter = ExtensionObject(AggregateFilter(
+            DateTime(DateTime::now().get() - 50 * 1000 * UA_DATETIME_MSEC),
+            NodeId(ObjectId::AggregateFunction_Maximum),
+            50.0,
+            {}
+        ));
+        std::vector<DataValue> notifications;
+        const auto result = services::createMonitoredItemDataChange(
+            server,
+            0U,
+            {id, AttributeId::Value},
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](IntegerId, IntegerId, const DataValue& dv) { notifications.push_back(dv); },
+            {}
+        );
+        REQUIRE(result.statusCode().isGood());
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+        server.runIterate();
+        CHECK(notifications.size() <= 2);
+        CHECK(services::deleteMonitoredItem(server, 0U, result.monitoredItemId()).isGood());
+    }
+
+    SUBCASE("createMonitoredItemDataChange with unsupported AggregateFilter") {
+        monitoringParameters.filter = ExtensionObject(AggregateFilter(
+            {}, NodeId(ObjectId::AggregateFunction_Interpolative), 50.0, {}
+        ));
+        const auto result = services::createMonitoredItemDataChange(
+            server,
+            0U,
+            {id, AttributeId::Value},
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            {},
+            {}
+        );
+        CHECK(result.statusCode() == UA_STATUSCODE_BADAGGREGATENOTSUPPORTED);
+    }
+
     SUBCASE("deleteMonitoredItem") {
         CHECK(
             services::deleteMonitoredItem(server, 0U, 11U) ==
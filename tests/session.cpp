@@ -1,9 +1,18 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>  // move
+
 #include <doctest/doctest.h>
 
 #include "open62541pp/client.hpp"
 #include "open62541pp/config.hpp"
+#include "open62541pp/plugin/accesscontrol_default.hpp"
 #include "open62541pp/server.hpp"
+#include "open62541pp/services/attribute_highlevel.hpp"
 #include "open62541pp/session.hpp"
+#include "open62541pp/ua/nodeids.hpp"
 
 #include "helper/macros.hpp"  // UAPP_TSAN_ENABLED
 #include "helper/server_runner.hpp"
@@ -12,6 +21,43 @@ using namespace opcua;
 
 constexpr std::string_view localServerUrl{"opc.tcp://localhost:4840"};
 
+namespace {
+
+struct Role {
+    std::string name{"guest"};
+};
+
+struct DestructionCounter {
+    std::shared_ptr<int> count;
+
+    explicit DestructionCounter(std::shared_ptr<int> counter)
+        : count(std::move(counter)) {}
+
+    DestructionCounter(const DestructionCounter&) = delete;
+    DestructionCounter& operator=(const DestructionCounter&) = delete;
+
+    ~DestructionCounter() {
+        ++*count;
+    }
+};
+
+class AccessControlRoles : public AccessControlDefault {
+public:
+    StatusCode activateSession(
+        Session& session,
+        const EndpointDescription& endpointDescription,
+        const ByteString& secureChannelRemoteCertificate,
+        const ExtensionObject& userIdentityToken
+    ) override {
+        session.context<Role>()->name = "operator";
+        return AccessControlDefault::activateSession(
+            session, endpointDescription, secureChannelRemoteCertificate, userIdentityToken
+        );
+    }
+};
+
+}  // namespace
+
 TEST_CASE("Session") {
     Server server;
     ServerRunner serverRunner(server);
@@ -47,6 +93,63 @@ TEST_CASE("Session") {
 #endif
     }
 
+    SUBCASE("Session context slots") {
+        client.connect(localServerUrl);
+        auto session = server.sessions().at(0);
+
+        CHECK(session.findContext<Role>() == nullptr);
+        CHECK(session.context<Role>()->name == "guest");  // default-constructed
+        session.context<Role>()->name = "admin";
+        CHECK(session.findContext<Role>() != nullptr);
+
+        // retry with newly created session object
+        CHECK(server.sessions().at(0).context<Role>()->name == "admin");
+
+        auto role = session.emplaceContext<Role>(Role{"operator"});
+        CHECK(role->name == "operator");
+        CHECK(session.context<Role>() == role);
+        session.eraseContext<Role>();
+        CHECK(session.findContext<Role>() == nullptr);
+        CHECK(role->name == "operator");  // shared ownership
+
+        // context objects are destroyed when the session is closed
+        auto count = std::make_shared<int>(0);
+        session.emplaceContext<DestructionCounter>(count);
+        CHECK(*count == 0);
+        client.disconnect();
+        CHECK(*count == 1);
+        CHECK_THROWS_WITH(session.context<Role>(), "BadSessionIdInvalid");
+    }
+
+    SUBCASE("Session statistics") {
+        client.connect(localServerUrl);
+        auto session = server.sessions().at(0);
+
+        const auto before = session.statistics();
+        CHECK_FALSE(before.hasDiagnostics);  // disabled by default
+        CHECK(services::readValue(client, VariableId::Server_ServerStatus_CurrentTime));
+        const auto after = session.statistics();
+        CHECK(after.attributeAccessChecks > before.attributeAccessChecks);
+        CHECK(after.lastAccessCheck.get() > 0);
+
+        server.setSessionDiagnosticsEnabled(true);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (!session.statistics().hasDiagnostics &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        const auto diagnostics = session.statistics();
+        if (diagnostics.hasDiagnostics) {  // UA_ENABLE_DIAGNOSTICS
+            CHECK(diagnostics.readRequests.total >= 1);
+            CHECK(diagnostics.currentSubscriptions == 0);
+        }
+        server.setSessionDiagnosticsEnabled(false);
+        CHECK_FALSE(session.statistics().hasDiagnostics);
+
+        client.disconnect();
+        CHECK_THROWS_WITH(session.statistics(), "BadSessionIdInvalid");
+    }
+
     SUBCASE("Close session") {
         // thread sanitizer error in UA_Server_closeSession function despite mutex
         // false? bug in open62541?
@@ -59,8 +162,32 @@ TEST_CASE("Session") {
     }
 #endif
 
+    SUBCASE("Session context slots with known context") {
+        detail::SessionContext context;
+        Session session(server, {1, 1000}, &context);
+        *session.context<int>() = 11;
+        REQUIRE(context.find<int>() != nullptr);
+        CHECK(*context.find<int>() == 11);
+        CHECK(context.find<double>() == nullptr);
+    }
+
     SUBCASE("Equality") {
         CHECK(Session(server, {1, 1000}) == Session(server, {1, 1000}));
         CHECK(Session(server, {1, 1000}) != Session(server, {1, 1001}));
     }
 }
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+TEST_CASE("Session context slots in activateSession") {
+    AccessControlRoles accessControl;
+    Server server;
+    server.config().setAccessControl(accessControl);
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect(localServerUrl);
+
+    auto session = server.sessions().at(0);
+    REQUIRE(session.findContext<Role>() != nullptr);
+    CHECK(session.findContext<Role>()->name == "operator");
+}
+#endif
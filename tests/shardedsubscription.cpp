@@ -0,0 +1,158 @@
+#include <set>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/config.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/shardedsubscription.hpp"
+#include "open62541pp/ua/nodeids.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("ShardedSubscription") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    auto& client = setup.client;
+
+    const std::vector<NodeId> ids{
+        VariableId::Server_ServerStatus_CurrentTime,
+        VariableId::Server_ServerStatus_StartTime,
+        VariableId::Server_ServerStatus_State,
+        VariableId::Server_ServerStatus_BuildInfo_ProductName,
+        VariableId::Server_ServerStatus_BuildInfo_ProductUri,
+        VariableId::Server_ServerStatus_BuildInfo_ManufacturerName,
+    };
+
+    SUBCASE("Invalid sessions") {
+        CHECK_THROWS_AS(ShardedSubscription(Span<Client* const>{}), BadStatus);
+    }
+
+    SUBCASE("Hash") {
+        ShardedSubscriptionOptions options;
+        options.shardsPerSession = 2;
+        ShardedSubscription sharded(client, options);
+        for (const auto& id : ids) {
+            sharded.subscribeDataChange(id, AttributeId::Value);
+        }
+        CHECK(sharded.size() == ids.size());
+        CHECK(sharded.shards().size() <= 2);
+        CHECK(client.subscriptions().size() == sharded.shards().size());
+
+        // same node, same shard
+        const auto handle1 = sharded.subscribeDataChange(ids[0], AttributeId::Value);
+        const auto handle2 = sharded.subscribeDataChange(ids[0], AttributeId::Value);
+        CHECK(handle1 != handle2);
+        CHECK(&sharded.shard(handle1) == &sharded.shard(handle2));
+        CHECK(sharded.monitoredItemId(handle1) != sharded.monitoredItemId(handle2));
+
+        sharded.unsubscribe(handle1);
+        CHECK(sharded.size() == ids.size() + 1);
+        CHECK_THROWS_AS(sharded.unsubscribe(handle1), BadStatus);
+        CHECK_THROWS_AS(sharded.shard(handle1), BadStatus);
+    }
+
+    SUBCASE("Rate class") {
+        ShardedSubscriptionOptions options;
+        options.shardsPerSession = 1;
+        options.strategy = ShardingStrategy::RateClass;
+        options.rateClasses = {100.0, 1000.0};
+        ShardedSubscription sharded(client, options);
+
+        MonitoringParametersEx parameters;
+        parameters.samplingInterval = 50.0;
+        const auto fast = sharded.subscribeDataChange(ids[0], AttributeId::Value, parameters);
+        parameters.samplingInterval = 500.0;
+        const auto slow = sharded.subscribeDataChange(ids[0], AttributeId::Value, parameters);
+        parameters.samplingInterval = 5000.0;
+        const auto slowest = sharded.subscribeDataChange(ids[0], AttributeId::Value, parameters);
+
+        CHECK(sharded.shards().size() == 3);
+        CHECK(sharded.shard(fast).rateClass == 0);
+        CHECK(sharded.shard(slow).rateClass == 1);
+        CHECK(sharded.shard(slowest).rateClass == 2);
+    }
+
+    SUBCASE("Overflow shards by option") {
+        ShardedSubscriptionOptions options;
+        options.shardsPerSession = 1;
+        options.maxItemsPerSubscription = 2;
+        ShardedSubscription sharded(client, options);
+        for (const auto& id : ids) {
+            sharded.subscribeDataChange(id, AttributeId::Value);
+        }
+        REQUIRE(sharded.shards().size() == 3);
+        for (const auto& shard : sharded.shards()) {
+            CHECK(shard.itemCount == 2);
+        }
+    }
+
+    SUBCASE("Rebalance on BadTooManyMonitoredItems") {
+        setup.server.config()->maxMonitoredItemsPerSubscription = 2;
+        ShardedSubscriptionOptions options;
+        options.shardsPerSession = 1;
+        ShardedSubscription sharded(client, options);
+        for (const auto& id : ids) {
+            sharded.subscribeDataChange(id, AttributeId::Value);
+        }
+        CHECK(sharded.size() == ids.size());
+        REQUIRE(sharded.shards().size() == 3);
+        CHECK(sharded.shards()[0].full);
+    }
+
+    SUBCASE("Reuse overflow shards if all sessions are full") {
+        setup.server.config()->maxSubscriptionsPerSession = 2;
+        ShardedSubscriptionOptions options;
+        options.shardsPerSession = 1;
+        options.maxItemsPerSubscription = 1;
+        ShardedSubscription sharded(client, options);
+        sharded.subscribeDataChange(ids[0], AttributeId::Value);
+        const auto handle = sharded.subscribeDataChange(ids[1], AttributeId::Value);
+        CHECK_THROWS_AS(sharded.subscribeDataChange(ids[2], AttributeId::Value), BadStatus);
+
+        sharded.unsubscribe(handle);
+        const auto handle2 = sharded.subscribeDataChange(ids[2], AttributeId::Value);
+        CHECK(sharded.shards().size() == 2);
+        CHECK(&sharded.shard(handle2) == &sharded.shards()[1]);
+    }
+
+    SUBCASE("Session pool") {
+        Client client2;
+        client2.connect(setup.endpointUrl);
+        const std::vector<Client*> sessions{&client, &client2};
+        ShardedSubscriptionOptions options;
+        options.shardsPerSession = 1;
+        options.maxItemsPerSubscription = 1;
+        ShardedSubscription sharded(sessions, options);
+        for (size_t i = 0; i < 4; ++i) {
+            sharded.subscribeDataChange(ids[i], AttributeId::Value);
+        }
+        CHECK(client.subscriptions().size() == 2);
+        CHECK(client2.subscriptions().size() == 2);
+    }
+
+    SUBCASE("Unified notification callback") {
+        ShardedSubscriptionOptions options;
+        options.subscriptionParameters.publishingInterval = 50.0;
+        ShardedSubscription sharded(client, options);
+        std::set<IntegerId> notified;
+        sharded.setNotificationCallback([&](IntegerId handle, const DataValue&) {
+            notified.insert(handle);
+        });
+        std::set<IntegerId> handles;
+        for (const auto& id : ids) {
+            handles.insert(sharded.subscribeDataChange(id, AttributeId::Value));
+        }
+        for (int i = 0; i < 10 && notified.size() < handles.size(); ++i) {
+            client.runIterate(100);
+        }
+        CHECK(notified == handles);
+    }
+
+    CHECK(client.subscriptions().empty());
+}
+#endif
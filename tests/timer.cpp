@@ -0,0 +1,150 @@
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/client.hpp"
+#include "open62541pp/detail/client_context.hpp"
+#include "open62541pp/detail/server_context.hpp"
+#include "open62541pp/server.hpp"
+#include "open62541pp/timer.hpp"
+
+#include "helper/server_client_setup.hpp"
+
+using namespace opcua;
+using namespace std::chrono_literals;
+
+static void iterate(Server& server) {
+    server.runIterate();
+    std::this_thread::sleep_for(1ms);
+}
+
+static void iterate(Client& client) {
+    client.runIterate(1);
+}
+
+template <typename T, typename Predicate>
+static bool runUntil(T& connection, Predicate&& predicate) {
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!predicate() && std::chrono::steady_clock::now() < deadline) {
+        iterate(connection);
+    }
+    return predicate();
+}
+
+template <typename T>
+static void runFor(T& connection, std::chrono::milliseconds duration) {
+    const auto deadline = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < deadline) {
+        iterate(connection);
+    }
+}
+
+template <typename T>
+static void testTimers(T& connection) {
+    SUBCASE("Repeated timer") {
+        size_t count = 0;
+        const auto id = connection.schedule(10ms, [&] { ++count; });
+        CHECK(runUntil(connection, [&] { return count >= 3; }));
+        CHECK(connection.timerStatistics(id).invocations == count);
+
+        CHECK(connection.cancelTimer(id));
+        CHECK_FALSE(connection.cancelTimer(id));
+        CHECK_THROWS_AS(connection.timerStatistics(id), BadStatus);
+        const size_t countCancelled = count;
+        runFor(connection, 50ms);
+        CHECK(count == countCancelled);
+    }
+
+    SUBCASE("One-shot timer") {
+        size_t count = 0;
+        const auto id = connection.scheduleOnce(10ms, [&] { ++count; });
+        CHECK(runUntil(connection, [&] { return count >= 1; }));
+        runFor(connection, 50ms);
+        CHECK(count == 1);
+        CHECK_FALSE(connection.cancelTimer(id));  // removed after execution
+    }
+
+    SUBCASE("Cancel one-shot timer") {
+        size_t count = 0;
+        const auto id = connection.scheduleOnce(20ms, [&] { ++count; });
+        CHECK(connection.cancelTimer(id));
+        runFor(connection, 50ms);
+        CHECK(count == 0);
+    }
+
+    SUBCASE("Move-only callable") {
+        int value = 0;
+        auto ptr = std::make_unique<int>(11);
+        connection.scheduleOnce(0ms, [&, p = std::move(ptr)] { value = *p; });
+        CHECK(runUntil(connection, [&] { return value == 11; }));
+    }
+
+    SUBCASE("Coalesce equal intervals") {
+        const auto& timers = detail::getContext(connection).timers;
+        const size_t slots = timers.slotCount();
+        size_t countA = 0;
+        size_t countB = 0;
+        const auto a = connection.schedule(10ms, [&] { ++countA; });
+        const auto b = connection.schedule(10ms, [&] { ++countB; });
+        const auto c = connection.schedule(20ms, [] {});
+        CHECK(timers.slotCount() == slots + 2);
+
+        CHECK(runUntil(connection, [&] { return countA >= 3; }));
+        CHECK(countA == countB);  // executed in the same wakeup
+
+        connection.cancelTimer(a);
+        CHECK(timers.slotCount() == slots + 2);
+        connection.cancelTimer(b);
+        CHECK(timers.slotCount() == slots + 1);
+        connection.cancelTimer(c);
+        CHECK(timers.slotCount() == slots);
+    }
+
+    SUBCASE("Overrun statistics") {
+        const auto id = connection.schedule(5ms, [] { std::this_thread::sleep_for(10ms); });
+        CHECK(runUntil(connection, [&] {
+            return connection.timerStatistics(id).invocations >= 2;
+        }));
+        const auto statistics = connection.timerStatistics(id);
+        CHECK(statistics.overruns == statistics.invocations);
+        CHECK(statistics.lastDuration >= 10ms);
+        CHECK(statistics.maxDuration >= statistics.lastDuration);
+        connection.cancelTimer(id);
+    }
+
+    SUBCASE("Cancel within callback") {
+        size_t count = 0;
+        TimerId id = 0;
+        id = connection.schedule(10ms, [&] {
+            ++count;
+            connection.cancelTimer(id);
+        });
+        CHECK(runUntil(connection, [&] { return count >= 1; }));
+        runFor(connection, 50ms);
+        CHECK(count == 1);
+    }
+
+    SUBCASE("Rethrow exceptions in main loop") {
+        const auto id = connection.scheduleOnce(0ms, [] { throw std::runtime_error("timer"); });
+        CHECK_THROWS_AS(runUntil(connection, [] { return false; }), std::runtime_error);
+        CHECK_FALSE(connection.cancelTimer(id));
+    }
+
+    SUBCASE("Invalid interval") {
+        CHECK_THROWS_AS(connection.schedule(0ms, [] {}), BadStatus);
+    }
+}
+
+TEST_CASE("Timer (Server)") {
+    Server server;
+    testTimers(server);
+}
+
+TEST_CASE("Timer (Client)") {
+    ServerClientSetup setup;
+    setup.client.connect(setup.endpointUrl);
+    testTimers(setup.client);
+}
@@ -38,3 +38,8 @@ TEST_CASE_TEMPLATE("IsMutableContainer false", T, const std::vector<int>, const
     CHECK_FALSE(detail::IsMutableContainer<T&>::value);
     CHECK_FALSE(detail::IsMutableContainer<T&&>::value);
 }
+
+TEST_CASE("IsOptional") {
+    CHECK(detail::IsOptional<std::optional<int>>::value);
+    CHECK_FALSE(detail::IsOptional<int>::value);
+}
@@ -6,6 +6,7 @@
 #include "open62541pp/detail/string_utils.hpp"  // toNativeString
 #include "open62541pp/types.hpp"
 #include "open62541pp/ua/nodeids.hpp"
+#include "open62541pp/ua/types.hpp"  // EUInformation, Range
 
 using namespace opcua;
 
@@ -671,6 +672,53 @@ TEST_CASE("Variant") {
         CHECK(var.to<double>() == value);
     }
 
+    SUBCASE("Assign scalar in-place (copy)") {
+        Variant var(11.11);
+        const void* data = var.data();
+        var = 22.22;
+        CHECK(var.data() == data);
+        CHECK(var.scalar<double>() == 22.22);
+        var = var.scalar<double>();  // self-assignment
+        CHECK(var.scalar<double>() == 22.22);
+        // different type
+        var = 1;
+        CHECK(var.isType<int>());
+        CHECK(var.scalar<int>() == 1);
+        // storage not owned
+        double value = 1.0;
+        var = &value;
+        var = 33.33;
+        CHECK(var.data() != &value);
+        CHECK(value == 1.0);
+    }
+
+    SUBCASE("Assign array in-place (copy)") {
+        Variant var(std::vector<int>{1, 2, 3});
+        const void* data = var.data();
+        var = std::vector<int>{4, 5, 6};
+        CHECK(var.data() == data);
+        CHECK(var.to<std::vector<int>>() == std::vector<int>{4, 5, 6});
+        // different length
+        var = std::vector<int>{7, 8};
+        CHECK(var.to<std::vector<int>>() == std::vector<int>{7, 8});
+    }
+
+    SUBCASE("emplaceScalar") {
+        Variant var;
+        int32_t& value = var.emplaceScalar<int32_t>();
+        CHECK(var.isScalar());
+        CHECK(value == 0);
+        value = 5;
+        CHECK(var.scalar<int32_t>() == 5);
+        // reuse storage
+        CHECK(&var.emplaceScalar<int32_t>(6) == &value);
+        CHECK(var.scalar<int32_t>() == 6);
+        // different type
+        var.emplaceScalar<String>("test");
+        CHECK(var.scalar<String>() == "test");
+        CHECK(var.emplaceScalar<String>().empty());
+    }
+
     SUBCASE("Set/get array (pointer)") {
         Variant var;
         std::vector<float> array{0, 1, 2};
@@ -854,6 +902,73 @@ TEST_CASE("Variant") {
             CHECK(dst->data != data);  // can not move const -> copy
         }
     }
+
+    SUBCASE("Comparison and hash") {
+        auto checkEqual = [](const Variant& lhs, const Variant& rhs) {
+            CHECK(lhs == rhs);
+            CHECK_FALSE(lhs != rhs);
+            CHECK(lhs.hash() == rhs.hash());
+            CHECK(std::hash<Variant>{}(lhs) == std::hash<Variant>{}(rhs));
+        };
+
+        SUBCASE("Empty") {
+            checkEqual(Variant{}, Variant{});
+            CHECK(Variant{} != Variant(1));
+        }
+
+        SUBCASE("Scalar") {
+            checkEqual(Variant(11), Variant(11));
+            CHECK(Variant(11) != Variant(12));
+            CHECK(Variant(int32_t{11}) != Variant(uint32_t{11}));  // different type
+            checkEqual(Variant("test"), Variant("test"));
+            CHECK(Variant("test") != Variant("tes"));
+            checkEqual(Variant(LocalizedText("en", "text")), Variant(LocalizedText("en", "text")));
+            CHECK(Variant(LocalizedText("en", "text")) != Variant(LocalizedText("de", "text")));
+        }
+
+        SUBCASE("Scalar vs. array") {
+            CHECK(Variant(1) != Variant(std::vector<int>{1}));
+        }
+
+        SUBCASE("Array") {
+            checkEqual(Variant(std::vector<int>{1, 2, 3}), Variant(std::vector<int>{1, 2, 3}));
+            CHECK(Variant(std::vector<int>{1, 2, 3}) != Variant(std::vector<int>{1, 2, 4}));
+            CHECK(Variant(std::vector<int>{1, 2, 3}) != Variant(std::vector<int>{1, 2}));
+            checkEqual(
+                Variant(std::vector<std::string>{"a", "b"}),
+                Variant(std::vector<std::string>{"a", "b"})
+            );
+            CHECK(
+                Variant(std::vector<std::string>{"a", "b"}) !=
+                Variant(std::vector<std::string>{"a", "c"})
+            );
+        }
+
+        SUBCASE("Array dimensions") {
+            Variant lhs(std::vector<int>{1, 2, 3, 4});
+            Variant rhs(std::vector<int>{1, 2, 3, 4});
+            lhs->arrayDimensions = detail::allocateArray<uint32_t>(2, UA_TYPES[UA_TYPES_UINT32]);
+            lhs->arrayDimensions[0] = 2;  // NOLINT
+            lhs->arrayDimensions[1] = 2;  // NOLINT
+            lhs->arrayDimensionsSize = 2;
+            CHECK(lhs != rhs);
+        }
+
+        SUBCASE("Structure") {
+            const EUInformation meter("ns", 1, {}, {"", "m"});
+            const EUInformation second("ns", 1, {}, {"", "s"});
+            checkEqual(Variant(meter), Variant(EUInformation(meter)));
+            CHECK(Variant(meter) != Variant(second));
+            checkEqual(Variant(Range(1.0, 2.0)), Variant(Range(1.0, 2.0)));
+            CHECK(Variant(Range(1.0, 2.0)) != Variant(Range(1.0, 3.0)));
+        }
+
+        SUBCASE("Array of variants") {
+            const std::vector<Variant> values{Variant(1), Variant("a")};
+            checkEqual(Variant(values), Variant(values));
+            CHECK(Variant(values) != Variant(std::vector<Variant>{Variant(1), Variant("b")}));
+        }
+    }
 }
 
 TEST_CASE("DataValue") {
@@ -978,6 +1093,17 @@ TEST_CASE("DataValue") {
         }
         CHECK(var.scalar<int>() == 11);
     }
+
+    SUBCASE("Comparison and hash") {
+        const DataValue dv(Variant(11), DateTime{1}, {}, {}, {}, UA_STATUSCODE_GOOD);
+        CHECK(dv == DataValue(Variant(11), DateTime{1}, {}, {}, {}, UA_STATUSCODE_GOOD));
+        CHECK(dv.hash() == DataValue(dv).hash());
+        CHECK(std::hash<DataValue>{}(dv) == std::hash<DataValue>{}(DataValue(dv)));
+        CHECK(dv != DataValue(Variant(12), DateTime{1}, {}, {}, {}, UA_STATUSCODE_GOOD));
+        CHECK(dv != DataValue(Variant(11), DateTime{2}, {}, {}, {}, UA_STATUSCODE_GOOD));
+        CHECK(dv != DataValue(Variant(11), {}, {}, {}, {}, UA_STATUSCODE_GOOD));
+        CHECK(dv != DataValue(Variant(11), DateTime{1}, {}, {}, {}, UA_STATUSCODE_BADINTERNALERROR));
+    }
 }
 
 TEST_CASE("ExtensionObject") {